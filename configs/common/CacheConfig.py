@@ -72,6 +72,9 @@ def _get_cache_opts(level, options):
     if hasattr(options, prefetcher_attr):
         opts["prefetcher"] = _get_hwp(getattr(options, prefetcher_attr))
 
+    if getattr(options, "functional_warming", False):
+        opts["functional_warming"] = True
+
     return opts
 
 
@@ -33,6 +33,8 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import os
+
 import m5.objects
 from m5 import fatal
 
@@ -48,17 +50,32 @@ isa_string_map = {
 }
 
 
+def etrace_file_name(file_name, cpu_id, num_cpus):
+    """Name of the elastic trace file of a cpu. In multi processor systems
+    every cpu has its own traces, named by inserting the cpu id before the
+    extensions of the given name, e.g. data.proto.gz becomes
+    data.cpu1.proto.gz for cpu 1."""
+    if num_cpus == 1:
+        return file_name
+    head, sep, tail = os.path.basename(file_name).partition(".")
+    return os.path.join(
+        os.path.dirname(file_name), f"{head}.cpu{cpu_id}{sep}{tail}"
+    )
+
+
 def config_etrace(cpu_cls, cpu_list, options):
     if issubclass(cpu_cls, m5.objects.DerivO3CPU):
-        # Assign the same file name to all cpus for now. This must be
-        # revisited when creating elastic traces for multi processor systems.
-        for cpu in cpu_list:
+        for i, cpu in enumerate(cpu_list):
             # Attach the elastic trace probe listener. Set the protobuf trace
             # file names. Set the dependency window size equal to the cpu it
             # is attached to.
             cpu.traceListener = m5.objects.ElasticTrace(
-                instFetchTraceFile=options.inst_trace_file,
-                dataDepTraceFile=options.data_trace_file,
+                instFetchTraceFile=etrace_file_name(
+                    options.inst_trace_file, i, len(cpu_list)
+                ),
+                dataDepTraceFile=etrace_file_name(
+                    options.data_trace_file, i, len(cpu_list)
+                ),
                 depWindowSize=3 * cpu.numROBEntries,
             )
             # Make the number of entries in the ROB, LQ and SQ very
@@ -615,6 +615,45 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         default=None,
         help="switch from timing to Detailed CPU after warmup period of <N>",
     )
+
+    # Statistical sampling - functionally warm on the atomic CPU and
+    # periodically measure a short unit on the detailed CPU until the mean
+    # CPI is known to the requested error
+    parser.add_argument(
+        "--sample-period",
+        action="store",
+        type=int,
+        default=None,
+        help="measure one sampling unit every <N> instructions",
+    )
+    parser.add_argument(
+        "--sample-unit",
+        action="store",
+        type=int,
+        default=1000,
+        help="instructions per sampling unit",
+    )
+    parser.add_argument(
+        "--sample-warmup",
+        action="store",
+        type=int,
+        default=2000,
+        help="instructions of detailed warming before each sampling unit",
+    )
+    parser.add_argument(
+        "--sample-error",
+        action="store",
+        type=float,
+        default=0.03,
+        help="stop sampling once the relative error of the CPI is below <E>",
+    )
+    parser.add_argument(
+        "--sample-confidence",
+        action="store",
+        type=float,
+        default=0.997,
+        help="confidence level of --sample-error",
+    )
     parser.add_argument(
         "-p", "--prog-interval", type=str, help="CPU Progress Interval"
     )
@@ -643,6 +682,13 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         default=None,
         help="Number of instructions to fast forward before switching",
     )
+    parser.add_argument(
+        "--functional-warming",
+        action="store_true",
+        default=False,
+        help="""Only warm the cache contents, without stats or latency,
+                while the CPUs run in atomic mode (e.g. fast-forwarding).""",
+    )
     parser.add_argument(
         "-S",
         "--simpoint",
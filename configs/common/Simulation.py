@@ -75,17 +75,16 @@ def setCPUClass(options):
     if TmpClass.require_caches() and not options.caches and not options.ruby:
         fatal(f"{options.cpu_type} must be used with caches")
 
-    if options.checkpoint_restore != None:
+    if options.checkpoint_restore != None and not options.sample_period:
         if options.restore_with_cpu != options.cpu_type:
             CPUClass = TmpClass
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
-    elif options.fast_forward:
+    elif options.fast_forward or options.sample_period:
         CPUClass = TmpClass
         CPUISA = ObjectList.cpu_list.get_isa(options.cpu_type)
-        TmpClass = getCPUClass(
+        TmpClass, test_mem_mode = getCPUClass(
             CpuConfig.isa_string_map[CPUISA] + "AtomicSimpleCPU"
         )
-        test_mem_mode = "atomic"
 
     # Ruby only supports atomic accesses in noncaching mode
     if test_mem_mode == "atomic" and options.ruby:
@@ -491,6 +490,19 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.sample_period:
+        if options.num_cpus != 1:
+            fatal("--sample-period only supports a single CPU")
+        if options.fast_forward:
+            fatal("Can't specify both --sample-period and --fast-forward")
+        if options.standard_switch or options.repeat_switch:
+            fatal("Can't specify --sample-period with CPU switching options")
+        if (
+            options.take_checkpoints != None
+            or options.take_simpoint_checkpoints != None
+        ):
+            fatal("Can't specify both --sample-period and checkpointing")
+
     # Setup global stat filtering.
     stat_root_simobjs = []
     for stat_root_str in options.stats_root:
@@ -554,6 +566,19 @@ def run(options, root, testsys, cpu_class):
         testsys.switch_cpus = switch_cpus
         switch_cpu_list = [(testsys.cpu[i], switch_cpus[i]) for i in range(np)]
 
+    # The sampling controller does the switching itself, functionally
+    # warming on the atomic cpus and measuring on the detailed ones
+    if options.sample_period:
+        testsys.sampler = SamplingController(
+            warming_cpus=testsys.cpu,
+            detailed_cpus=switch_cpus,
+            period=options.sample_period,
+            unit_size=options.sample_unit,
+            detailed_warming=options.sample_warmup,
+            target_error=options.sample_error,
+            confidence=options.sample_confidence,
+        )
+
     if options.repeat_switch:
         switch_class = getCPUClass(options.cpu_type)[0]
         if switch_class.require_caches() and not options.caches:
@@ -734,7 +759,7 @@ def run(options, root, testsys, cpu_class):
             cpt_starttick,
         )
 
-    if options.standard_switch or cpu_class:
+    if (options.standard_switch or cpu_class) and not options.sample_period:
         if options.standard_switch:
             print(
                 "Switch at instruction count:%s"
@@ -806,7 +831,13 @@ def run(options, root, testsys, cpu_class):
 
         # If checkpoints are being taken, then the checkpoint instruction
         # will occur in the benchmark code it self.
-        if options.repeat_switch and maxtick > options.repeat_switch:
+        if options.sample_period:
+            exit_event = testsys.sampler.run(testsys, maxtick)
+            print(
+                "Sampled CPI %f with relative error %f"
+                % (testsys.sampler.cpiMean(), testsys.sampler.relativeError())
+            )
+        elif options.repeat_switch and maxtick > options.repeat_switch:
             exit_event = repeatSwitch(
                 testsys, repeat_switch_cpu_list, maxtick, options.repeat_switch
             )
@@ -295,4 +295,6 @@ if args.wait_gdb:
     system.workload.wait_for_remote_gdb = True
 
 root = Root(full_system=False, system=system)
+if args.ruby and args.ruby_event_queues > 1:
+    root.sim_quantum = Ruby.parallel_sim_quantum(args)
 Simulation.run(args, root, system, FutureClass)
@@ -0,0 +1,87 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script replays a branch trace through one or more branch predictors
+# and reports the mispredictions per kilo instruction of each in the
+# replayer's stats (replayer.mpki). No CPU or memory system is simulated,
+# so a sweep over predictor configurations takes seconds rather than
+# hours. The trace is written by a BranchTraceRecorder attached to a CPU:
+#
+#   system.cpu.branch_trace = BranchTraceRecorder(manager=system.cpu)
+#
+# and replayed with, for example:
+#
+#   build/ALL/gem5.opt configs/example/bpred_replay.py \
+#       --trace m5out/system.cpu.branch_trace.trace.gz \
+#       --predictor LTAGE --predictor TAGE_SC_L_64KB
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import fatal
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument("--trace", required=True, help="Branch trace to replay")
+parser.add_argument(
+    "--predictor",
+    action="append",
+    metavar="CLASS",
+    help="Branch predictor to replay the trace through, may be repeated",
+)
+parser.add_argument(
+    "--num-threads",
+    type=int,
+    default=1,
+    help="Number of hardware threads in the trace",
+)
+
+args = parser.parse_args()
+
+predictors = []
+for name in args.predictor or ["TournamentBP"]:
+    cls = getattr(m5.objects, name, None)
+    if cls is None or not issubclass(cls, BranchPredictor):
+        fatal(f"{name} is not a branch predictor")
+    predictors.append(cls())
+
+root = Root(full_system=False)
+root.replayer = BranchTraceReplayer(
+    trace_file=args.trace,
+    numThreads=args.num_threads,
+    predictors=predictors,
+)
+
+# Instantiate configuration
+m5.instantiate()
+
+# Simulate until the whole trace has been replayed
+exit_event = m5.simulate()
+
+print("Exiting @ tick", m5.curTick(), "because", exit_event.getCause())
@@ -37,14 +37,12 @@
 
 import argparse
 
-from m5.util import (
-    addToPath,
-    fatal,
-)
+from m5.util import addToPath
 
 addToPath("../")
 
 from common import (
+    CpuConfig,
     MemConfig,
     Options,
     Simulation,
@@ -55,15 +53,21 @@ from common.Caches import *
 def config_cache(args, system):
     """
     Configure the cache hierarchy.  Only two configurations are natively
-    supported as an example: L1(I/D) only or L1 + L2.
+    supported as an example: L1(I/D) only or L1 + L2. Every cpu has its own
+    L1 caches, the L2 and the memory are shared.
     """
     from common.CacheConfig import _get_cache_opts
 
-    system.l1i = L1_ICache(**_get_cache_opts("l1i", args))
-    system.l1d = L1_DCache(**_get_cache_opts("l1d", args))
+    system.l1i = [
+        L1_ICache(**_get_cache_opts("l1i", args)) for cpu in system.cpu
+    ]
+    system.l1d = [
+        L1_DCache(**_get_cache_opts("l1d", args)) for cpu in system.cpu
+    ]
 
-    system.cpu.dcache_port = system.l1d.cpu_side
-    system.cpu.icache_port = system.l1i.cpu_side
+    for cpu, l1i, l1d in zip(system.cpu, system.l1i, system.l1d):
+        cpu.dcache_port = l1d.cpu_side
+        cpu.icache_port = l1i.cpu_side
 
     if args.l2cache:
         # Provide a clock for the L2 and the L1-to-L2 bus here as they
@@ -77,11 +81,13 @@ def config_cache(args, system):
         system.l2.cpu_side = system.tol2bus.mem_side_ports
         system.l2.mem_side = system.membus.cpu_side_ports
 
-        system.l1i.mem_side = system.tol2bus.cpu_side_ports
-        system.l1d.mem_side = system.tol2bus.cpu_side_ports
+        l1_bus = system.tol2bus
     else:
-        system.l1i.mem_side = system.membus.cpu_side_ports
-        system.l1d.mem_side = system.membus.cpu_side_ports
+        l1_bus = system.membus
+
+    for l1i, l1d in zip(system.l1i, system.l1d):
+        l1i.mem_side = l1_bus.cpu_side_ports
+        l1d.mem_side = l1_bus.cpu_side_ports
 
 
 parser = argparse.ArgumentParser()
@@ -96,17 +102,16 @@ if "--ruby" in sys.argv:
 
 args = parser.parse_args()
 
-if args.num_cpus > 1:
-    fatal("This script does not support multi-processor trace replay.\n")
-
 system = System(
     mem_mode=TraceCPU.memory_mode(),
     mem_ranges=[AddrRange(args.mem_size)],
     cache_line_size=args.cacheline_size,
 )
 
-# Generate the TraceCPU
-system.cpu = TraceCPU()
+# Generate the TraceCPUs. With multiple cpus, each replays its own traces
+# (see CpuConfig.etrace_file_name) concurrently against the shared memory
+# system.
+system.cpu = [TraceCPU() for i in range(args.num_cpus)]
 
 # Create a top-level voltage domain
 system.voltage_domain = VoltageDomain(voltage=args.sys_voltage)
@@ -131,9 +136,14 @@ system.cpu_clk_domain = SrcClockDomain(
 for cpu in system.cpu:
     cpu.clk_domain = system.cpu_clk_domain
 
-# Assign input trace files to the Trace CPU
-system.cpu.instTraceFile = args.inst_trace_file
-system.cpu.dataTraceFile = args.data_trace_file
+# Assign input trace files to the Trace CPUs
+for i, cpu in enumerate(system.cpu):
+    cpu.instTraceFile = CpuConfig.etrace_file_name(
+        args.inst_trace_file, i, args.num_cpus
+    )
+    cpu.dataTraceFile = CpuConfig.etrace_file_name(
+        args.data_trace_file, i, args.num_cpus
+    )
 
 # Configure the classic memory system args
 MemClass = Simulation.setMemClass(args)
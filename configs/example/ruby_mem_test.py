@@ -159,9 +159,10 @@ system.ruby.clk_domain = SrcClockDomain(
 
 #
 # The tester is most effective when randomization is turned on and
-# artifical delay is randomly inserted on messages
+# artifical delay is randomly inserted on messages. Messages exchanged
+# between the event queues of parallel Ruby can't be delayed randomly.
 #
-system.ruby.randomization = True
+system.ruby.randomization = args.ruby_event_queues <= 1
 
 assert len(cpus) == len(system.ruby._cpu_ports)
 
@@ -187,6 +188,9 @@ root.system.mem_mode = "timing"
 # Not much point in this being higher than the L1 latency
 m5.ticks.setGlobalFrequency("1ns")
 
+if args.ruby_event_queues > 1:
+    root.sim_quantum = Ruby.parallel_sim_quantum(args)
+
 # instantiate configuration
 m5.instantiate()
 
@@ -100,7 +100,24 @@ def define_options(parser):
         help="""routing algorithm in network.
             0: weight-based table
             1: XY (for Mesh. see garnet/RoutingUnit.cc)
-            2: Custom (see garnet/RoutingUnit.cc""",
+            2: Custom (see garnet/RoutingUnit.cc
+            3: Adaptive west-first (for Mesh)
+            4: Adaptive odd-even (for Mesh)""",
+    )
+    parser.add_argument(
+        "--regional-congestion",
+        action="store_true",
+        default=False,
+        help="""adaptive routing also considers the congestion at
+            the next router, not only at the local output ports""",
+    )
+    parser.add_argument(
+        "--express-link-distance",
+        action="store",
+        type=int,
+        default=4,
+        help="number of routers spanned by an express link "
+        "(for the Mesh_express topology).",
     )
     parser.add_argument(
         "--network-fault-model",
@@ -116,6 +133,23 @@ def define_options(parser):
         default=50000,
         help="network-level deadlock threshold.",
     )
+    parser.add_argument(
+        "--garnet-fast-mode",
+        action="store_true",
+        default=False,
+        help="""send multi-flit packets as aggregated flits occupying
+            each link for the duration of the flits they stand for,
+            unless the injection VCs or the routers on the path are
+            congested""",
+    )
+    parser.add_argument(
+        "--garnet-fast-mode-threshold",
+        action="store",
+        type=float,
+        default=0.5,
+        help="fraction of busy injection or router VCs above which fast "
+        "mode falls back to per-flit packets.",
+    )
     parser.add_argument(
         "--simple-physical-channels",
         action="store_true",
@@ -171,7 +205,10 @@ def init_network(options, network, InterfaceClass):
         network.vcs_per_vnet = options.vcs_per_vnet
         network.ni_flit_size = options.link_width_bits / 8
         network.routing_algorithm = options.routing_algorithm
+        network.regional_congestion = options.regional_congestion
         network.garnet_deadlock_threshold = options.garnet_deadlock_threshold
+        network.fast_mode = options.garnet_fast_mode
+        network.fast_mode_threshold = options.garnet_fast_mode_threshold
 
         # Create Bridges and connect them to the corresponding links
         for intLink in network.int_links:
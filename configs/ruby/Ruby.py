@@ -44,6 +44,7 @@ from m5.defines import buildEnv
 from m5.objects import *
 from m5.util import (
     addToPath,
+    convert,
     fatal,
 )
 
@@ -125,6 +126,17 @@ def define_options(parser):
         help="Recycle latency for ruby controller input buffers",
     )
 
+    parser.add_argument(
+        "--ruby-event-queues",
+        type=int,
+        default=0,
+        help="Spread the routers of the simple network, along with the "
+        "controllers and CPUs attached to them, over this many event "
+        "queues simulated in parallel. Messages crossing internal links "
+        "are exchanged between queues, so the link latency sets the "
+        "simulation quantum. 0 = single event queue",
+    )
+
     protocol = buildEnv["PROTOCOL"]
     exec(f"from . import {protocol}")
     eval(f"{protocol}.define_options(parser)")
@@ -162,6 +174,8 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
         crossbar = None
         if len(system.mem_ranges) > 1:
             crossbar = IOXBar()
+            if options.ruby_event_queues > 1:
+                crossbar.eventq_index = dir_cntrl.eventq_index
             crossbars.append(crossbar)
             dir_cntrl.memory_out_port = crossbar.cpu_side_ports
 
@@ -184,6 +198,10 @@ def setup_memory_controllers(system, ruby, dir_cntrls, options):
             if options.access_backing_store:
                 dram_intf.kvm_map = False
 
+            # Memory is accessed synchronously by its directory
+            if options.ruby_event_queues > 1:
+                mem_ctrl.eventq_index = dir_cntrl.eventq_index
+
             mem_ctrls.append(mem_ctrl)
             dir_ranges.append(dram_intf.range)
 
@@ -218,6 +236,45 @@ def create_topology(controllers, options):
     return topology
 
 
+def partition_event_queues(options, network, cpus, cpu_sequencers):
+    """Assign each router of the network, the controllers attached to it
+    and the CPUs using these controllers to one of
+    options.ruby_event_queues event queues. Only the internal links of
+    the network then connect objects on different queues."""
+    if options.network != "simple":
+        fatal("Parallel Ruby requires the simple network.")
+
+    for router in network.routers:
+        router.eventq_index = router.router_id % options.ruby_event_queues
+
+    # DMA devices are not partitioned and call into their sequencer
+    # directly, so DMA controllers, and the routers they are attached
+    # to, stay on the first queue with them
+    for link in network.ext_links:
+        if isinstance(getattr(link.ext_node, "dma_sequencer", None), RubyPort):
+            link.int_node.eventq_index = 0
+
+    for link in network.ext_links:
+        cntrl = link.ext_node
+        cntrl.eventq_index = link.int_node.eventq_index
+        for attr in ("sequencer", "sequencer1", "dma_sequencer"):
+            seq = getattr(cntrl, attr, None)
+            if isinstance(seq, RubyPort):
+                seq.eventq_index = cntrl.eventq_index
+
+    # The CPUs call into their sequencer directly
+    for cpu, seq in zip(cpus, cpu_sequencers):
+        cpu.eventq_index = seq.eventq_index
+
+
+def parallel_sim_quantum(options):
+    """Return the simulation quantum for parallel Ruby in ticks, which is
+    the latency of the internal links of the network."""
+    m5.ticks.fixGlobalFrequency()
+    period = 1.0 / convert.toFrequency(options.ruby_clock)
+    return m5.ticks.fromSeconds(options.link_latency * period)
+
+
 def create_system(
     options,
     full_system,
@@ -270,6 +327,9 @@ def create_system(
     # Initialize network based on topology
     Network.init_network(options, network, InterfaceClass)
 
+    if options.ruby_event_queues > 1:
+        partition_event_queues(options, network, cpus, cpu_sequencers)
+
     # Create a port proxy for connecting the system port. This is
     # independent of the protocol and kept in the protocol-agnostic
     # part (i.e. here).
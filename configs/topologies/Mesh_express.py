@@ -0,0 +1,96 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from topologies.Mesh_XY import Mesh_XY
+
+from m5.objects import *
+from m5.params import *
+
+# Creates a Mesh_XY and adds express links that skip
+# options.express_link_distance routers in both dimensions.
+# Express links start at every router whose column (row) is a multiple
+# of the distance, so the express ports are named "EastExpress",
+# "WestExpress", "NorthExpress" and "SouthExpress".
+# Garnet's adaptive routing algorithms (--routing-algorithm=3 or 4) use
+# them when the packet has at least that many hops left in the
+# dimension; table-based routing prefers them through their weight.
+
+
+class Mesh_express(Mesh_XY):
+    description = "Mesh_express"
+
+    def makeTopology(self, options, network, IntLink, ExtLink, Router):
+        super().makeTopology(options, network, IntLink, ExtLink, Router)
+
+        distance = options.express_link_distance
+        assert distance > 1
+
+        routers = network.routers
+        num_rows = options.mesh_rows
+        num_columns = int(len(routers) / num_rows)
+
+        if options.network == "garnet":
+            network.express_link_distance = distance
+
+        link_count = len(network.ext_links) + len(network.int_links)
+        express_links = []
+
+        def add_express_link(src, dst, src_outport, dst_inport, weight):
+            nonlocal link_count
+            express_links.append(
+                IntLink(
+                    link_id=link_count,
+                    src_node=routers[src],
+                    dst_node=routers[dst],
+                    src_outport=src_outport,
+                    dst_inport=dst_inport,
+                    latency=options.link_latency,
+                    weight=weight,
+                )
+            )
+            link_count += 1
+
+        # East/West express links (weight = 1)
+        for row in range(num_rows):
+            for col in range(0, num_columns - distance, distance):
+                west = col + (row * num_columns)
+                east = (col + distance) + (row * num_columns)
+                add_express_link(west, east, "EastExpress", "WestExpress", 1)
+                add_express_link(east, west, "WestExpress", "EastExpress", 1)
+
+        # North/South express links (weight = 2)
+        for col in range(num_columns):
+            for row in range(0, num_rows - distance, distance):
+                south = col + (row * num_columns)
+                north = col + ((row + distance) * num_columns)
+                add_express_link(
+                    south, north, "NorthExpress", "SouthExpress", 2
+                )
+                add_express_link(
+                    north, south, "SouthExpress", "NorthExpress", 2
+                )
+
+        network.int_links = network.int_links + express_links
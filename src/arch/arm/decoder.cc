@@ -53,13 +53,12 @@ namespace gem5
 namespace ArmISA
 {
 
-GenericISA::BasicDecodeCache<Decoder, ExtMachInst> Decoder::defaultCache;
-
 Decoder::Decoder(const ArmDecoderParams &params)
     : InstDecoder(params, &data),
       dvmEnabled(params.dvm_enabled),
       data(0), fpscrLen(0), fpscrStride(0),
-      decoderFlavor(safe_cast<ISA *>(params.isa)->decoderFlavor())
+      decoderFlavor(safe_cast<ISA *>(params.isa)->decoderFlavor()),
+      decodeCache(eventQueue(), decoderFlavor)
 {
     reset();
 
@@ -94,8 +94,7 @@ class Decoder : public InstDecoder
     enums::DecoderFlavor decoderFlavor;
 
     /// A cache of decoded instruction objects.
-    static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
-    friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
+    GenericISA::BasicDecodeCache<Decoder, ExtMachInst> decodeCache;
 
     /**
      * Pre-decode an instruction from the current state of the
@@ -135,10 +134,16 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        // The size only depends on the instruction, so it is set once when
+        // the shared StaticInst is created.
+        StaticInstPtr si = decodeCache.decode(mach_inst, addr,
+                [this](ExtMachInst emi) {
+                    StaticInstPtr si = decodeInst(emi);
+                    si->size((!emi.thumb || emi.bigThumb) ? 4 : 2);
+                    return si;
+                });
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
-        si->size((!emi.thumb || emi.bigThumb) ? 4 : 2);
         return si;
     }
 
@@ -195,11 +195,18 @@ MMU::translateFunctional(ThreadContext *tc, Addr va, Addr &pa)
 void
 MMU::invalidateMiscReg()
 {
+    bumpTranslationEpoch();
     s1State.miscRegValid = false;
     s1State.computeAddrTop.flush();
     s2State.computeAddrTop.flush();
 }
 
+bool
+MMU::cacheableTranslations(ThreadContext *tc) const
+{
+    return cacheableTranslations(*ISA::getSelfDebug(tc));
+}
+
 Fault
 MMU::testAndFinalize(const RequestPtr &req,
                      ThreadContext *tc, Mode mode,
@@ -42,6 +42,7 @@
 #define __ARCH_ARM_MMU_HH__
 
 #include "arch/arm/page_size.hh"
+#include "arch/arm/self_debug.hh"
 #include "arch/arm/tlb.hh"
 #include "arch/arm/utility.hh"
 #include "arch/generic/mmu.hh"
@@ -297,10 +298,24 @@ class MMU : public BaseMMU
 
     void invalidateMiscReg();
 
+    bool cacheableTranslations(ThreadContext *tc) const override;
+
+    /**
+     * Whether translations may be cached outside of the MMU given the
+     * state of self-hosted debug.
+     */
+    static bool
+    cacheableTranslations(const SelfDebug &self_debug)
+    {
+        // Watchpoints are checked on every translation.
+        return !self_debug.enabled();
+    }
+
     template <typename OP>
     void
     flush(const OP &tlbi_op)
     {
+        bumpTranslationEpoch();
         if (tlbi_op.stage1Flush()) {
             flushStage1(tlbi_op);
         }
@@ -337,6 +352,7 @@ class MMU : public BaseMMU
     void
     iflush(const OP &tlbi_op)
     {
+        bumpTranslationEpoch();
         for (auto tlb : instruction) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
@@ -349,6 +365,7 @@ class MMU : public BaseMMU
     void
     dflush(const OP &tlbi_op)
     {
+        bumpTranslationEpoch();
         for (auto tlb : data) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012 Google
+ * Copyright (c) 2026 The Regents of the University of California
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -26,15 +26,37 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "arch/mips/decoder.hh"
+#include <gtest/gtest.h>
 
-namespace gem5
-{
+#include "arch/arm/mmu.hh"
+#include "arch/arm/self_debug.hh"
+
+using namespace gem5;
+using namespace ArmISA;
 
-namespace MipsISA
+TEST(ArmMMUTest, CacheableWithoutSelfDebug)
 {
+    SelfDebug self_debug;
+    EXPECT_TRUE(MMU::cacheableTranslations(self_debug));
+}
 
-GenericISA::BasicDecodeCache<Decoder, ExtMachInst> Decoder::defaultCache;
+/**
+ * Watchpoints are checked on every translation while self-hosted debug
+ * is enabled, so the translations are never cached.
+ */
+TEST(ArmMMUTest, NotCacheableWithMonitorDebug)
+{
+    SelfDebug self_debug;
+    // MDSCR_EL1.MDE
+    self_debug.setMDSCRvals(1 << 15);
+    EXPECT_FALSE(MMU::cacheableTranslations(self_debug));
+}
 
-} // namespace MipsISA
-} // namespace gem5
+/** Software stepping also goes through the debug checks. */
+TEST(ArmMMUTest, NotCacheableWithSoftwareStep)
+{
+    SelfDebug self_debug;
+    // MDSCR_EL1.SS
+    self_debug.setMDSCRvals(1);
+    EXPECT_FALSE(MMU::cacheableTranslations(self_debug));
+}
@@ -29,6 +29,15 @@
 #ifndef __ARCH_GENERIC_DECODE_CACHE_HH__
 #define __ARCH_GENERIC_DECODE_CACHE_HH__
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+
 #include "base/types.hh"
 #include "cpu/decode_cache.hh"
 #include "cpu/static_inst_fwd.hh"
@@ -36,14 +45,95 @@
 namespace gem5
 {
 
+class EventQueue;
+
 namespace GenericISA
 {
 
+/**
+ * A cache of decoded instructions shared by all the decoders of an ISA
+ * which run on the same event queue, so each distinct instruction is only
+ * decoded and stored once no matter how many cores run the same code, and
+ * survives CPU switches.
+ *
+ * StaticInsts aren't thread safe: their reference counts and cached
+ * disassembly are updated without synchronization. Decoders on different
+ * event queues, which may run on different threads, therefore never share
+ * a cache, and a cache must only be used by the thread of its event queue.
+ *
+ * The cache is keyed by the extended machine instruction rather than an
+ * address. Decoders which decode the same bits differently depending on
+ * state outside of it (e.g. a mode register) get a separate cache for
+ * each context, and so do decoders which override decodeInst. As entries
+ * only depend on the instruction bits, they never go stale and code
+ * writes don't need to invalidate anything; the per-decoder address
+ * caches in front of this one check the bits on every hit.
+ *
+ * @tparam Decoder The decoder of the ISA, which makes the cache unique to
+ *                 the ISA even if another one uses the same EMI type.
+ * @tparam EMI The extended machine instruction type.
+ */
 template <typename Decoder, typename EMI>
-class BasicDecodeCache
+class SharedDecodeCache
 {
   private:
     decode_cache::InstMap<EMI> instMap;
+
+  public:
+    /// Get the cache of a decoding context.
+    /// @param eventq The event queue of the decoder.
+    /// @param context Decoder state which affects decoding.
+    /// @param type The dynamic type of the decoder, if it may be a subclass
+    ///             of Decoder which decodes differently.
+    static SharedDecodeCache &
+    instance(const EventQueue *eventq, uint64_t context=0,
+             std::type_index type=std::type_index(typeid(Decoder)))
+    {
+        // Decoders on different event queues may look up their caches
+        // concurrently, e.g. when x86 decoders change modes.
+        static std::mutex mutex;
+        static std::map<std::tuple<const EventQueue *, std::type_index,
+                                   uint64_t>,
+                        std::unique_ptr<SharedDecodeCache>> caches;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &cache = caches[{eventq, type, context}];
+        if (!cache)
+            cache = std::make_unique<SharedDecodeCache>();
+        return *cache;
+    }
+
+    /// Look up a machine instruction, decoding it on a miss.
+    /// @param mach_inst The binary instruction to look up.
+    /// @param decode_inst Function to decode mach_inst with on a miss.
+    /// @retval A pointer to the corresponding StaticInst object.
+    template <typename DecodeFunc>
+    StaticInstPtr
+    lookup(const EMI &mach_inst, DecodeFunc &&decode_inst)
+    {
+        auto iter = instMap.find(mach_inst);
+        if (iter != instMap.end())
+            return iter->second;
+
+        StaticInstPtr si = decode_inst(mach_inst);
+        instMap.emplace(mach_inst, si);
+        return si;
+    }
+
+    /// The number of instructions in the cache.
+    size_t size() const { return instMap.size(); }
+};
+
+/**
+ * The decode cache of a decoder. Recently decoded instructions are looked
+ * up by address in a private page cache, which needs no synchronization,
+ * and anything else in the SharedDecodeCache of the ISA.
+ */
+template <typename Decoder, typename EMI>
+class BasicDecodeCache
+{
+  private:
+    SharedDecodeCache<Decoder, EMI> &instMap;
     struct AddrMapEntry
     {
         StaticInstPtr inst;
@@ -52,28 +142,40 @@ class BasicDecodeCache
     decode_cache::AddrMap<AddrMapEntry> decodePages;
 
   public:
+    BasicDecodeCache(const EventQueue *eventq, uint64_t context=0)
+        : instMap(SharedDecodeCache<Decoder, EMI>::instance(eventq, context))
+    {}
+
     /// Decode a machine instruction.
     /// @param mach_inst The binary instruction to decode.
+    /// @param decode_inst Function to decode mach_inst with on a miss. The
+    ///                    StaticInst it returns is shared, so it should set
+    ///                    up anything which depends on mach_inst.
     /// @retval A pointer to the corresponding StaticInst object.
+    template <typename DecodeFunc>
     StaticInstPtr
-    decode(Decoder *const decoder, EMI mach_inst, Addr addr)
+    decode(EMI mach_inst, Addr addr, DecodeFunc &&decode_inst)
     {
         auto &entry = decodePages.lookup(addr);
         if (entry.inst && (entry.machInst == mach_inst))
             return entry.inst;
 
         entry.machInst = mach_inst;
-
-        auto iter = instMap.find(mach_inst);
-        if (iter != instMap.end()) {
-            entry.inst = iter->second;
-            return entry.inst;
-        }
-
-        entry.inst = decoder->decodeInst(mach_inst);
-        instMap[mach_inst] = entry.inst;
+        entry.inst = instMap.lookup(mach_inst,
+                std::forward<DecodeFunc>(decode_inst));
         return entry.inst;
     }
+
+    /// Decode a machine instruction with the decodeInst of decoder.
+    /// @param mach_inst The binary instruction to decode.
+    /// @retval A pointer to the corresponding StaticInst object.
+    StaticInstPtr
+    decode(Decoder *const decoder, EMI mach_inst, Addr addr)
+    {
+        return decode(mach_inst, addr, [decoder](EMI emi) {
+            return decoder->decodeInst(emi);
+        });
+    }
 };
 
 } // namespace GenericISA
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "arch/generic/decode_cache.hh"
+#include "cpu/static_inst.hh"
+
+using namespace gem5;
+
+// The generated flag names come with python bindings, and these tests never
+// print an instruction's flags.
+const char *StaticInstFlags::FlagsStrings[StaticInstFlags::Num_Flags] = {};
+
+namespace
+{
+
+class TestInst : public StaticInst
+{
+  public:
+    const uint32_t bits;
+
+    TestInst(uint32_t _bits) : StaticInst("test", No_OpClass), bits(_bits) {}
+
+    Fault
+    execute(ExecContext *xc, trace::InstRecord *traceData) const override
+    {
+        return NoFault;
+    }
+
+    void advancePC(PCStateBase &pc) const override {}
+
+    std::string
+    generateDisassembly(Addr pc,
+            const loader::SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+};
+
+/** Counts the instructions it decodes. */
+struct TestDecoder
+{
+    int decoded = 0;
+
+    StaticInstPtr
+    decodeInst(uint32_t bits)
+    {
+        decoded++;
+        return new TestInst(bits);
+    }
+};
+
+/** Another ISA, with the same EMI type. */
+struct OtherDecoder : public TestDecoder {};
+
+typedef GenericISA::SharedDecodeCache<TestDecoder, uint32_t> SharedCache;
+typedef GenericISA::BasicDecodeCache<TestDecoder, uint32_t> BasicCache;
+
+/**
+ * Only the identity of an event queue matters to the caches, so they are
+ * stood in for by distinct addresses.
+ */
+const EventQueue *
+eventq(int i)
+{
+    static char queues[16];
+    return reinterpret_cast<const EventQueue *>(&queues[i]);
+}
+
+/** The instructions of each test are distinct from those of others. */
+uint32_t
+testBits(int test, uint32_t bits)
+{
+    return test << 24 | bits;
+}
+
+} // anonymous namespace
+
+TEST(DecodeCacheTest, SharedHitAndMiss)
+{
+    SharedCache &cache = SharedCache::instance(eventq(0));
+    TestDecoder decoder;
+    auto decode = [&](uint32_t bits) { return decoder.decodeInst(bits); };
+
+    const size_t size = cache.size();
+    StaticInstPtr a = cache.lookup(testBits(0, 1), decode);
+    EXPECT_EQ(decoder.decoded, 1);
+    EXPECT_EQ(cache.size(), size + 1);
+
+    // A hit returns the same StaticInst without decoding.
+    EXPECT_EQ(cache.lookup(testBits(0, 1), decode), a);
+    EXPECT_EQ(decoder.decoded, 1);
+
+    StaticInstPtr b = cache.lookup(testBits(0, 2), decode);
+    EXPECT_EQ(decoder.decoded, 2);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(static_cast<const TestInst *>(b.get())->bits, testBits(0, 2));
+}
+
+TEST(DecodeCacheTest, Instances)
+{
+    SharedCache &cache = SharedCache::instance(eventq(0));
+    EXPECT_EQ(&SharedCache::instance(eventq(0), 0, typeid(TestDecoder)),
+              &cache);
+
+    // Each event queue, context and decoder type has its own cache.
+    EXPECT_NE(&SharedCache::instance(eventq(1)), &cache);
+    EXPECT_NE(&SharedCache::instance(eventq(0), 1), &cache);
+    EXPECT_NE(&SharedCache::instance(eventq(0), 0, typeid(OtherDecoder)),
+              &cache);
+}
+
+/** Decoders on the same event queue share their instructions. */
+TEST(DecodeCacheTest, SharedBetweenDecoders)
+{
+    TestDecoder dec1, dec2, dec3;
+    BasicCache cache1(eventq(0)), cache2(eventq(0)), cache3(eventq(1));
+
+    StaticInstPtr a = cache1.decode(&dec1, testBits(1, 1), 0x1000);
+    EXPECT_EQ(dec1.decoded, 1);
+
+    // Another decoder on the same event queue finds it, at any address.
+    EXPECT_EQ(cache2.decode(&dec2, testBits(1, 1), 0x2000), a);
+    EXPECT_EQ(dec2.decoded, 0);
+
+    // A decoder on another event queue decodes its own.
+    StaticInstPtr b = cache3.decode(&dec3, testBits(1, 1), 0x1000);
+    EXPECT_EQ(dec3.decoded, 1);
+    EXPECT_NE(a, b);
+}
+
+/** The address cache checks the instruction bits on every hit. */
+TEST(DecodeCacheTest, AddressHitChecksBits)
+{
+    TestDecoder decoder;
+    BasicCache cache(eventq(2));
+
+    StaticInstPtr a = cache.decode(&decoder, testBits(2, 1), 0x1000);
+    EXPECT_EQ(cache.decode(&decoder, testBits(2, 1), 0x1000), a);
+    EXPECT_EQ(decoder.decoded, 1);
+
+    // Code at the address was rewritten.
+    StaticInstPtr b = cache.decode(&decoder, testBits(2, 2), 0x1000);
+    EXPECT_EQ(decoder.decoded, 2);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(static_cast<const TestInst *>(b.get())->bits, testBits(2, 2));
+
+    // And back, which is a hit in the shared cache.
+    EXPECT_EQ(cache.decode(&decoder, testBits(2, 1), 0x1000), a);
+    EXPECT_EQ(decoder.decoded, 2);
+}
+
+/**
+ * Decoders on different threads, each on its own event queue, decode the
+ * same instructions at the same time. Each gets its own StaticInsts, which
+ * it can reference count without synchronization. Built with a thread
+ * sanitizer, this checks that nothing is shared between them.
+ */
+TEST(DecodeCacheTest, ThreadsDontShare)
+{
+    constexpr int numThreads = 4;
+    constexpr int numInsts = 1000;
+
+    std::vector<std::vector<StaticInstPtr>> insts(numThreads);
+    std::vector<int> decoded(numThreads);
+    std::atomic<int> ready(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            TestDecoder decoder;
+            BasicCache cache(eventq(8 + t));
+            ready++;
+            while (ready < numThreads);
+            for (int round = 0; round < 2; round++) {
+                for (int i = 0; i < numInsts; i++) {
+                    StaticInstPtr si = cache.decode(
+                            &decoder, testBits(3, i), i * 4);
+                    if (round == 0)
+                        insts[t].push_back(si);
+                    else
+                        EXPECT_EQ(si, insts[t][i]);
+                }
+            }
+            decoded[t] = decoder.decoded;
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (int t = 0; t < numThreads; t++) {
+        EXPECT_EQ(decoded[t], numInsts);
+        for (int u = 0; u < t; u++) {
+            for (int i = 0; i < numInsts; i++)
+                ASSERT_NE(insts[t][i], insts[u][i]);
+        }
+    }
+}
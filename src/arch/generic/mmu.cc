@@ -80,6 +80,8 @@ BaseMMU::init()
 void
 BaseMMU::flushAll()
 {
+    bumpTranslationEpoch();
+
     for (auto tlb : instruction) {
         tlb->flushAll();
     }
@@ -96,6 +98,7 @@ BaseMMU::flushAll()
 void
 BaseMMU::demapPage(Addr vaddr, uint64_t asn)
 {
+    bumpTranslationEpoch();
     itb->demapPage(vaddr, asn);
     dtb->demapPage(vaddr, asn);
 }
@@ -158,6 +161,8 @@ BaseMMU::MMUTranslationGen::translate(Range &range) const
 void
 BaseMMU::takeOverFrom(BaseMMU *old_mmu)
 {
+    bumpTranslationEpoch();
+
     Port *old_itb_port = old_mmu->itb->getTableWalkerPort();
     Port *old_dtb_port = old_mmu->dtb->getTableWalkerPort();
     Port *new_itb_port = itb->getTableWalkerPort();
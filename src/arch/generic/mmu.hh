@@ -111,6 +111,24 @@ class BaseMMU : public SimObject
 
     void demapPage(Addr vaddr, uint64_t asn);
 
+    /**
+     * Translations may be cached outside of the MMU, e.g. by the
+     * software TLB of the simple CPUs, for as long as this value doesn't
+     * change. It is bumped whenever TLB entries are flushed.
+     */
+    uint64_t translationEpoch() const { return _translationEpoch; }
+
+    /**
+     * Whether the translations currently done for a thread may be cached
+     * outside of the MMU. MMUs that need to see every access, e.g. to
+     * check watchpoints or segment limits, return false.
+     */
+    virtual bool
+    cacheableTranslations(ThreadContext *tc) const
+    {
+        return true;
+    }
+
     virtual Fault
     translateAtomic(const RequestPtr &req, ThreadContext *tc,
                     Mode mode);
@@ -159,6 +177,11 @@ class BaseMMU : public SimObject
     BaseTLB* itb;
 
   protected:
+    /** Invalidates translations cached outside of the MMU. */
+    void bumpTranslationEpoch() { ++_translationEpoch; }
+
+    uint64_t _translationEpoch = 0;
+
     /**
      * It is possible from the MMU to traverse the entire hierarchy of
      * TLBs, starting from the DTB and ITB (generally speaking from the
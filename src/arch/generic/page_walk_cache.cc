@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "arch/generic/page_walk_cache.hh"
+
+#include <cassert>
+
+namespace gem5
+{
+
+PageWalkCache::PageWalkCache(const std::vector<unsigned> &level_entries)
+{
+    for (unsigned entries : level_entries) {
+        levels.emplace_back(entries);
+        _enabled = _enabled || entries;
+    }
+}
+
+const PageWalkCache::Entry *
+PageWalkCache::lookup(unsigned level, Addr root, Addr tag)
+{
+    if (level >= levels.size())
+        return nullptr;
+
+    for (auto &entry : levels[level]) {
+        if (entry.valid && entry.tag == tag && entry.root == root) {
+            entry.lruSeq = ++lruSeq;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void
+PageWalkCache::insert(unsigned level, Addr root, Addr tag, Addr table,
+                      uint64_t attrs)
+{
+    if (level >= levels.size() || levels[level].empty())
+        return;
+
+    // Refresh a matching entry, otherwise prefer an invalid way and fall
+    // back to the least recently used one.
+    Entry *victim = nullptr;
+    for (auto &entry : levels[level]) {
+        if (entry.valid && entry.tag == tag && entry.root == root) {
+            victim = &entry;
+            break;
+        }
+        if (!victim || (victim->valid &&
+                    (!entry.valid || entry.lruSeq < victim->lruSeq))) {
+            victim = &entry;
+        }
+    }
+    assert(victim);
+
+    victim->root = root;
+    victim->tag = tag;
+    victim->table = table;
+    victim->attrs = attrs;
+    victim->lruSeq = ++lruSeq;
+    victim->valid = true;
+}
+
+void
+PageWalkCache::flush()
+{
+    for (auto &level : levels) {
+        for (auto &entry : level)
+            entry.valid = false;
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
+#define __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of the non-leaf entries of a radix page table, modelled after
+ * the paging-structure caches of x86 processors. Each level of the table
+ * has its own small fully associative, LRU replaced array. An entry maps
+ * the virtual address bits consumed down to and including that level to
+ * the physical address of the next table, so a walker that hits can skip
+ * straight to the deepest cached level.
+ *
+ * Levels are numbered from the root of the table. Entries are tagged with
+ * the physical address of the root so that walks from different address
+ * spaces never alias; any change to the contents of the tables must be
+ * followed by a flush, exactly as for the TLBs the walker fills.
+ */
+class PageWalkCache
+{
+  public:
+    struct Entry
+    {
+        /** Physical address of the root table this entry belongs to. */
+        Addr root = 0;
+        /** Virtual address bits translated by this and upper levels. */
+        Addr tag = 0;
+        /** Physical address of the next level table. */
+        Addr table = 0;
+        /** ISA specific state accumulated from the upper levels. */
+        uint64_t attrs = 0;
+        uint64_t lruSeq = 0;
+        bool valid = false;
+    };
+
+    /**
+     * @param level_entries Number of entries for each level, root first.
+     * A level with no entries is never looked up or filled.
+     */
+    explicit PageWalkCache(const std::vector<unsigned> &level_entries);
+
+    /** Whether any level of the cache has entries. */
+    bool enabled() const { return _enabled; }
+
+    unsigned numLevels() const { return levels.size(); }
+
+    /**
+     * Look up a level of the cache, updating the replacement state on a
+     * hit.
+     *
+     * @return The matching entry or nullptr on a miss.
+     */
+    const Entry *lookup(unsigned level, Addr root, Addr tag);
+
+    /** Fill a level, replacing its least recently used entry. */
+    void insert(unsigned level, Addr root, Addr tag, Addr table,
+                uint64_t attrs);
+
+    /** Invalidate every level. */
+    void flush();
+
+  private:
+    std::vector<std::vector<Entry>> levels;
+    uint64_t lruSeq = 0;
+    bool _enabled = false;
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "arch/generic/page_walk_cache.hh"
+
+using namespace gem5;
+
+TEST(PageWalkCacheTest, Enabled)
+{
+    EXPECT_FALSE(PageWalkCache({}).enabled());
+    EXPECT_FALSE(PageWalkCache({0, 0, 0}).enabled());
+    EXPECT_TRUE(PageWalkCache({0, 2, 0}).enabled());
+    EXPECT_EQ(PageWalkCache({0, 2, 0}).numLevels(), 3);
+}
+
+TEST(PageWalkCacheTest, LookupLevel)
+{
+    PageWalkCache cache({2, 2, 2});
+    cache.insert(1, 0x1000, 0x12, 0x5000, 0x3);
+
+    EXPECT_EQ(cache.lookup(0, 0x1000, 0x12), nullptr);
+    EXPECT_EQ(cache.lookup(2, 0x1000, 0x12), nullptr);
+    EXPECT_EQ(cache.lookup(3, 0x1000, 0x12), nullptr);
+
+    const PageWalkCache::Entry *entry = cache.lookup(1, 0x1000, 0x12);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->table, 0x5000);
+    EXPECT_EQ(entry->attrs, 0x3);
+}
+
+TEST(PageWalkCacheTest, LookupRoot)
+{
+    PageWalkCache cache({2});
+    cache.insert(0, 0x1000, 0x12, 0x5000, 0);
+    cache.insert(0, 0x2000, 0x12, 0x6000, 0);
+
+    // The same virtual address in two address spaces.
+    const PageWalkCache::Entry *entry = cache.lookup(0, 0x1000, 0x12);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->table, 0x5000);
+    entry = cache.lookup(0, 0x2000, 0x12);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->table, 0x6000);
+    EXPECT_EQ(cache.lookup(0, 0x3000, 0x12), nullptr);
+}
+
+TEST(PageWalkCacheTest, DisabledLevel)
+{
+    PageWalkCache cache({0, 1});
+    cache.insert(0, 0x1000, 0x12, 0x5000, 0);
+    EXPECT_EQ(cache.lookup(0, 0x1000, 0x12), nullptr);
+
+    // Filling a level that doesn't exist is ignored.
+    cache.insert(2, 0x1000, 0x12, 0x5000, 0);
+    EXPECT_EQ(cache.lookup(2, 0x1000, 0x12), nullptr);
+}
+
+TEST(PageWalkCacheTest, Refill)
+{
+    PageWalkCache cache({2});
+    cache.insert(0, 0x1000, 0x12, 0x5000, 0);
+    cache.insert(0, 0x1000, 0x34, 0x6000, 0);
+
+    // Filling an entry that is already cached updates it in place
+    // rather than evicting the other one.
+    cache.insert(0, 0x1000, 0x12, 0x7000, 0x1);
+    const PageWalkCache::Entry *entry = cache.lookup(0, 0x1000, 0x12);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->table, 0x7000);
+    EXPECT_EQ(entry->attrs, 0x1);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x34), nullptr);
+}
+
+TEST(PageWalkCacheTest, ReplaceLRU)
+{
+    PageWalkCache cache({2});
+    cache.insert(0, 0x1000, 0x1, 0x5000, 0);
+    cache.insert(0, 0x1000, 0x2, 0x6000, 0);
+    cache.insert(0, 0x1000, 0x3, 0x7000, 0);
+
+    EXPECT_EQ(cache.lookup(0, 0x1000, 0x1), nullptr);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x2), nullptr);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x3), nullptr);
+}
+
+TEST(PageWalkCacheTest, LookupUpdatesLRU)
+{
+    PageWalkCache cache({2});
+    cache.insert(0, 0x1000, 0x1, 0x5000, 0);
+    cache.insert(0, 0x1000, 0x2, 0x6000, 0);
+
+    // Hitting on the oldest entry makes the other one the victim.
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x1), nullptr);
+    cache.insert(0, 0x1000, 0x3, 0x7000, 0);
+
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x1), nullptr);
+    EXPECT_EQ(cache.lookup(0, 0x1000, 0x2), nullptr);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x3), nullptr);
+}
+
+TEST(PageWalkCacheTest, LevelsReplacedIndependently)
+{
+    PageWalkCache cache({1, 1});
+    cache.insert(0, 0x1000, 0x1, 0x5000, 0);
+    cache.insert(1, 0x1000, 0x2, 0x6000, 0);
+    cache.insert(1, 0x1000, 0x3, 0x7000, 0);
+
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x1), nullptr);
+    EXPECT_EQ(cache.lookup(1, 0x1000, 0x2), nullptr);
+    EXPECT_NE(cache.lookup(1, 0x1000, 0x3), nullptr);
+}
+
+TEST(PageWalkCacheTest, Flush)
+{
+    PageWalkCache cache({2, 2});
+    cache.insert(0, 0x1000, 0x1, 0x5000, 0);
+    cache.insert(1, 0x1000, 0x2, 0x6000, 0);
+    cache.flush();
+
+    EXPECT_EQ(cache.lookup(0, 0x1000, 0x1), nullptr);
+    EXPECT_EQ(cache.lookup(1, 0x1000, 0x2), nullptr);
+
+    // Flushed entries are reused before any valid one is replaced.
+    cache.insert(0, 0x1000, 0x3, 0x7000, 0);
+    cache.insert(0, 0x1000, 0x4, 0x8000, 0);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x3), nullptr);
+    EXPECT_NE(cache.lookup(0, 0x1000, 0x4), nullptr);
+}
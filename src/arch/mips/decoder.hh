@@ -54,7 +54,8 @@ class Decoder : public InstDecoder
     uint32_t machInst;
 
   public:
-    Decoder(const MipsDecoderParams &p) : InstDecoder(p, &machInst)
+    Decoder(const MipsDecoderParams &p)
+        : InstDecoder(p, &machInst), decodeCache(eventQueue())
     {}
 
     //Use this to give data to the decoder. This should be used
@@ -68,7 +69,7 @@ class Decoder : public InstDecoder
 
   protected:
     /// A cache of decoded instruction objects.
-    static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
+    GenericISA::BasicDecodeCache<Decoder, ExtMachInst> decodeCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
@@ -79,7 +80,7 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = decodeCache.decode(this, mach_inst, addr);
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
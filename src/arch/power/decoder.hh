@@ -52,7 +52,9 @@ class Decoder : public InstDecoder
     ExtMachInst emi;
 
   public:
-    Decoder(const PowerDecoderParams &p) : InstDecoder(p, &emi) {}
+    Decoder(const PowerDecoderParams &p)
+        : InstDecoder(p, &emi), decodeCache(eventQueue())
+    {}
 
     // Use this to give data to the predecoder. This should be used
     // when there is control flow.
@@ -65,7 +67,7 @@ class Decoder : public InstDecoder
 
   protected:
     /// A cache of decoded instruction objects.
-    static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
+    GenericISA::BasicDecodeCache<Decoder, ExtMachInst> decodeCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
 
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
@@ -76,7 +78,7 @@ class Decoder : public InstDecoder
     StaticInstPtr
     decode(ExtMachInst mach_inst, Addr addr)
     {
-        StaticInstPtr si = defaultCache.decode(this, mach_inst, addr);
+        StaticInstPtr si = decodeCache.decode(this, mach_inst, addr);
         DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
                 si->getName(), mach_inst);
         return si;
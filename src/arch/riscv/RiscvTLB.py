@@ -44,6 +44,11 @@ class RiscvPagetableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         4, "Number of outstanding walks that can be squashed per cycle"
     )
+    walk_cache_entries = VectorParam.Unsigned(
+        [],
+        "Number of non-leaf entries cached by the walker for each level "
+        "of the page table, root level first",
+    )
     # Grab the pma_checker from the MMU
     pma_checker = Param.BasePMAChecker(Parent.any, "PMA Checker")
     pmp = Param.PMP(Parent.any, "PMP")
@@ -55,6 +60,9 @@ class RiscvTLB(BaseTLB):
     cxx_header = "arch/riscv/tlb.hh"
 
     size = Param.Int(64, "TLB size")
+    assoc = Param.Int(0, "TLB associativity, 0 for a fully associative TLB")
+    # A TLB only used as the next_level of other TLBs, like a shared L2
+    # TLB, never walks the page table and should set this to NULL.
     walker = Param.RiscvPagetableWalker(
         RiscvPagetableWalker(), "page table walker"
     )
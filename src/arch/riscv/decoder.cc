@@ -95,11 +95,21 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
-    StaticInstPtr &si = instMap[mach_inst];
-    if (!si)
-        si = decodeInst(mach_inst);
+    // decodeInst may be overridden, and the dynamic type of this decoder
+    // isn't known until it is fully constructed.
+    if (!instMap) {
+        instMap = &InstMap::instance(eventQueue(),
+                                     (uint64_t)vlen << 32 | elen,
+                                     typeid(*this));
+    }
 
-    si->size(compressed(mach_inst) ? 2 : 4);
+    // The size only depends on the instruction, so it is set once when
+    // the shared StaticInst is created.
+    StaticInstPtr si = instMap->lookup(mach_inst, [this](ExtMachInst emi) {
+        StaticInstPtr si = decodeInst(emi);
+        si->size(compressed(emi) ? 2 : 4);
+        return si;
+    });
 
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
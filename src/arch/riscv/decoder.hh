@@ -51,7 +51,10 @@ namespace RiscvISA
 class Decoder : public InstDecoder
 {
   private:
-    decode_cache::InstMap<ExtMachInst> instMap;
+    /// Decoded instructions, shared with decoders on the same event queue
+    /// of the same type and vector configuration.
+    typedef GenericISA::SharedDecodeCache<Decoder, ExtMachInst> InstMap;
+    InstMap *instMap = nullptr;
     bool aligned;
     bool mid;
 
@@ -43,6 +43,7 @@
 #include "arch/riscv/page_size.hh"
 #include "arch/riscv/pma_checker.hh"
 #include "arch/riscv/tlb.hh"
+#include "base/logging.hh"
 
 #include "params/RiscvMMU.hh"
 
@@ -58,7 +59,13 @@ class MMU : public BaseMMU
 
     MMU(const RiscvMMUParams &p)
       : BaseMMU(p), pma(p.pma_checker)
-    {}
+    {
+        // Only a TLB used as the next level of another one can do
+        // without a walker.
+        fatal_if(!static_cast<TLB*>(itb)->getWalker() ||
+                 !static_cast<TLB*>(dtb)->getWalker(),
+                 "The instruction and data TLBs need a walker.\n");
+    }
 
     TranslationGenPtr
     translateFunctional(Addr start, Addr size, ThreadContext *tc,
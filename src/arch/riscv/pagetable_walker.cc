@@ -73,9 +73,8 @@ Fault
 Walker::start(ThreadContext * _tc, BaseMMU::Translation *_translation,
               const RequestPtr &_req, BaseMMU::Mode _mode)
 {
-    // TODO: in timing mode, instead of blocking when there are other
-    // outstanding requests, see if this request can be coalesced with
-    // another one (i.e. either coalesce or start walk)
+    // In timing mode a walk queued behind others is coalesced with them
+    // in startWalkWrapper if one of them filled the page it needs.
     WalkerState * newState = new WalkerState(this, _translation, _req);
     newState->initState(_tc, _mode, sys->isTimingMode());
     if (currStates.size()) {
@@ -226,8 +225,9 @@ Walker::startWalkWrapper()
                 std::make_shared<UnimpFault>("Squashed Inst"),
                 currState->req, currState->tc, currState->mode);
         } else {
-            tlb->translateTiming(currState->req, currState->tc,
-                                 currState->translation, currState->mode);
+            pagewalkerstats.coalescedWalks++;
+            tlb->translateCoalesced(currState->req, currState->tc,
+                                    currState->translation, currState->mode);
         }
 
         // delete the current request if there are no inflight packets.
@@ -439,6 +439,14 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
                     Addr idx = (entry.vaddr >> shift) & LEVEL_MASK;
                     nextRead = (pte.ppn << PageShift) + (idx * sizeof(pte));
                     nextState = Translate;
+                    if (!functional) {
+                        // Entry of the table one level up, which is
+                        // indexed by the address bits above this one's.
+                        walker->walkCache.insert(1 - level,
+                                satp.ppn << PageShift,
+                                entry.vaddr >> (shift + LEVEL_BITS),
+                                pte.ppn << PageShift, 0);
+                    }
                 }
             }
         }
@@ -509,6 +517,8 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     Addr idx = (vaddr >> shift) & LEVEL_MASK;
     Addr topAddr = (satp.ppn << PageShift) + (idx * sizeof(PTESv39));
     level = 2;
+    if (!functional)
+        topAddr = lookupWalkCache(vaddr, topAddr);
 
     DPRINTF(PageTableWalker, "Performing table walk for address %#x\n", vaddr);
     DPRINTF(PageTableWalker, "Loading level%d PTE from %#x\n", level, topAddr);
@@ -526,6 +536,34 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     read->allocate();
 }
 
+Addr
+Walker::WalkerState::lookupWalkCache(Addr vaddr, Addr top_addr)
+{
+    if (!walker->walkCache.enabled())
+        return top_addr;
+
+    // Resume the walk from the deepest cached level. Cache level n holds
+    // entries of the tables at page table level 2 - n, which point to the
+    // tables at level 1 - n.
+    Addr root = satp.ppn << PageShift;
+    for (int cached_level = 1; cached_level >= 0; cached_level--) {
+        int next_level = 1 - cached_level;
+        Addr shift = PageShift + LEVEL_BITS * next_level;
+        const PageWalkCache::Entry *cached = walker->walkCache.lookup(
+                cached_level, root, vaddr >> (shift + LEVEL_BITS));
+        if (cached) {
+            walker->pagewalkerstats.walkCacheHits++;
+            level = next_level;
+            Addr idx = (vaddr >> shift) & LEVEL_MASK;
+            DPRINTF(PageTableWalker, "Walk cache hit, resuming at level%d\n",
+                    level);
+            return cached->table + idx * sizeof(PTESv39);
+        }
+    }
+    walker->pagewalkerstats.walkCacheMisses++;
+    return top_addr;
+}
+
 bool
 Walker::WalkerState::recvPacket(PacketPtr pkt)
 {
@@ -681,7 +719,13 @@ Walker::PagewalkerStats::PagewalkerStats(statistics::Group *parent)
     ADD_STAT(num_4kb_walks, statistics::units::Count::get(),
              "Completed page walks with 4KB pages"),
     ADD_STAT(num_2mb_walks, statistics::units::Count::get(),
-             "Completed page walks with 2MB pages")
+             "Completed page walks with 2MB pages"),
+    ADD_STAT(walkCacheHits, statistics::units::Count::get(),
+             "Walks resumed from a page walk cache entry"),
+    ADD_STAT(walkCacheMisses, statistics::units::Count::get(),
+             "Walks which missed in all levels of the page walk cache"),
+    ADD_STAT(coalescedWalks, statistics::units::Count::get(),
+             "Walks satisfied by an entry filled by an earlier walk")
 {
 }
 
@@ -42,6 +42,7 @@
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/page_walk_cache.hh"
 #include "arch/riscv/pagetable.hh"
 #include "arch/riscv/pma_checker.hh"
 #include "arch/riscv/pmp.hh"
@@ -145,6 +146,7 @@ namespace RiscvISA
             void sendPackets();
             void endWalk();
             Fault pageFault(bool present);
+            Addr lookupWalkCache(Addr vaddr, Addr top_addr);
         };
 
         friend class WalkerState;
@@ -181,6 +183,9 @@ namespace RiscvISA
         // The number of outstanding walks that can be squashed per cycle.
         unsigned numSquashable;
 
+        // Caches the non-leaf entries of the page table, root level first.
+        PageWalkCache walkCache;
+
         // Wrapper for checking for squashes before starting a translation.
         void startWalkWrapper();
 
@@ -200,6 +205,9 @@ namespace RiscvISA
 
             statistics::Scalar num_4kb_walks;
             statistics::Scalar num_2mb_walks;
+            statistics::Scalar walkCacheHits;
+            statistics::Scalar walkCacheMisses;
+            statistics::Scalar coalescedWalks;
 
         } pagewalkerstats;
 
@@ -211,6 +219,8 @@ namespace RiscvISA
             tlb = _tlb;
         }
 
+        void flushWalkCache() { walkCache.flush(); }
+
         using Params = RiscvPagetableWalkerParams;
 
         Walker(const Params &params) :
@@ -220,6 +230,7 @@ namespace RiscvISA
             pmp(params.pmp),
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
+            walkCache(params.walk_cache_entries),
             startWalkWrapperEvent([this]{ startWalkWrapper(); }, name()),
             pagewalkerstats(this)
         {
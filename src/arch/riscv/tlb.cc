@@ -43,6 +43,7 @@
 #include "arch/riscv/pra_constants.hh"
 #include "arch/riscv/utility.hh"
 #include "base/inifile.hh"
+#include "base/intmath.hh"
 #include "base/str.hh"
 #include "base/trace.hh"
 #include "cpu/thread_context.hh"
@@ -77,17 +78,24 @@ buildKey(Addr vpn, uint16_t asid)
 }
 
 TLB::TLB(const Params &p) :
-    BaseTLB(p), size(p.size), tlb(size),
-    lruSeq(0), stats(this), pma(p.pma_checker),
-    pmp(p.pmp)
+    BaseTLB(p), size(p.size), assoc(p.assoc ? p.assoc : p.size),
+    numSets(size / assoc), tlb(size), numValid(0), lruSeq(0),
+    nextTlb(dynamic_cast<TLB *>(p.next_level)), stats(this),
+    pma(p.pma_checker), pmp(p.pmp)
 {
-    for (size_t x = 0; x < size; x++) {
+    fatal_if(size % assoc, "TLB size %d is not a multiple of its "
+             "associativity %d.\n", size, assoc);
+    fatal_if(!isPowerOf2(numSets), "TLB set count %d is not a power of 2.\n",
+             numSets);
+    fatal_if(p.next_level && !nextTlb,
+             "The next level of a RiscvTLB must also be a RiscvTLB.\n");
+
+    for (size_t x = 0; x < size; x++)
         tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
-    }
 
     walker = p.walker;
-    walker->setTLB(this);
+    if (walker)
+        walker->setTLB(this);
 }
 
 Walker *
@@ -96,19 +104,26 @@ TLB::getWalker()
     return walker;
 }
 
-void
-TLB::evictLRU()
+size_t
+TLB::allocEntry(Addr key, unsigned log_bytes)
 {
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    size_t lru = 0;
-    for (size_t i = 1; i < size; i++) {
+    // Large pages are indexed by their own page number so that all the
+    // entries of a set cover distinct regions.
+    size_t set = (key >> (log_bytes - PageShift)) & (numSets - 1);
+    size_t first = set * assoc;
+
+    // Use a free way if there is one, otherwise find the entry with the
+    // lowest (and hence least recently updated) sequence number.
+    size_t lru = first;
+    for (size_t i = first; i < first + assoc; i++) {
+        if (!tlb[i].trieHandle)
+            return i;
         if (tlb[i].lruSeq < tlb[lru].lruSeq)
             lru = i;
     }
 
     remove(lru);
+    return lru;
 }
 
 TlbEntry *
@@ -156,6 +171,11 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
         vpn, entry.asid, buildKey(vpn, entry.asid), entry.vaddr, entry.paddr,
         entry.pte, entry.size());
 
+    // Entries walked by this TLB are also kept in the second level, which
+    // services misses of all the first level TLBs.
+    if (nextTlb)
+        nextTlb->insert(vpn, entry);
+
     // If somebody beat us to it, just use that existing entry.
     TlbEntry *newEntry = lookup(vpn, entry.asid, BaseMMU::Read, true);
     if (newEntry) {
@@ -167,18 +187,14 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
         return newEntry;
     }
 
-    if (freeList.empty())
-        evictLRU();
-
-    newEntry = freeList.front();
-    freeList.pop_front();
-
     Addr key = buildKey(vpn, entry.asid);
+    newEntry = &tlb[allocEntry(key, entry.logBytes)];
     *newEntry = entry;
     newEntry->lruSeq = nextSeq();
     newEntry->trieHandle = trie.insert(
         key, TlbEntryTrie::MaxBits - entry.logBytes + PageShift, newEntry
     );
+    numValid++;
     return newEntry;
 }
 
@@ -199,6 +215,13 @@ TLB::demapPage(Addr vaddr, uint64_t asid)
     asid &= 0xFFFF;
 
     DPRINTF(TLB, "flush(vaddr=%#x, asid=%#x)\n", vaddr, asid);
+    // SFENCE.VMA orders all the implicit page table reads as well, so the
+    // non-leaf entries cached by the walker are dropped in every case.
+    if (walker)
+        walker->flushWalkCache();
+    if (nextTlb)
+        nextTlb->demapPage(vaddr, asid);
+
     if (vaddr == 0 && asid == 0) {
         DPRINTF(TLB, "Flushing all TLB entries\n");
         flushAll();
@@ -232,6 +255,8 @@ TLB::flushAll()
         if (tlb[i].trieHandle)
             remove(i);
     }
+    if (walker)
+        walker->flushWalkCache();
 }
 
 void
@@ -244,7 +269,7 @@ TLB::remove(size_t idx)
     assert(tlb[idx].trieHandle);
     trie.remove(tlb[idx].trieHandle);
     tlb[idx].trieHandle = NULL;
-    freeList.push_back(&tlb[idx]);
+    numValid--;
 }
 
 Fault
@@ -306,7 +331,7 @@ TLB::translateWithTLB(Addr vaddr, uint16_t asid, Addr xmode,
 Fault
 TLB::doTranslate(const RequestPtr &req, ThreadContext *tc,
                  BaseMMU::Translation *translation, BaseMMU::Mode mode,
-                 bool &delayed)
+                 bool &delayed, bool hidden)
 {
     delayed = false;
 
@@ -314,7 +339,16 @@ TLB::doTranslate(const RequestPtr &req, ThreadContext *tc,
     SATP satp = tc->readMiscReg(MISCREG_SATP);
 
     Addr vpn = getVPNFromVAddr(vaddr, satp.mode);
-    TlbEntry *e = lookup(vpn, satp.asid, mode, false);
+    TlbEntry *e = lookup(vpn, satp.asid, mode, hidden);
+    if (!e && nextTlb) {
+        e = nextTlb->lookup(vpn, satp.asid, mode, hidden);
+        if (e) {
+            DPRINTF(TLB, "Miss was serviced by the next level\n");
+            if (!hidden)
+                stats.nextLevelHits++;
+            e = insert(vpn, *e);
+        }
+    }
     if (!e) {
         Fault fault = walker->start(tc, translation, req, mode);
         if (translation != nullptr || fault != NoFault) {
@@ -365,7 +399,7 @@ TLB::getMemPriv(ThreadContext *tc, BaseMMU::Mode mode)
 Fault
 TLB::translate(const RequestPtr &req, ThreadContext *tc,
                BaseMMU::Translation *translation, BaseMMU::Mode mode,
-               bool &delayed)
+               bool &delayed, bool hidden)
 {
     delayed = false;
 
@@ -389,7 +423,8 @@ TLB::translate(const RequestPtr &req, ThreadContext *tc,
                  */
                 req->setPaddr(req->getVaddr());
             } else {
-                fault = doTranslate(req, tc, translation, mode, delayed);
+                fault = doTranslate(req, tc, translation, mode, delayed,
+                                    hidden);
             }
         }
 
@@ -437,10 +472,25 @@ TLB::translateAtomic(const RequestPtr &req, ThreadContext *tc,
 void
 TLB::translateTiming(const RequestPtr &req, ThreadContext *tc,
                      BaseMMU::Translation *translation, BaseMMU::Mode mode)
+{
+    translateTiming(req, tc, translation, mode, false);
+}
+
+void
+TLB::translateCoalesced(const RequestPtr &req, ThreadContext *tc,
+                        BaseMMU::Translation *translation, BaseMMU::Mode mode)
+{
+    translateTiming(req, tc, translation, mode, true);
+}
+
+void
+TLB::translateTiming(const RequestPtr &req, ThreadContext *tc,
+                     BaseMMU::Translation *translation, BaseMMU::Mode mode,
+                     bool hidden)
 {
     bool delayed;
     assert(translation);
-    Fault fault = translate(req, tc, translation, mode, delayed);
+    Fault fault = translate(req, tc, translation, mode, delayed, hidden);
     if (!delayed)
         translation->finish(fault, req, tc, mode);
     else
@@ -507,7 +557,7 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = numValid;
     SERIALIZE_SCALAR(_size);
     SERIALIZE_SCALAR(lruSeq);
 
@@ -531,15 +581,17 @@ TLB::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(lruSeq);
 
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
-
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
+        TlbEntry restored;
+        restored.unserializeSection(cp, csprintf("Entry%d", x));
         // TODO: When supporting other addressing modes fix this
-        Addr vpn = getVPNFromVAddr(newEntry->vaddr, AddrXlateMode::SV39);
-        Addr key = buildKey(vpn, newEntry->asid);
+        Addr vpn = getVPNFromVAddr(restored.vaddr, AddrXlateMode::SV39);
+        Addr key = buildKey(vpn, restored.asid);
+
+        TlbEntry *newEntry = &tlb[allocEntry(key, restored.logBytes)];
+        *newEntry = restored;
         newEntry->trieHandle = trie.insert(key,
             TlbEntryTrie::MaxBits - newEntry->logBytes + PageShift, newEntry);
+        numValid++;
     }
 }
 
@@ -551,6 +603,8 @@ TLB::TlbStats::TlbStats(statistics::Group *parent)
     ADD_STAT(writeHits, statistics::units::Count::get(), "write hits"),
     ADD_STAT(writeMisses, statistics::units::Count::get(), "write misses"),
     ADD_STAT(writeAccesses, statistics::units::Count::get(), "write accesses"),
+    ADD_STAT(nextLevelHits, statistics::units::Count::get(),
+             "misses serviced by the next level TLB"),
     ADD_STAT(hits, statistics::units::Count::get(),
              "Total TLB (read and write) hits", readHits + writeHits),
     ADD_STAT(misses, statistics::units::Count::get(),
@@ -564,7 +618,7 @@ TLB::TlbStats::TlbStats(statistics::Group *parent)
 Port *
 TLB::getTableWalkerPort()
 {
-    return &walker->getPort("port");
+    return walker ? &walker->getPort("port") : nullptr;
 }
 
 } // namespace gem5
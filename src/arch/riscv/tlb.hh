@@ -62,11 +62,16 @@ class TLB : public BaseTLB
 
   protected:
     size_t size;
-    std::vector<TlbEntry> tlb;  // our TLB
+    size_t assoc;               // ways per set
+    size_t numSets;
+    std::vector<TlbEntry> tlb;  // our TLB, one set after the other
     TlbEntryTrie trie;          // for quick access
-    EntryList freeList;         // free entries
+    size_t numValid;            // valid entries
     uint64_t lruSeq;
 
+    // The unified second level TLB filled alongside this one.
+    TLB *nextTlb;
+
     Walker *walker;
 
     struct TlbStats : public statistics::Group
@@ -79,6 +84,7 @@ class TLB : public BaseTLB
         statistics::Scalar writeHits;
         statistics::Scalar writeMisses;
         statistics::Scalar writeAccesses;
+        statistics::Scalar nextLevelHits;
 
         statistics::Formula hits;
         statistics::Formula misses;
@@ -139,6 +145,15 @@ class TLB : public BaseTLB
     void translateTiming(const RequestPtr &req, ThreadContext *tc,
                          BaseMMU::Translation *translation,
                          BaseMMU::Mode mode) override;
+
+    /**
+     * Finish a timing translation whose walk was coalesced with an
+     * earlier walk that filled the page. The translation was counted when
+     * it missed, so the lookup completing it is not counted again.
+     */
+    void translateCoalesced(const RequestPtr &req, ThreadContext *tc,
+                            BaseMMU::Translation *translation,
+                            BaseMMU::Mode mode);
     Fault translateFunctional(const RequestPtr &req, ThreadContext *tc,
                               BaseMMU::Mode mode) override;
     Fault finalizePhysical(const RequestPtr &req, ThreadContext *tc,
@@ -159,15 +174,25 @@ class TLB : public BaseTLB
   private:
     uint64_t nextSeq() { return ++lruSeq; }
 
-    void evictLRU();
+    /**
+     * Find the slot a new entry is stored in, evicting the least recently
+     * used entry of the set selected by its key if the set is full.
+     */
+    size_t allocEntry(Addr key, unsigned log_bytes);
     void remove(size_t idx);
 
+    /**
+     * @param hidden If the lookups should be hidden from the statistics.
+     */
     Fault translate(const RequestPtr &req, ThreadContext *tc,
                     BaseMMU::Translation *translation, BaseMMU::Mode mode,
-                    bool &delayed);
+                    bool &delayed, bool hidden = false);
     Fault doTranslate(const RequestPtr &req, ThreadContext *tc,
                       BaseMMU::Translation *translation, BaseMMU::Mode mode,
-                      bool &delayed);
+                      bool &delayed, bool hidden);
+    void translateTiming(const RequestPtr &req, ThreadContext *tc,
+                         BaseMMU::Translation *translation,
+                         BaseMMU::Mode mode, bool hidden);
 };
 
 } // namespace RiscvISA
@@ -49,6 +49,17 @@ class X86PagetableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         4, "Number of outstanding walks that can be squashed per cycle"
     )
+    pml4_cache_entries = Param.Unsigned(
+        0, "Number of PML4 entries cached by the walker (0 to disable)"
+    )
+    pdp_cache_entries = Param.Unsigned(
+        0, "Number of PDP entries cached by the walker (0 to disable)"
+    )
+    pde_cache_entries = Param.Unsigned(
+        0,
+        "Number of page directory entries cached by the walker "
+        "(0 to disable)",
+    )
 
 
 class X86TLB(BaseTLB):
@@ -57,7 +68,12 @@ class X86TLB(BaseTLB):
     cxx_header = "arch/x86/tlb.hh"
 
     size = Param.Unsigned(64, "TLB size")
+    assoc = Param.Unsigned(
+        0, "TLB associativity, 0 for a fully associative TLB"
+    )
     system = Param.System(Parent.any, "system object")
+    # A TLB only used as the next_level of other TLBs, like a shared L2
+    # TLB, never walks the page table and should set this to NULL.
     walker = Param.X86PagetableWalker(
         X86PagetableWalker(), "page table walker"
     )
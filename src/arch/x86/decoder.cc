@@ -672,22 +672,17 @@ Decoder::doImmediateState()
 }
 
 Decoder::InstBytes Decoder::dummy;
-Decoder::InstCacheMap Decoder::instCacheMap;
 
 StaticInstPtr
 Decoder::decode(ExtMachInst mach_inst, Addr addr)
 {
-    StaticInstPtr si;
-
-    auto iter = instMap->find(mach_inst);
-    if (iter != instMap->end()) {
-        si = iter->second;
-    } else {
-        si = decodeInst(mach_inst);
-        (*instMap)[mach_inst] = si;
-    }
-
-    si->size(basePC + offset - origPC);
+    // The size is part of the key, so it is set once when the shared
+    // StaticInst is created.
+    StaticInstPtr si = instMap->lookup(mach_inst, [this](ExtMachInst emi) {
+        StaticInstPtr si = decodeInst(emi);
+        si->size(emi.instSize);
+        return si;
+    });
 
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
@@ -734,6 +729,7 @@ Decoder::decode(PCStateBase &next_pc)
         start = 0;
     }
 
+    emi.instSize = basePC + offset - origPC;
     return decode(emi, origPC);
 }
 
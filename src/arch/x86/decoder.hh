@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
 #include "arch/x86/microcode_rom.hh"
 #include "arch/x86/regs/misc.hh"
@@ -241,10 +242,10 @@ class Decoder : public InstDecoder
     typedef std::unordered_map<CacheKey, DecodePages *> AddrCacheMap;
     AddrCacheMap addrCacheMap;
 
-    decode_cache::InstMap<ExtMachInst> *instMap = nullptr;
-    typedef std::unordered_map<
-            CacheKey, decode_cache::InstMap<ExtMachInst> *> InstCacheMap;
-    static InstCacheMap instCacheMap;
+    /// Decoded instructions of the current mode, shared with all other
+    /// decoders on the same event queue in the same mode.
+    typedef GenericISA::SharedDecodeCache<Decoder, ExtMachInst> InstMap;
+    InstMap *instMap = nullptr;
 
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
@@ -287,13 +288,7 @@ class Decoder : public InstDecoder
             addrCacheMap[m5Reg] = decodePages;
         }
 
-        InstCacheMap::iterator imIter = instCacheMap.find(m5Reg);
-        if (imIter != instCacheMap.end()) {
-            instMap = imIter->second;
-        } else {
-            instMap = new decode_cache::InstMap<ExtMachInst>;
-            instCacheMap[m5Reg] = instMap;
-        }
+        instMap = &InstMap::instance(eventQueue(), m5Reg);
     }
 
     void
@@ -40,7 +40,11 @@
 
 #include "arch/generic/mmu.hh"
 #include "arch/x86/page_size.hh"
+#include "arch/x86/regs/misc.hh"
 #include "arch/x86/tlb.hh"
+#include "arch/x86/types.hh"
+#include "base/logging.hh"
+#include "cpu/thread_context.hh"
 
 #include "params/X86MMU.hh"
 
@@ -54,15 +58,40 @@ class MMU : public BaseMMU
   public:
     MMU(const X86MMUParams &p)
       : BaseMMU(p)
-    {}
+    {
+        // Only a TLB used as the next level of another one can do
+        // without a walker.
+        fatal_if(!static_cast<TLB*>(itb)->getWalker() ||
+                 !static_cast<TLB*>(dtb)->getWalker(),
+                 "The instruction and data TLBs need a walker.\n");
+    }
 
     void
     flushNonGlobal()
     {
+        bumpTranslationEpoch();
         static_cast<TLB*>(itb)->flushNonGlobal();
         static_cast<TLB*>(dtb)->flushNonGlobal();
     }
 
+    bool
+    cacheableTranslations(ThreadContext *tc) const override
+    {
+        return cacheableTranslations(
+                HandyM5Reg(tc->readMiscRegNoEffect(misc_reg::M5Reg)));
+    }
+
+    /**
+     * Whether translations may be cached outside of the MMU in the mode
+     * an M5Reg describes.
+     */
+    static bool
+    cacheableTranslations(HandyM5Reg m5reg)
+    {
+        // Outside of long mode, segment limits are checked on every access.
+        return !m5reg.prot || m5reg.mode == LongMode;
+    }
+
     Walker*
     getDataWalker()
     {
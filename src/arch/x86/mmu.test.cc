@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011 Google
+ * Copyright (c) 2026 The Regents of the University of California
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -26,15 +26,44 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "arch/power/decoder.hh"
+#include <gtest/gtest.h>
 
-namespace gem5
+#include "arch/x86/mmu.hh"
+
+using namespace gem5;
+using namespace X86ISA;
+
+namespace
+{
+
+HandyM5Reg
+makeM5Reg(bool prot, X86Mode mode)
 {
+    HandyM5Reg m5reg = 0;
+    m5reg.prot = prot;
+    m5reg.mode = mode;
+    return m5reg;
+}
 
-namespace PowerISA
+} // anonymous namespace
+
+/** Long mode has no segment limits to check on each access. */
+TEST(X86MMUTest, CacheableInLongMode)
 {
+    EXPECT_TRUE(MMU::cacheableTranslations(makeM5Reg(true, LongMode)));
+}
 
-GenericISA::BasicDecodeCache<Decoder, ExtMachInst> Decoder::defaultCache;
+/** Real mode translations are not checked against segment limits. */
+TEST(X86MMUTest, CacheableInRealMode)
+{
+    EXPECT_TRUE(MMU::cacheableTranslations(makeM5Reg(false, LegacyMode)));
+}
 
-} // namespace PowerISA
-} // namespace gem5
+/**
+ * Protected mode outside of long mode checks segment limits on every
+ * access, so the translations are never cached.
+ */
+TEST(X86MMUTest, NotCacheableInLegacyProtectedMode)
+{
+    EXPECT_FALSE(MMU::cacheableTranslations(makeM5Reg(true, LegacyMode)));
+}
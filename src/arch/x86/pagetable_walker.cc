@@ -56,6 +56,7 @@
 #include "arch/x86/regs/misc.hh"
 #include "arch/x86/tlb.hh"
 #include "base/bitfield.hh"
+#include "base/bitunion.hh"
 #include "base/trie.hh"
 #include "cpu/base.hh"
 #include "cpu/thread_context.hh"
@@ -72,9 +73,8 @@ Fault
 Walker::start(ThreadContext * _tc, BaseMMU::Translation *_translation,
               const RequestPtr &_req, BaseMMU::Mode _mode)
 {
-    // TODO: in timing mode, instead of blocking when there are other
-    // outstanding requests, see if this request can be coalesced with
-    // another one (i.e. either coalesce or start walk)
+    // In timing mode a walk queued behind others is coalesced with them
+    // in startWalkWrapper if one of them filled the page it needs.
     WalkerState * newState = new WalkerState(this, _translation, _req);
     newState->initState(_tc, _mode, sys->isTimingMode());
     if (currStates.size()) {
@@ -194,18 +194,31 @@ Walker::startWalkWrapper()
 {
     unsigned num_squashed = 0;
     WalkerState *currState = currStates.front();
+
+    // check if an earlier walk filled the page so this one can be skipped
+    TlbEntry *e = tlb->probe(currState->tc, currState->req->getVaddr());
     while ((num_squashed < numSquashable) && currState &&
-        currState->translation->squashed()) {
+        (currState->translation->squashed() ||
+         (e && !currState->wasStarted()))) {
         currStates.pop_front();
         num_squashed++;
 
-        DPRINTF(PageTableWalker, "Squashing table walk for address %#x\n",
-            currState->req->getVaddr());
-
         // finish the translation which will delete the translation object
-        currState->translation->finish(
-            std::make_shared<UnimpFault>("Squashed Inst"),
-            currState->req, currState->tc, currState->mode);
+        if (currState->translation->squashed()) {
+            DPRINTF(PageTableWalker,
+                    "Squashing table walk for address %#x\n",
+                    currState->req->getVaddr());
+            currState->translation->finish(
+                std::make_shared<UnimpFault>("Squashed Inst"),
+                currState->req, currState->tc, currState->mode);
+        } else {
+            DPRINTF(PageTableWalker,
+                    "Coalescing table walk for address %#x\n",
+                    currState->req->getVaddr());
+            stats.coalescedWalks++;
+            tlb->translateCoalesced(currState->req, currState->tc,
+                                    currState->translation, currState->mode);
+        }
 
         // delete the current request if there are no inflight packets.
         // if there is something in flight, delete when the packets are
@@ -217,13 +230,19 @@ Walker::startWalkWrapper()
         }
 
         // check the next translation request, if it exists
-        if (currStates.size())
+        if (currStates.size()) {
             currState = currStates.front();
-        else
+            e = tlb->probe(currState->tc, currState->req->getVaddr());
+        } else {
             currState = NULL;
+        }
+    }
+    if (currState && !currState->wasStarted()) {
+        if (!e)
+            currState->startWalk();
+        else
+            schedule(startWalkWrapperEvent, clockEdge(Cycles(1)));
     }
-    if (currState && !currState->wasStarted())
-        currState->startWalk();
 }
 
 Fault
@@ -311,6 +330,8 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
             break;
         }
         entry.noExec = pte.nx;
+        sawNX = pte.nx;
+        fillWalkCache(0, mbits(pte, 51, 12), uncacheable);
         nextState = LongPDP;
         break;
       case LongPDP:
@@ -325,6 +346,8 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
             fault = pageFault(pte.p);
             break;
         }
+        sawNX = sawNX || pte.nx;
+        fillWalkCache(1, mbits(pte, 51, 12), uncacheable);
         nextState = LongPD;
         break;
       case LongPD:
@@ -342,6 +365,8 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
             // 4 KB page
             entry.logBytes = 12;
             nextRead = mbits(pte, 51, 12) + vaddr.longl1 * dataSize;
+            sawNX = sawNX || pte.nx;
+            fillWalkCache(2, mbits(pte, 51, 12), uncacheable);
             nextState = LongPTE;
             break;
         } else {
@@ -565,11 +590,19 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     Efer efer = tc->readMiscRegNoEffect(misc_reg::Efer);
     dataSize = 8;
     Addr topAddr;
+    // PCD can't be used if CR4.PCIDE=1 [sec 2.5
+    // of Intel's Software Developer's manual]
+    bool uncacheable = !cr4.pcide && cr3.pcd;
+    walkRoot = 0;
+    sawNX = false;
     if (efer.lma) {
         // Do long mode.
         state = LongPML4;
-        topAddr = (cr3.longPdtb << 12) + addr.longl4 * dataSize;
+        walkRoot = cr3.longPdtb << 12;
+        topAddr = walkRoot + addr.longl4 * dataSize;
         enableNX = efer.nxe;
+        entry.vaddr = vaddr;
+        lookupWalkCache(topAddr, uncacheable);
     } else {
         // We're in some flavor of legacy mode.
         if (cr4.pae) {
@@ -595,10 +628,7 @@ Walker::WalkerState::setupWalk(Addr vaddr)
     entry.vaddr = vaddr;
 
     Request::Flags flags = Request::PHYSICAL;
-
-    // PCD can't be used if CR4.PCIDE=1 [sec 2.5
-    // of Intel's Software Developer's manual]
-    if (!cr4.pcide && cr3.pcd)
+    if (uncacheable)
         flags.set(Request::UNCACHEABLE);
 
     RequestPtr request = std::make_shared<Request>(
@@ -738,6 +768,90 @@ Walker::WalkerState::retry()
     sendPackets();
 }
 
+namespace
+{
+
+// State accumulated from the upper levels of a long mode walk, kept with
+// each walk cache entry so that a walk can resume below it.
+BitUnion64(WalkCacheAttrs)
+    Bitfield<0> writable;
+    Bitfield<1> user;
+    Bitfield<2> noExec;
+    Bitfield<3> sawNX;
+    Bitfield<4> uncacheable;
+EndBitUnion(WalkCacheAttrs)
+
+// The virtual address bits translated down to the PML4, PDP and PDE.
+const unsigned walkCacheTagShift[] = { 39, 30, 21 };
+
+} // anonymous namespace
+
+void
+Walker::WalkerState::lookupWalkCache(Addr &top_addr, bool &uncacheable)
+{
+    if (functional || !walker->walkCache.enabled())
+        return;
+
+    // Resume the walk from the deepest cached level, so that the fewest
+    // entries have to be read from memory.
+    static const State resumeState[] = { LongPDP, LongPD, LongPTE };
+    VAddr addr = entry.vaddr;
+    const Addr resumeIndex[] = { addr.longl3, addr.longl2, addr.longl1 };
+    for (int level = 2; level >= 0; level--) {
+        const PageWalkCache::Entry *cached = walker->walkCache.lookup(
+                level, walkRoot, entry.vaddr >> walkCacheTagShift[level]);
+        if (!cached)
+            continue;
+
+        WalkCacheAttrs attrs = cached->attrs;
+        // Let a full walk find the entry raising the fault.
+        if (attrs.sawNX && enableNX && mode == BaseMMU::Execute)
+            break;
+
+        DPRINTF(PageTableWalker, "Walk cache hit at level %d, resuming "
+                "from table %#x.\n", level, cached->table);
+        walker->stats.walkCacheHits++;
+        entry.writable = attrs.writable;
+        entry.user = attrs.user;
+        entry.noExec = attrs.noExec;
+        entry.logBytes = 12;
+        sawNX = attrs.sawNX;
+        uncacheable = attrs.uncacheable;
+        state = resumeState[level];
+        top_addr = cached->table + resumeIndex[level] * dataSize;
+        return;
+    }
+    walker->stats.walkCacheMisses++;
+}
+
+void
+Walker::WalkerState::fillWalkCache(unsigned level, Addr table,
+                                   bool uncacheable)
+{
+    if (functional)
+        return;
+
+    WalkCacheAttrs attrs = 0;
+    attrs.writable = entry.writable;
+    attrs.user = entry.user;
+    attrs.noExec = entry.noExec;
+    attrs.sawNX = sawNX;
+    attrs.uncacheable = uncacheable;
+    walker->walkCache.insert(level, walkRoot,
+            entry.vaddr >> walkCacheTagShift[level], table, attrs);
+}
+
+Walker::WalkerStats::WalkerStats(statistics::Group *parent)
+  : statistics::Group(parent),
+    ADD_STAT(walkCacheHits, statistics::units::Count::get(),
+             "Walks resumed from a paging-structure cache entry"),
+    ADD_STAT(walkCacheMisses, statistics::units::Count::get(),
+             "Walks which missed in all the paging-structure caches"),
+    ADD_STAT(coalescedWalks, statistics::units::Count::get(),
+             "Walks satisfied by an entry filled by an earlier walk")
+{
+}
+
 Fault
 Walker::WalkerState::pageFault(bool present)
 {
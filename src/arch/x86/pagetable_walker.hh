@@ -41,8 +41,10 @@
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/page_walk_cache.hh"
 #include "arch/x86/pagetable.hh"
 #include "arch/x86/tlb.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
 #include "params/X86PagetableWalker.hh"
@@ -115,6 +117,11 @@ namespace X86ISA
             bool retrying;
             bool started;
             bool squashed;
+            // Root of the long mode page table being walked, used to tag
+            // the walk cache entries filled by this walk.
+            Addr walkRoot;
+            // Whether any upper level entry had its NX bit set.
+            bool sawNX;
           public:
             WalkerState(Walker * _walker, BaseMMU::Translation *_translation,
                         const RequestPtr &_req, bool _isFunctional = false) :
@@ -122,7 +129,8 @@ namespace X86ISA
                 nextState(Ready), inflight(0),
                 translation(_translation),
                 functional(_isFunctional), timing(false),
-                retrying(false), started(false), squashed(false)
+                retrying(false), started(false), squashed(false),
+                walkRoot(0), sawNX(false)
             {
             }
             void initState(ThreadContext * _tc, BaseMMU::Mode _mode,
@@ -144,6 +152,8 @@ namespace X86ISA
             void sendPackets();
             void endWalk();
             Fault pageFault(bool present);
+            void lookupWalkCache(Addr &top_addr, bool &uncacheable);
+            void fillWalkCache(unsigned level, Addr table, bool uncacheable);
         };
 
         friend class WalkerState;
@@ -178,6 +188,18 @@ namespace X86ISA
         // The number of outstanding walks that can be squashed per cycle.
         unsigned numSquashable;
 
+        // The PML4, PDP and PDE caches, in that order.
+        PageWalkCache walkCache;
+
+        struct WalkerStats : public statistics::Group
+        {
+            WalkerStats(statistics::Group *parent);
+
+            statistics::Scalar walkCacheHits;
+            statistics::Scalar walkCacheMisses;
+            statistics::Scalar coalescedWalks;
+        } stats;
+
         // Wrapper for checking for squashes before starting a translation.
         void startWalkWrapper();
 
@@ -198,6 +220,8 @@ namespace X86ISA
             tlb = _tlb;
         }
 
+        void flushWalkCache() { walkCache.flush(); }
+
         using Params = X86PagetableWalkerParams;
 
         Walker(const Params &params) :
@@ -205,6 +229,9 @@ namespace X86ISA
             funcState(this, NULL, NULL, true), tlb(NULL), sys(params.system),
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
+            walkCache({params.pml4_cache_entries, params.pdp_cache_entries,
+                       params.pde_cache_entries}),
+            stats(this),
             startWalkWrapperEvent([this]{ startWalkWrapper(); }, name())
         {
         }
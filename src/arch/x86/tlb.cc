@@ -47,6 +47,7 @@
 #include "arch/x86/regs/misc.hh"
 #include "arch/x86/regs/msr.hh"
 #include "arch/x86/x86_traits.hh"
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "cpu/thread_context.hh"
 #include "debug/TLB.hh"
@@ -64,36 +65,57 @@ namespace X86ISA {
 
 TLB::TLB(const Params &p)
     : BaseTLB(p), configAddress(0), size(p.size),
-      tlb(size), lruSeq(0), m5opRange(p.system->m5opRange()), stats(this)
+      assoc(p.assoc ? p.assoc : p.size), numSets(0), tlb(size), numValid(0),
+      nextTlb(dynamic_cast<TLB *>(p.next_level)), lruSeq(0),
+      m5opRange(p.system->m5opRange()), stats(this)
 {
     if (!size)
         fatal("TLBs must have a non-zero size.\n");
-
-    for (int x = 0; x < size; x++) {
+    fatal_if(size % assoc, "TLB size %d is not a multiple of its "
+             "associativity %d.\n", size, assoc);
+    numSets = size / assoc;
+    fatal_if(!isPowerOf2(numSets), "TLB set count %d is not a power of 2.\n",
+             numSets);
+    fatal_if(p.next_level && !nextTlb,
+             "The next level of an X86TLB must also be an X86TLB.\n");
+
+    for (int x = 0; x < size; x++)
         tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
-    }
 
     walker = p.walker;
-    walker->setTLB(this);
+    if (walker)
+        walker->setTLB(this);
 }
 
-void
-TLB::evictLRU()
+TlbEntry *
+TLB::allocEntry(Addr vpn, unsigned log_bytes)
 {
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    unsigned lru = 0;
-    for (unsigned i = 1; i < size; i++) {
-        if (tlb[i].lruSeq < tlb[lru].lruSeq)
-            lru = i;
+    // Large pages are indexed by their own page number so that all the
+    // entries of a set cover distinct regions.
+    unsigned set = (vpn >> log_bytes) & (numSets - 1);
+    TlbEntry *first = &tlb[set * assoc];
+
+    // Use a free way if there is one, otherwise find the entry with the
+    // lowest (and hence least recently updated) sequence number.
+    TlbEntry *lru = first;
+    for (TlbEntry *way = first; way != first + assoc; way++) {
+        if (!way->trieHandle)
+            return way;
+        if (way->lruSeq < lru->lruSeq)
+            lru = way;
     }
 
-    assert(tlb[lru].trieHandle);
-    trie.remove(tlb[lru].trieHandle);
-    tlb[lru].trieHandle = NULL;
-    freeList.push_back(&tlb[lru]);
+    remove(lru);
+    return lru;
+}
+
+void
+TLB::remove(TlbEntry *entry)
+{
+    assert(entry->trieHandle);
+    trie.remove(entry->trieHandle);
+    entry->trieHandle = NULL;
+    numValid--;
 }
 
 TlbEntry *
@@ -105,6 +127,11 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
     //virtual addresses
     vpn = concAddrPcid(vpn, pcid);
 
+    // Entries walked or found by this TLB are also kept in the second
+    // level, which services misses of all the first level TLBs.
+    if (nextTlb)
+        nextTlb->insert(vpn, entry, pcid);
+
     // If somebody beat us to it, just use that existing entry.
     TlbEntry *newEntry = trie.lookup(vpn);
     if (newEntry) {
@@ -112,11 +139,8 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
         return newEntry;
     }
 
-    if (freeList.empty())
-        evictLRU();
-
-    newEntry = freeList.front();
-    freeList.pop_front();
+    newEntry = allocEntry(vpn,
+            FullSystem ? entry.logBytes : (unsigned)X86ISA::PageShift);
 
     *newEntry = entry;
     newEntry->lruSeq = nextSeq();
@@ -129,6 +153,7 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
         newEntry->trieHandle =
         trie.insert(vpn, TlbEntryTrie::MaxBits, newEntry);
     }
+    numValid++;
     return newEntry;
 }
 
@@ -141,17 +166,41 @@ TLB::lookup(Addr va, bool update_lru)
     return entry;
 }
 
+TlbEntry *
+TLB::lookupFromUpper(Addr va, BaseMMU::Mode mode)
+{
+    TlbEntry *entry = lookup(va);
+    if (mode == BaseMMU::Read) {
+        stats.rdAccesses++;
+        if (!entry)
+            stats.rdMisses++;
+    } else {
+        stats.wrAccesses++;
+        if (!entry)
+            stats.wrMisses++;
+    }
+    return entry;
+}
+
+TlbEntry *
+TLB::probe(ThreadContext *tc, Addr va)
+{
+    CR4 cr4 = tc->readMiscRegNoEffect(misc_reg::Cr4);
+    CR3 cr3 = tc->readMiscRegNoEffect(misc_reg::Cr3);
+    uint64_t pcid = cr4.pcide ? (uint64_t)cr3.pcid : 0;
+    return lookup(concAddrPcid(va & ~mask(X86ISA::PageShift), pcid), false);
+}
+
 void
 TLB::flushAll()
 {
     DPRINTF(TLB, "Invalidating all entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (tlb[i].trieHandle)
+            remove(&tlb[i]);
     }
+    if (walker)
+        walker->flushWalkCache();
 }
 
 void
@@ -165,23 +214,28 @@ TLB::flushNonGlobal()
 {
     DPRINTF(TLB, "Invalidating all non global entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle && !tlb[i].global) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (tlb[i].trieHandle && !tlb[i].global)
+            remove(&tlb[i]);
     }
+    // The paging-structure caches hold no global entries.
+    if (walker)
+        walker->flushWalkCache();
+    if (nextTlb)
+        nextTlb->flushNonGlobal();
 }
 
 void
 TLB::demapPage(Addr va, uint64_t asn)
 {
     TlbEntry *entry = trie.lookup(va);
-    if (entry) {
-        trie.remove(entry->trieHandle);
-        entry->trieHandle = NULL;
-        freeList.push_back(entry);
-    }
+    if (entry)
+        remove(entry);
+    // INVLPG invalidates all the paging-structure cache entries, not just
+    // those used to translate the page.
+    if (walker)
+        walker->flushWalkCache();
+    if (nextTlb)
+        nextTlb->demapPage(va, asn);
 }
 
 namespace
@@ -321,7 +375,7 @@ TLB::finalizePhysical(const RequestPtr &req,
 Fault
 TLB::translate(const RequestPtr &req,
         ThreadContext *tc, BaseMMU::Translation *translation,
-        BaseMMU::Mode mode, bool &delayedResponse, bool timing)
+        BaseMMU::Mode mode, bool &delayedResponse, bool timing, bool hidden)
 {
     Request::Flags flags = req->getFlags();
     int seg = flags & SegmentFlagMask;
@@ -418,21 +472,35 @@ TLB::translate(const RequestPtr &req,
             pageAlignedVaddr = concAddrPcid(pageAlignedVaddr, pcid);
             TlbEntry *entry = lookup(pageAlignedVaddr);
 
-            if (mode == BaseMMU::Read) {
-                stats.rdAccesses++;
-            } else {
-                stats.wrAccesses++;
+            if (!hidden) {
+                if (mode == BaseMMU::Read) {
+                    stats.rdAccesses++;
+                } else {
+                    stats.wrAccesses++;
+                }
             }
             if (!entry) {
                 DPRINTF(TLB, "Handling a TLB miss for "
                         "address %#x at pc %#x.\n",
                         vaddr, tc->pcState().instAddr());
-                if (mode == BaseMMU::Read) {
-                    stats.rdMisses++;
-                } else {
-                    stats.wrMisses++;
+                if (!hidden) {
+                    if (mode == BaseMMU::Read) {
+                        stats.rdMisses++;
+                    } else {
+                        stats.wrMisses++;
+                    }
                 }
-                if (FullSystem) {
+                TlbEntry *next_entry = nullptr;
+                if (nextTlb) {
+                    next_entry = hidden ? nextTlb->lookup(pageAlignedVaddr) :
+                        nextTlb->lookupFromUpper(pageAlignedVaddr, mode);
+                }
+                if (next_entry) {
+                    DPRINTF(TLB, "Miss was serviced by the next level.\n");
+                    if (!hidden)
+                        stats.nextLevelHits++;
+                    entry = insert(next_entry->vaddr, *next_entry, pcid);
+                } else if (FullSystem) {
                     Fault fault = walker->start(tc, translation, req, mode);
                     if (timing || fault != NoFault) {
                         // This gets ignored in atomic mode.
@@ -556,14 +624,28 @@ TLB::translateFunctional(const RequestPtr &req, ThreadContext *tc,
 void
 TLB::translateTiming(const RequestPtr &req, ThreadContext *tc,
     BaseMMU::Translation *translation, BaseMMU::Mode mode)
+{
+    translateTiming(req, tc, translation, mode, false);
+}
+
+void
+TLB::translateCoalesced(const RequestPtr &req, ThreadContext *tc,
+    BaseMMU::Translation *translation, BaseMMU::Mode mode)
+{
+    translateTiming(req, tc, translation, mode, true);
+}
+
+void
+TLB::translateTiming(const RequestPtr &req, ThreadContext *tc,
+    BaseMMU::Translation *translation, BaseMMU::Mode mode, bool hidden)
 {
     bool delayedResponse;
     assert(translation);
     // CLFLUSHOPT/WB/FLUSH should be treated as read for protection checks
     if (req->isCacheClean())
         mode = BaseMMU::Read;
-    Fault fault =
-        TLB::translate(req, tc, translation, mode, delayedResponse, true);
+    Fault fault = TLB::translate(req, tc, translation, mode,
+                                 delayedResponse, true, hidden);
     if (!delayedResponse)
         translation->finish(fault, req, tc, mode);
     else
@@ -585,7 +667,9 @@ TLB::TlbStats::TlbStats(statistics::Group *parent)
     ADD_STAT(rdMisses, statistics::units::Count::get(),
              "TLB misses on read requests"),
     ADD_STAT(wrMisses, statistics::units::Count::get(),
-             "TLB misses on write requests")
+             "TLB misses on write requests"),
+    ADD_STAT(nextLevelHits, statistics::units::Count::get(),
+             "TLB misses serviced by the next level TLB")
 {
 }
 
@@ -593,7 +677,7 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = numValid;
     SERIALIZE_SCALAR(_size);
     SERIALIZE_SCALAR(lruSeq);
 
@@ -617,19 +701,21 @@ TLB::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(lruSeq);
 
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
+        TlbEntry restored;
+        restored.unserializeSection(cp, csprintf("Entry%d", x));
 
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
+        TlbEntry *newEntry = allocEntry(restored.vaddr, restored.logBytes);
+        *newEntry = restored;
         newEntry->trieHandle = trie.insert(newEntry->vaddr,
             TlbEntryTrie::MaxBits - newEntry->logBytes, newEntry);
+        numValid++;
     }
 }
 
 Port *
 TLB::getTableWalkerPort()
 {
-    return &walker->getPort("port");
+    return walker ? &walker->getPort("port") : nullptr;
 }
 
 } // namespace X86ISA
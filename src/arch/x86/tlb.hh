@@ -75,6 +75,18 @@ namespace X86ISA
 
         TlbEntry *lookup(Addr va, bool update_lru = true);
 
+        /**
+         * Look up an entry on behalf of an upper level TLB which missed,
+         * accounting the access in this TLB's statistics.
+         */
+        TlbEntry *lookupFromUpper(Addr va, BaseMMU::Mode mode);
+
+        /**
+         * Look up the entry a page table walk for the given linear address
+         * would fill, without updating the replacement state.
+         */
+        TlbEntry *probe(ThreadContext *tc, Addr va);
+
         void setConfigAddress(uint32_t addr);
         //concatenate Page Addr and pcid
         inline Addr concAddrPcid(Addr vpn, uint64_t pcid)
@@ -100,9 +112,21 @@ namespace X86ISA
       protected:
         uint32_t size;
 
+        /**
+         * Number of ways in each set. Entries of a set occupy consecutive
+         * slots of the tlb vector and an entry can only replace entries of
+         * the set selected by its own virtual page number.
+         */
+        uint32_t assoc;
+        uint32_t numSets;
+
         std::vector<TlbEntry> tlb;
 
-        EntryList freeList;
+        /** Number of valid entries. */
+        uint32_t numValid;
+
+        /** The unified second level TLB filled alongside this one. */
+        TLB *nextTlb;
 
         TlbEntryTrie trie;
         uint64_t lruSeq;
@@ -117,17 +141,33 @@ namespace X86ISA
             statistics::Scalar wrAccesses;
             statistics::Scalar rdMisses;
             statistics::Scalar wrMisses;
+            statistics::Scalar nextLevelHits;
         } stats;
 
         Fault translateInt(bool read, RequestPtr req, ThreadContext *tc);
 
+        /**
+         * @param hidden Whether the lookup should be hidden from the
+         *               statistics.
+         */
         Fault translate(const RequestPtr &req, ThreadContext *tc,
                 BaseMMU::Translation *translation, BaseMMU::Mode mode,
-                bool &delayedResponse, bool timing);
+                bool &delayedResponse, bool timing, bool hidden = false);
 
-      public:
+        void translateTiming(const RequestPtr &req, ThreadContext *tc,
+                BaseMMU::Translation *translation, BaseMMU::Mode mode,
+                bool hidden);
+
+        /**
+         * Find the slot a new entry for the given (pcid tagged) virtual
+         * page is stored in, evicting the least recently used entry of its
+         * set if the set is full.
+         */
+        TlbEntry *allocEntry(Addr vpn, unsigned log_bytes);
 
-        void evictLRU();
+        void remove(TlbEntry *entry);
+
+      public:
 
         uint64_t
         nextSeq()
@@ -145,6 +185,16 @@ namespace X86ISA
             const RequestPtr &req, ThreadContext *tc,
             BaseMMU::Translation *translation, BaseMMU::Mode mode) override;
 
+        /**
+         * Finish a timing translation whose walk was coalesced with an
+         * earlier walk that filled the page. The translation was counted
+         * when it missed, so the lookup completing it is not counted
+         * again.
+         */
+        void translateCoalesced(
+            const RequestPtr &req, ThreadContext *tc,
+            BaseMMU::Translation *translation, BaseMMU::Mode mode);
+
         /**
          * Do post-translation physical address finalization.
          *
@@ -103,6 +103,8 @@ paramIn(CheckpointIn &cp, const std::string &name, ExtMachInst &machInst)
     paramIn(cp, name + ".addrSize", machInst.addrSize);
     paramIn(cp, name + ".stackSize", machInst.stackSize);
     paramIn(cp, name + ".dispSize", machInst.dispSize);
+    // Not checkpointed, the decoder sets it before every lookup.
+    machInst.instSize = 0;
 
     // Mode
     paramIn(cp, name + ".mode", temp8);
@@ -240,6 +240,9 @@ struct ExtMachInst
     uint8_t stackSize;
     //The size of the displacement
     uint8_t dispSize;
+    //The length of the whole instruction. Redundant prefixes change it
+    //without changing any of the other fields.
+    uint8_t instSize;
 
     //Mode information
     OperatingModeAndCPL mode;
@@ -253,12 +256,13 @@ operator << (std::ostream &os, const ExtMachInst &emi)
                  "op = {\n\t\ttype = %s,\n\t\top = %#x,\n\t\t},\n\t"
                  "modRM = %#x,\n\tsib = %#x,\n\t"
                  "immediate = %#x,\n\tdisplacement = %#x\n\t"
-                 "dispSize = %d}\n",
+                 "dispSize = %d,\n\tinstSize = %d}\n",
                  (uint8_t)emi.legacy, (uint8_t)emi.rex,
                  (uint8_t)emi.vex,
                  opcodeTypeToStr(emi.opcode.type), (uint8_t)emi.opcode.op,
                  (uint8_t)emi.modRM, (uint8_t)emi.sib,
-                 emi.immediate, emi.displacement, emi.dispSize);
+                 emi.immediate, emi.displacement, emi.dispSize,
+                 emi.instSize);
     return os;
 }
 
@@ -293,6 +297,8 @@ operator == (const ExtMachInst &emi1, const ExtMachInst &emi2)
         return false;
     if (emi1.dispSize != emi2.dispSize)
         return false;
+    if (emi1.instSize != emi2.instSize)
+        return false;
     return true;
 }
 
@@ -328,7 +334,8 @@ struct hash<gem5::X86ISA::ExtMachInst>
                 emi.immediate ^ emi.displacement ^
                 emi.mode ^
                 emi.opSize ^ emi.addrSize ^
-                emi.stackSize ^ emi.dispSize;
+                emi.stackSize ^ emi.dispSize ^
+                ((uint64_t)emi.instSize << 56);
     };
 };
 
@@ -125,6 +125,16 @@ class ScalarInfoProxy : public InfoProxy<Stat, ScalarInfo>
     Result total() const { return this->s.total(); }
 };
 
+/** Info proxy for Value stats, which are read through a functor. */
+template <class Stat>
+class ValueInfoProxy : public ScalarInfoProxy<Stat>
+{
+  public:
+    ValueInfoProxy(Stat &stat) : ScalarInfoProxy<Stat>(stat) {}
+
+    bool computed() const override { return true; }
+};
+
 template <class Stat>
 class VectorInfoProxy : public InfoProxy<Stat, VectorInfo>
 {
@@ -710,7 +720,7 @@ class MethodProxy : public ProxyInfo
 };
 
 template <class Derived>
-class ValueBase : public DataWrap<Derived, ScalarInfoProxy>
+class ValueBase : public DataWrap<Derived, ValueInfoProxy>
 {
   private:
     ProxyInfo *proxy;
@@ -719,7 +729,7 @@ class ValueBase : public DataWrap<Derived, ScalarInfoProxy>
     ValueBase(Group *parent, const char *name,
               const units::Base *unit,
               const char *desc)
-        : DataWrap<Derived, ScalarInfoProxy>(parent, name, unit, desc),
+        : DataWrap<Derived, ValueInfoProxy>(parent, name, unit, desc),
           proxy(NULL)
     {
     }
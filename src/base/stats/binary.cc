@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <cassert>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** Names of the fixed columns of a distribution, in storage order. */
+const std::vector<std::string> &
+distFields(DistType type)
+{
+    static const std::vector<std::string> deviation_fields{
+        "samples", "sum", "squares",
+    };
+    static const std::vector<std::string> dist_fields{
+        "samples", "sum", "squares", "underflows", "overflows",
+        "min_value", "max_value", "min_bucket", "max_bucket", "bucket_size",
+    };
+    static const std::vector<std::string> hist_fields{
+        "samples", "sum", "squares", "logs",
+        "min_bucket", "max_bucket", "bucket_size",
+    };
+
+    switch (type) {
+      case Deviation:
+        return deviation_fields;
+      case Dist:
+        return dist_fields;
+      case Hist:
+        return hist_fields;
+      default:
+        panic("Unknown distribution type %d\n", type);
+    }
+}
+
+uint64_t
+doubleBits(double val)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+/** Name of element i of a vector-like stat. */
+std::string
+elementName(const std::vector<std::string> &subnames, size_t i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    else
+        return std::to_string(i);
+}
+
+} // anonymous namespace
+
+Binary::Binary(std::ostream &_stream, bool desc)
+    : stream(_stream), descriptions(desc), columnsWritten(0)
+{
+    stream.write(magic, std::strlen(magic));
+    putVarint(version);
+    stream.write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+void
+Binary::begin()
+{
+    assert(buffer.empty());
+}
+
+void
+Binary::end()
+{
+    for (; columnsWritten < columns.size(); ++columnsWritten) {
+        const Column &col = columns[columnsWritten];
+        buffer.push_back(RecColumn);
+        putVarint(columnsWritten);
+        putString(col.name);
+        putString(col.desc);
+    }
+
+    // Collect the ids of the columns that changed since the last dump
+    // before writing anything, the record needs the entry count up
+    // front.
+    std::vector<uint32_t> changed;
+    for (uint32_t id = 0; id < current.size(); ++id) {
+        if (!written[id] || doubleBits(current[id]) != doubleBits(last[id]))
+            changed.push_back(id);
+    }
+
+    buffer.push_back(RecDump);
+    putU64(curTick());
+    putVarint(changed.size());
+    uint32_t prev = 0;
+    for (const auto id : changed) {
+        putVarint(id - prev);
+        putDouble(current[id]);
+        prev = id;
+        last[id] = current[id];
+        written[id] = true;
+    }
+
+    stream.write(buffer.data(), buffer.size());
+    stream.flush();
+    buffer.clear();
+}
+
+bool
+Binary::valid() const
+{
+    return stream.good();
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    if (path.empty()) {
+        path.push(name);
+    } else {
+        path.push(path.top() + "." + name);
+    }
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+std::string
+Binary::statName(const std::string &name) const
+{
+    if (path.empty())
+        return name;
+    else
+        return path.top() + "." + name;
+}
+
+uint32_t
+Binary::columnId(const std::string &name, const std::string &desc)
+{
+    auto it = columnIds.find(name);
+    if (it != columnIds.end())
+        return it->second;
+
+    const uint32_t id = columns.size();
+    columns.push_back({name, descriptions ? desc : ""});
+    columnIds.emplace(name, id);
+    current.push_back(0.0);
+    last.push_back(0.0);
+    written.push_back(false);
+    return id;
+}
+
+template <typename SuffixFn>
+void
+Binary::record(const Info &info, const VResult &values, SuffixFn &&suffix)
+{
+    auto &ids = infoColumns[&info];
+    if (ids.size() != values.size()) {
+        const std::string base = statName(info.name);
+        ids.clear();
+        ids.reserve(values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            ids.push_back(columnId(base + suffix(i), info.desc));
+    }
+
+    for (size_t i = 0; i < values.size(); ++i)
+        current[ids[i]] = values[i];
+}
+
+void
+Binary::distValues(const DistData &data, VResult &values)
+{
+    values.push_back(data.samples);
+    values.push_back(data.sum);
+    values.push_back(data.squares);
+
+    switch (data.type) {
+      case Deviation:
+        return;
+      case Dist:
+        values.push_back(data.underflow);
+        values.push_back(data.overflow);
+        values.push_back(data.min_val);
+        values.push_back(data.max_val);
+        break;
+      case Hist:
+        values.push_back(data.logs);
+        break;
+    }
+
+    values.push_back(data.min);
+    values.push_back(data.max);
+    values.push_back(data.bucket_size);
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+std::string
+Binary::distSuffix(const Info &info, const DistData &data, size_t i)
+{
+    const auto &fields = distFields(data.type);
+    if (i < fields.size())
+        return info.separatorString + fields[i];
+    else
+        return info.separatorString + "bucket" +
+            std::to_string(i - fields.size());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    scratch.assign(1, info.result());
+    record(info, scratch, [](size_t i) { return std::string(); });
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    record(info, info.result(), [&info](size_t i) {
+        return info.separatorString + elementName(info.subnames, i);
+    });
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    scratch.clear();
+    distValues(info.data, scratch);
+    record(info, scratch, [&info](size_t i) {
+        return distSuffix(info, info.data, i);
+    });
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display) || info.size() == 0)
+        return;
+
+    scratch.clear();
+    for (off_type i = 0; i < info.size(); ++i)
+        distValues(info.data[i], scratch);
+
+    // All the distributions of a vector share the same parameters and
+    // therefore have the same number of columns.
+    const size_t per_dist = scratch.size() / info.size();
+    record(info, scratch, [&info, per_dist](size_t i) {
+        const size_t elem = i / per_dist;
+        return info.separatorString + elementName(info.subnames, elem) +
+            distSuffix(info, info.data[elem], i % per_dist);
+    });
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    scratch.assign(info.cvec.begin(), info.cvec.end());
+    record(info, scratch, [&info](size_t i) {
+        return "_" + elementName(info.subnames, i / info.y) +
+            info.separatorString + elementName(info.y_subnames, i % info.y);
+    });
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    // The set of buckets of a sparse histogram changes between dumps,
+    // so its columns are always looked up by name. Buckets which were
+    // dumped before but are gone now (e.g. after a stats reset) are
+    // zeroed rather than left with their old count.
+    auto &buckets = sparseColumns[&info];
+    for (const auto id : buckets)
+        current[id] = 0;
+    buckets.clear();
+
+    const std::string base = statName(info.name) + info.separatorString;
+    current[columnId(base + "samples", info.desc)] = info.data.samples;
+    for (const auto &[key, count] : info.data.cmap) {
+        std::ostringstream name;
+        name << base << key;
+        const uint32_t id = columnId(name.str(), info.desc);
+        current[id] = count;
+        buckets.push_back(id);
+    }
+}
+
+void
+Binary::putVarint(uint64_t val)
+{
+    while (val >= 0x80) {
+        buffer.push_back(static_cast<char>((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    buffer.push_back(static_cast<char>(val));
+}
+
+void
+Binary::putU64(uint64_t val)
+{
+    for (int i = 0; i < 8; ++i) {
+        buffer.push_back(static_cast<char>(val & 0xff));
+        val >>= 8;
+    }
+}
+
+void
+Binary::putDouble(double val)
+{
+    putU64(doubleBits(val));
+}
+
+void
+Binary::putString(const std::string &str)
+{
+    putVarint(str.size());
+    buffer.append(str);
+}
+
+std::unique_ptr<Output>
+initBinary(const std::string &filename, bool desc)
+{
+    return std::make_unique<Binary>(
+        *simout.findOrCreate(filename, true)->stream(), desc);
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/output.hh"
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Compact, columnar statistics output.
+ *
+ * Every scalar value produced by a stat (a vector element, a
+ * distribution bucket, etc.) is mapped to a numbered column the first
+ * time it is seen. The name (and optionally the description) of a
+ * column is only written once; subsequent dumps only contain the
+ * columns whose values changed since the previous dump. This makes
+ * periodic stat dumps both cheap to write and cheap to parse.
+ *
+ * The file starts with an 8-byte magic ("gem5stat") followed by a
+ * varint format version. The rest of the file is a sequence of
+ * records, each starting with a one-byte record type:
+ *
+ *  - RecColumn: varint column id, varint-prefixed name, varint-prefixed
+ *    description. Column ids are allocated densely in order.
+ *  - RecDump: 64-bit tick, varint number of entries, followed by
+ *    the entries. Each entry is a varint delta to the previous
+ *    entry's column id (the first delta is relative to 0) and a
+ *    64-bit IEEE 754 value.
+ *
+ * All fixed-size fields are little-endian. Column records for new
+ * columns always precede the dump record that first references
+ * them. See util/statsbin.py for a reader.
+ */
+class Binary : public Output
+{
+  public:
+    enum RecordType : uint8_t
+    {
+        RecColumn = 'C',
+        RecDump = 'D',
+    };
+
+    static constexpr const char *magic = "gem5stat";
+    static constexpr unsigned version = 1;
+
+    /**
+     * @param stream Output stream. The stream is not owned by this
+     *               object and must outlive it.
+     * @param desc Include stat descriptions in column records.
+     */
+    Binary(std::ostream &stream, bool desc);
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    /** Number of columns allocated so far. */
+    size_t numColumns() const { return columns.size(); }
+
+  protected:
+    struct Column
+    {
+        std::string name;
+        std::string desc;
+    };
+
+    std::string statName(const std::string &name) const;
+
+    /** Look up a column by name, allocating a new one if needed. */
+    uint32_t columnId(const std::string &name, const std::string &desc);
+
+    /**
+     * Store the values of a stat. The column ids of a stat are cached
+     * for as long as the number of values stays the same, so the
+     * (potentially expensive) name generator is only called the first
+     * time a stat is seen.
+     *
+     * @param info Stat the values belong to.
+     * @param values Values to store.
+     * @param suffix Function returning the column name suffix of the
+     *               i:th value.
+     */
+    template <typename SuffixFn>
+    void record(const Info &info, const VResult &values, SuffixFn &&suffix);
+
+    /** Append the columns describing a distribution to values. */
+    static void distValues(const DistData &data, VResult &values);
+
+    /** Column name suffix of the i:th value of a distribution. */
+    static std::string distSuffix(const Info &info, const DistData &data,
+                                  size_t i);
+
+    void putVarint(uint64_t val);
+    void putU64(uint64_t val);
+    void putDouble(double val);
+    void putString(const std::string &str);
+
+  protected:
+    std::ostream &stream;
+    const bool descriptions;
+
+    /** Object/group path */
+    std::stack<std::string> path;
+
+    std::vector<Column> columns;
+    std::unordered_map<std::string, uint32_t> columnIds;
+    std::unordered_map<const Info *, std::vector<uint32_t>> infoColumns;
+    /** Bucket columns of each sparse histogram in the last dump. */
+    std::unordered_map<const Info *, std::vector<uint32_t>> sparseColumns;
+
+    /** Number of columns that have had a column record written. */
+    size_t columnsWritten;
+
+    /** Values stored in the current dump. */
+    VResult current;
+    /** Values as of the last dump, used to compute deltas. */
+    VResult last;
+    /** Columns that have been written in at least one dump. */
+    std::vector<bool> written;
+
+    /** Scratch space for stat values. */
+    VResult scratch;
+    /** Output buffer, flushed to the stream at the end of each dump. */
+    std::string buffer;
+};
+
+/**
+ * Create a binary stat output.
+ *
+ * @param filename Output file name, relative to the output directory.
+ *                 Names ending in ".gz" are compressed.
+ * @param desc Include stat descriptions.
+ */
+std::unique_ptr<Output> initBinary(const std::string &filename,
+                                   bool desc = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/info.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+class TestScalarInfo : public statistics::ScalarInfo
+{
+  public:
+    double val = 0;
+
+    TestScalarInfo(const std::string &_name)
+    {
+        setName(_name, false);
+        flags = statistics::display;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { val = 0; }
+    bool zero() const override { return val == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+class TestVectorInfo : public statistics::VectorInfo
+{
+  public:
+    statistics::VCounter vals;
+    statistics::VResult results;
+
+    TestVectorInfo(const std::string &_name, size_t size)
+        : vals(size, 0), results(size, 0)
+    {
+        setName(_name, false);
+        flags = statistics::display;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::size_type size() const override { return vals.size(); }
+    const statistics::VCounter &value() const override { return vals; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        const_cast<TestVectorInfo *>(this)->results = vals;
+        return results;
+    }
+
+    statistics::Result total() const override { return 0; }
+};
+
+class TestSparseHistInfo : public statistics::SparseHistInfo
+{
+  public:
+    TestSparseHistInfo(const std::string &_name)
+    {
+        setName(_name, false);
+        flags = statistics::display;
+        data.samples = 0;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+/**
+ * Minimal decoder for the binary stat format. Maintains the full
+ * state of all columns as of the last decoded dump.
+ */
+class Decoder
+{
+  public:
+    std::map<uint64_t, std::string> names;
+    std::map<uint64_t, std::string> descs;
+    std::map<std::string, double> values;
+    /** Tick and number of entries of each decoded dump. */
+    std::vector<uint64_t> ticks;
+    std::vector<uint64_t> entries;
+
+    explicit Decoder(const std::string &_data) : data(_data)
+    {
+        EXPECT_EQ(data.compare(0, 8, statistics::Binary::magic), 0);
+        pos = 8;
+        EXPECT_EQ(getVarint(), statistics::Binary::version);
+        while (pos < data.size()) {
+            const char type = data[pos++];
+            if (type == statistics::Binary::RecColumn) {
+                const uint64_t id = getVarint();
+                names[id] = getString();
+                descs[id] = getString();
+            } else {
+                EXPECT_EQ(type, statistics::Binary::RecDump);
+                ticks.push_back(getU64());
+                const uint64_t count = getVarint();
+                entries.push_back(count);
+                uint64_t id = 0;
+                for (uint64_t i = 0; i < count; ++i) {
+                    id += getVarint();
+                    const uint64_t bits = getU64();
+                    double val;
+                    std::memcpy(&val, &bits, sizeof(val));
+                    values[names.at(id)] = val;
+                }
+            }
+        }
+    }
+
+  private:
+    const std::string data;
+    size_t pos;
+
+    uint64_t
+    getVarint()
+    {
+        uint64_t val = 0;
+        for (int shift = 0; ; shift += 7) {
+            const uint8_t byte = data[pos++];
+            val |= uint64_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return val;
+        }
+    }
+
+    uint64_t
+    getU64()
+    {
+        uint64_t val = 0;
+        for (int i = 0; i < 8; ++i)
+            val |= uint64_t(uint8_t(data[pos++])) << (8 * i);
+        return val;
+    }
+
+    std::string
+    getString()
+    {
+        const uint64_t len = getVarint();
+        std::string str = data.substr(pos, len);
+        pos += len;
+        return str;
+    }
+};
+
+void
+dump(statistics::Binary &out, std::initializer_list<statistics::Info *> stats)
+{
+    out.begin();
+    out.beginGroup("system");
+    for (auto *stat : stats)
+        stat->visit(out);
+    out.endGroup();
+    out.end();
+}
+
+} // anonymous namespace
+
+/** Test that columns are named after the stat and its group. */
+TEST(StatsBinaryTest, ColumnNames)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, true);
+
+    TestScalarInfo scalar("cycles");
+    scalar.desc = "Number of cycles";
+    TestVectorInfo vector("misses", 2);
+    vector.subnames = {"read", ""};
+    dump(out, {&scalar, &vector});
+
+    Decoder dec(ss.str());
+    ASSERT_EQ(dec.names.size(), 3);
+    EXPECT_EQ(dec.names[0], "system.cycles");
+    EXPECT_EQ(dec.descs[0], "Number of cycles");
+    EXPECT_EQ(dec.names[1], "system.misses::read");
+    EXPECT_EQ(dec.names[2], "system.misses::1");
+}
+
+/** Test that descriptions can be omitted. */
+TEST(StatsBinaryTest, NoDescriptions)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, false);
+
+    TestScalarInfo scalar("cycles");
+    scalar.desc = "Number of cycles";
+    dump(out, {&scalar});
+
+    Decoder dec(ss.str());
+    EXPECT_EQ(dec.descs[0], "");
+}
+
+/** Test that only changed values are written after the first dump. */
+TEST(StatsBinaryTest, IncrementalDumps)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, true);
+
+    TestScalarInfo a("a"), b("b");
+    TestVectorInfo v("v", 4);
+
+    a.val = 1;
+    b.val = 2;
+    dump(out, {&a, &b, &v});
+
+    a.val = 3;
+    v.vals[2] = 5;
+    tickHandler.setCurTick(1000);
+    dump(out, {&a, &b, &v});
+
+    tickHandler.setCurTick(2000);
+    dump(out, {&a, &b, &v});
+
+    Decoder dec(ss.str());
+    ASSERT_EQ(dec.entries.size(), 3);
+    EXPECT_EQ(dec.ticks[0], 0);
+    EXPECT_EQ(dec.ticks[1], 1000);
+    EXPECT_EQ(dec.ticks[2], 2000);
+    EXPECT_EQ(dec.entries[0], 6);
+    EXPECT_EQ(dec.entries[1], 2);
+    EXPECT_EQ(dec.entries[2], 0);
+    EXPECT_EQ(dec.values["system.a"], 3);
+    EXPECT_EQ(dec.values["system.b"], 2);
+    EXPECT_EQ(dec.values["system.v::2"], 5);
+    EXPECT_EQ(out.numColumns(), 6);
+}
+
+/** Test that stats appearing in later dumps get new columns. */
+TEST(StatsBinaryTest, LateColumns)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, true);
+
+    TestScalarInfo a("a"), b("b");
+    a.val = 1;
+    dump(out, {&a});
+    b.val = 7;
+    dump(out, {&a, &b});
+
+    Decoder dec(ss.str());
+    ASSERT_EQ(dec.names.size(), 2);
+    EXPECT_EQ(dec.names[1], "system.b");
+    EXPECT_EQ(dec.entries[1], 1);
+    EXPECT_EQ(dec.values["system.b"], 7);
+}
+
+/** Test that stats that are not displayed are skipped. */
+TEST(StatsBinaryTest, NoDisplay)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, true);
+
+    TestScalarInfo a("a");
+    a.flags = statistics::none;
+    dump(out, {&a});
+
+    Decoder dec(ss.str());
+    EXPECT_TRUE(dec.names.empty());
+    EXPECT_EQ(dec.entries[0], 0);
+}
+
+/**
+ * Test that sparse histogram buckets which disappear between dumps are
+ * written as zero instead of keeping their old counts.
+ */
+TEST(StatsBinaryTest, SparseHistReset)
+{
+    std::stringstream ss;
+    statistics::Binary out(ss, true);
+
+    TestSparseHistInfo hist("hist");
+    hist.data.cmap[1] = 3;
+    hist.data.cmap[4] = 2;
+    hist.data.samples = 5;
+    dump(out, {&hist});
+
+    hist.data.cmap.clear();
+    hist.data.cmap[4] = 1;
+    hist.data.samples = 1;
+    dump(out, {&hist});
+
+    Decoder dec(ss.str());
+    ASSERT_EQ(dec.entries.size(), 2);
+    EXPECT_EQ(dec.entries[1], 3);
+    EXPECT_EQ(dec.values["system.hist::samples"], 1);
+    EXPECT_EQ(dec.values["system.hist::1"], 0);
+    EXPECT_EQ(dec.values["system.hist::4"], 1);
+}
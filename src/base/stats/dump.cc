@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/dump.hh"
+
+#include <fnmatch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+#include "base/str.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+std::string
+childPath(const std::string &path, const std::string &name)
+{
+    return path.empty() ? name : path + "." + name;
+}
+
+void
+visitStats(Output &output, const Group &group, const std::string &path,
+           const StatFilter &filter, size_t first=0,
+           size_t last=std::numeric_limits<size_t>::max())
+{
+    const auto &stats = group.getStats();
+    last = std::min(last, stats.size());
+    for (size_t i = first; i < last; ++i) {
+        if (filter.matchStat(childPath(path, stats[i]->name)))
+            stats[i]->visit(output);
+    }
+}
+
+void
+dumpSerial(Output &output, const Group &group, const std::string &path,
+           const StatFilter &filter)
+{
+    visitStats(output, group, path, filter);
+
+    for (const auto &[name, child] : group.getStatGroups()) {
+        const std::string child_path = childPath(path, name);
+        if (!filter.matchGroup(child_path))
+            continue;
+
+        output.beginGroup(name.c_str());
+        dumpSerial(output, *child, child_path, filter);
+        output.endGroup();
+    }
+}
+
+/**
+ * Check if a stat can be dumped by a worker thread. Formulas and
+ * Value stats read other stats or simulator objects when they are
+ * evaluated, which isn't thread safe, so they (and stats that depend
+ * on them as a prereq) are always dumped by the main thread.
+ */
+bool
+parallelSafe(const Info &info)
+{
+    return !info.computed() && (!info.prereq || !info.prereq->computed());
+}
+
+/** Check if all the selected stats in a sub-tree are parallel safe. */
+bool
+subtreeSafe(const Group &group, const std::string &path,
+            const StatFilter &filter)
+{
+    for (auto *info : group.getStats()) {
+        if (!parallelSafe(*info) &&
+            filter.matchStat(childPath(path, info->name))) {
+            return false;
+        }
+    }
+
+    for (const auto &[name, child] : group.getStatGroups()) {
+        const std::string child_path = childPath(path, name);
+        if (filter.matchGroup(child_path) &&
+            !subtreeSafe(*child, child_path, filter)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/** A unit of work in a parallel dump. */
+struct DumpTask
+{
+    const Group *group;
+    /** Names of the groups leading up to this group. */
+    std::vector<std::string> names;
+    /** Full name of the group. */
+    std::string path;
+    /** Only visit the group's own stats, not its sub-groups. */
+    bool statsOnly;
+    /** Range of the group's own stats to visit if statsOnly is set. */
+    size_t first;
+    size_t last;
+    /** The task may run on a worker thread. */
+    bool parallel;
+    /** Forked output the task formats into. */
+    std::unique_ptr<Output> output;
+};
+
+/**
+ * Split a dump into tasks. Sub-trees are split breadth first into
+ * the stats of their root group and their sub-groups until there
+ * are enough tasks to keep all threads busy. Sub-trees containing
+ * stats that aren't parallel safe are always split, and the stats of
+ * their root group are split into runs of safe and unsafe stats, so
+ * only the unsafe stats themselves end up on the main thread. The
+ * task list is kept in the order in which a serial dump would visit
+ * the stats.
+ */
+std::vector<DumpTask>
+splitDump(const Group &group, const std::string &path,
+          const StatFilter &filter, unsigned threads)
+{
+    // Forked outputs start out at the top level, so they need to open
+    // all the groups leading up to the dump root.
+    std::vector<std::string> names;
+    if (!path.empty())
+        tokenize(names, path, '.');
+
+    std::vector<DumpTask> tasks;
+    tasks.push_back({&group, std::move(names), path, false, 0, 0,
+                     subtreeSafe(group, path, filter), nullptr});
+
+    const size_t target = 4 * threads;
+    bool split = true;
+    while (split) {
+        split = false;
+        const bool grow = tasks.size() < target;
+        std::vector<DumpTask> next;
+        for (auto &task : tasks) {
+            const bool leaf = task.group->getStatGroups().empty();
+            if (task.statsOnly || (task.parallel && (leaf || !grow))) {
+                next.push_back(std::move(task));
+                continue;
+            }
+
+            split = true;
+            const auto &stats = task.group->getStats();
+            for (size_t first = 0, i = 1; first < stats.size(); ++i) {
+                const bool safe = parallelSafe(*stats[first]);
+                if (i < stats.size() && parallelSafe(*stats[i]) == safe)
+                    continue;
+
+                next.push_back({task.group, task.names, task.path, true,
+                                first, i, safe, nullptr});
+                first = i;
+            }
+
+            for (const auto &[name, child] : task.group->getStatGroups()) {
+                const std::string child_path = childPath(task.path, name);
+                if (!filter.matchGroup(child_path))
+                    continue;
+
+                auto names = task.names;
+                names.push_back(name);
+                next.push_back({child, std::move(names), child_path, false,
+                                0, 0, subtreeSafe(*child, child_path, filter),
+                                nullptr});
+            }
+        }
+        tasks = std::move(next);
+    }
+
+    return tasks;
+}
+
+/** Dump the stats of a task to its forked output. */
+void
+runTask(DumpTask &task, const StatFilter &filter)
+{
+    Output &out = *task.output;
+    for (const auto &name : task.names)
+        out.beginGroup(name.c_str());
+
+    if (task.statsOnly)
+        visitStats(out, *task.group, task.path, filter, task.first, task.last);
+    else
+        dumpSerial(out, *task.group, task.path, filter);
+
+    for (size_t n = 0; n < task.names.size(); ++n)
+        out.endGroup();
+}
+
+} // anonymous namespace
+
+StatFilter::StatFilter(const std::vector<std::string> &_patterns)
+{
+    for (const auto &pattern : _patterns)
+        add(pattern);
+}
+
+void
+StatFilter::add(const std::string &pattern)
+{
+    patterns.emplace_back();
+    tokenize(patterns.back(), pattern, '.');
+}
+
+bool
+StatFilter::matchTokens(const std::vector<std::string> &pattern,
+                        const std::vector<std::string> &name, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if (fnmatch(pattern[i].c_str(), name[i].c_str(), 0) != 0)
+            return false;
+    }
+    return true;
+}
+
+bool
+StatFilter::matchGroup(const std::string &path) const
+{
+    if (patterns.empty() || path.empty())
+        return true;
+
+    std::vector<std::string> name;
+    tokenize(name, path, '.');
+    for (const auto &pattern : patterns) {
+        // Groups above the pattern depth may contain matching stats,
+        // groups below it are covered by the pattern.
+        if (matchTokens(pattern, name, std::min(pattern.size(), name.size())))
+            return true;
+    }
+    return false;
+}
+
+bool
+StatFilter::matchStat(const std::string &full_name) const
+{
+    if (patterns.empty())
+        return true;
+
+    std::vector<std::string> name;
+    tokenize(name, full_name, '.');
+    for (const auto &pattern : patterns) {
+        if (name.size() >= pattern.size() &&
+            matchTokens(pattern, name, pattern.size())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+prepareGroup(Group &group, const std::string &path,
+             const StatFilter &filter)
+{
+    for (auto *info : group.getStats()) {
+        if (filter.matchStat(childPath(path, info->name)))
+            info->prepare();
+    }
+
+    for (const auto &[name, child] : group.getStatGroups()) {
+        const std::string child_path = childPath(path, name);
+        if (filter.matchGroup(child_path))
+            prepareGroup(*child, child_path, filter);
+    }
+}
+
+void
+dumpGroup(Output &output, Group &group, const std::string &path,
+          const StatFilter &filter, unsigned threads)
+{
+    if (threads <= 1 || !output.fork()) {
+        dumpSerial(output, group, path, filter);
+        return;
+    }
+
+    auto tasks = splitDump(group, path, filter, threads);
+    std::vector<DumpTask *> parallel;
+    for (auto &task : tasks) {
+        task.output = output.fork();
+        if (task.parallel)
+            parallel.push_back(&task);
+    }
+
+    // Evaluate the stats that aren't parallel safe before starting the
+    // workers so that they never run concurrently with other stats.
+    for (auto &task : tasks) {
+        if (!task.parallel)
+            runTask(task, filter);
+    }
+
+    std::atomic<size_t> next_task(0);
+    auto worker = [&parallel, &next_task, &filter]() {
+        for (size_t i = next_task++; i < parallel.size(); i = next_task++)
+            runTask(*parallel[i], filter);
+    };
+
+    std::vector<std::thread> workers;
+    const size_t num_workers = std::min<size_t>(threads, parallel.size());
+    for (size_t i = 1; i < num_workers; ++i)
+        workers.emplace_back(worker);
+    worker();
+    for (auto &t : workers)
+        t.join();
+
+    for (auto &task : tasks)
+        output.merge(*task.output);
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_DUMP_HH__
+#define __BASE_STATS_DUMP_HH__
+
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Group;
+class Output;
+
+/**
+ * Stat name filter used to select the stats to dump.
+ *
+ * Patterns are dot-separated lists of shell-style wildcard patterns
+ * (e.g., "system.cpu*.ipc") that are matched component by component
+ * against full stat names. A pattern that names a group (e.g.,
+ * "system.l2") selects all stats in that group and its sub-groups. An
+ * empty filter selects all stats.
+ */
+class StatFilter
+{
+  public:
+    StatFilter() = default;
+    StatFilter(const std::vector<std::string> &patterns);
+
+    void add(const std::string &pattern);
+    bool empty() const { return patterns.empty(); }
+
+    /** Check if a group with the given full name can contain matches. */
+    bool matchGroup(const std::string &path) const;
+
+    /** Check if a stat with the given full name matches. */
+    bool matchStat(const std::string &name) const;
+
+  private:
+    /**
+     * Check if the first n components of a name match a pattern.
+     */
+    static bool matchTokens(const std::vector<std::string> &pattern,
+                            const std::vector<std::string> &name, size_t n);
+
+    std::vector<std::vector<std::string>> patterns;
+};
+
+/**
+ * Prepare the stats of a group hierarchy for dumping.
+ *
+ * Only stats whose full name matches the filter are prepared, and
+ * groups that can't contain any matching stats are skipped entirely.
+ *
+ * @param group Root of the hierarchy.
+ * @param path Full name of the root group ("" for the root object).
+ * @param filter Stat name filter.
+ */
+void prepareGroup(Group &group, const std::string &path,
+                  const StatFilter &filter);
+
+/**
+ * Dump the stats of a group hierarchy to an output.
+ *
+ * Stats are only visited (and therefore evaluated, which matters for
+ * formulas) if their full name matches the filter. Sub-groups that
+ * can't contain matching stats are pruned without being visited.
+ *
+ * If more than one thread is requested, and the output supports
+ * Output::fork(), independent sub-groups are evaluated and formatted
+ * in parallel and appended to the output in the same order as a
+ * serial dump would produce. Stats that are computed from other state
+ * when read (see Info::computed()), such as formulas and Value stats,
+ * are always evaluated on the calling thread before any workers are
+ * started. The caller is responsible for calling
+ * Output::begin()/end() and for opening the groups leading up to the
+ * root group.
+ *
+ * @param output Output to dump to.
+ * @param group Root of the hierarchy.
+ * @param path Full name of the root group ("" for the root object).
+ * @param filter Stat name filter.
+ * @param threads Maximum number of host threads to use.
+ */
+void dumpGroup(Output &output, Group &group, const std::string &path,
+               const StatFilter &filter, unsigned threads = 1);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_DUMP_HH__
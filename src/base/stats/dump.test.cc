@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/stats/dump.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class TestInfo : public statistics::ScalarInfo
+{
+  public:
+    int prepared = 0;
+    mutable int evaluated = 0;
+    /** Pretend to be computed from other state, like a formula. */
+    bool isComputed = false;
+    /** Thread that last evaluated the stat. */
+    mutable std::thread::id thread;
+
+    TestInfo(statistics::Group &group, const std::string &_name)
+    {
+        setName(_name, false);
+        group.addStat(this);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override { prepared++; }
+    void reset() override {}
+    bool zero() const override { return false; }
+    bool computed() const override { return isComputed; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::Counter value() const override { return 0; }
+
+    statistics::Result
+    result() const override
+    {
+        evaluated++;
+        thread = std::this_thread::get_id();
+        return 0;
+    }
+
+    statistics::Result total() const override { return 0; }
+};
+
+/** Output that records the full names of the stats it visits. */
+class RecordingOutput : public statistics::Output
+{
+  public:
+    std::vector<std::string> names;
+    bool forkable = true;
+
+    void begin() override {}
+    void end() override {}
+    bool valid() const override { return true; }
+
+    void
+    beginGroup(const char *name) override
+    {
+        path.push_back(path.empty() ? name : path.back() + "." + name);
+    }
+
+    void endGroup() override { path.pop_back(); }
+
+    void
+    visit(const statistics::ScalarInfo &info) override
+    {
+        info.result();
+        names.push_back(path.empty() ? info.name :
+                        path.back() + "." + info.name);
+    }
+
+    void visit(const statistics::VectorInfo &info) override {}
+    void visit(const statistics::DistInfo &info) override {}
+    void visit(const statistics::VectorDistInfo &info) override {}
+    void visit(const statistics::Vector2dInfo &info) override {}
+    void visit(const statistics::FormulaInfo &info) override {}
+    void visit(const statistics::SparseHistInfo &info) override {}
+
+    std::unique_ptr<statistics::Output>
+    fork() const override
+    {
+        if (!forkable)
+            return nullptr;
+        return std::make_unique<RecordingOutput>();
+    }
+
+    void
+    merge(statistics::Output &forked) override
+    {
+        auto &rec = static_cast<RecordingOutput &>(forked);
+        names.insert(names.end(), rec.names.begin(), rec.names.end());
+    }
+
+  private:
+    std::vector<std::string> path;
+};
+
+/**
+ * A small system with a few sub-groups:
+ *   root.a
+ *   system.x
+ *   system.cpu0.ipc, system.cpu0.cycles
+ *   system.cpu1.ipc, system.cpu1.cycles
+ *   system.mem.bw
+ */
+class StatsDumpTest : public testing::Test
+{
+  protected:
+    statistics::Group root{nullptr};
+    statistics::Group system{nullptr};
+    statistics::Group cpu0{nullptr};
+    statistics::Group cpu1{nullptr};
+    statistics::Group mem{nullptr};
+    std::list<TestInfo> stats;
+
+    TestInfo &
+    add(statistics::Group &group, const std::string &name)
+    {
+        stats.emplace_back(group, name);
+        return stats.back();
+    }
+
+    void
+    SetUp() override
+    {
+        root.addStatGroup("system", &system);
+        system.addStatGroup("cpu0", &cpu0);
+        system.addStatGroup("cpu1", &cpu1);
+        system.addStatGroup("mem", &mem);
+        add(root, "a");
+        add(system, "x");
+        add(cpu0, "ipc");
+        add(cpu0, "cycles");
+        add(cpu1, "ipc");
+        add(cpu1, "cycles");
+        add(mem, "bw");
+    }
+
+    const std::vector<std::string> allNames{
+        "a", "system.x",
+        "system.cpu0.ipc", "system.cpu0.cycles",
+        "system.cpu1.ipc", "system.cpu1.cycles",
+        "system.mem.bw",
+    };
+};
+
+} // anonymous namespace
+
+/** Test that an empty filter dumps everything in order. */
+TEST_F(StatsDumpTest, NoFilter)
+{
+    RecordingOutput out;
+    statistics::dumpGroup(out, root, "", statistics::StatFilter());
+    EXPECT_EQ(out.names, allNames);
+}
+
+/** Test that only matching stats are evaluated. */
+TEST_F(StatsDumpTest, Filter)
+{
+    RecordingOutput out;
+    statistics::StatFilter filter({"system.cpu*.ipc"});
+    statistics::dumpGroup(out, root, "", filter);
+
+    const std::vector<std::string> expected{
+        "system.cpu0.ipc", "system.cpu1.ipc",
+    };
+    EXPECT_EQ(out.names, expected);
+
+    for (const auto &stat : stats)
+        EXPECT_EQ(stat.evaluated, stat.name == "ipc" ? 1 : 0);
+}
+
+/** Test group and stat name matching. */
+TEST(StatsFilterTest, Match)
+{
+    statistics::StatFilter filter({"system.cpu*.ipc", "system.l2"});
+    EXPECT_TRUE(filter.matchGroup("system"));
+    EXPECT_TRUE(filter.matchGroup("system.cpu0"));
+    EXPECT_TRUE(filter.matchGroup("system.l2.tags"));
+    EXPECT_FALSE(filter.matchGroup("system.mem"));
+
+    EXPECT_TRUE(filter.matchStat("system.cpu0.ipc"));
+    EXPECT_TRUE(filter.matchStat("system.l2.tags.occupancy"));
+    EXPECT_FALSE(filter.matchStat("system.x"));
+    EXPECT_FALSE(filter.matchStat("system.cpu0.cycles"));
+    EXPECT_FALSE(filter.matchStat("system.l3.misses"));
+
+    EXPECT_TRUE(statistics::StatFilter().matchStat("system.x"));
+}
+
+/** Test that prepare honors the filter. */
+TEST_F(StatsDumpTest, Prepare)
+{
+    statistics::StatFilter filter({"system.mem"});
+    statistics::prepareGroup(root, "", filter);
+
+    for (const auto &stat : stats)
+        EXPECT_EQ(stat.prepared, stat.name == "bw" ? 1 : 0);
+}
+
+/** Test dumping a sub-tree. */
+TEST_F(StatsDumpTest, SubTree)
+{
+    RecordingOutput out;
+    out.beginGroup("system");
+    out.beginGroup("cpu1");
+    statistics::dumpGroup(out, cpu1, "system.cpu1", statistics::StatFilter(),
+                          4);
+    out.endGroup();
+    out.endGroup();
+
+    const std::vector<std::string> expected{
+        "system.cpu1.ipc", "system.cpu1.cycles",
+    };
+    EXPECT_EQ(out.names, expected);
+}
+
+/** Test that a parallel dump produces the same order as a serial one. */
+TEST_F(StatsDumpTest, Parallel)
+{
+    for (unsigned threads : {2, 3, 8}) {
+        RecordingOutput out;
+        statistics::dumpGroup(out, root, "", statistics::StatFilter(),
+                              threads);
+        EXPECT_EQ(out.names, allNames);
+    }
+}
+
+/** Test that outputs that can't fork are dumped serially. */
+TEST_F(StatsDumpTest, ParallelNoFork)
+{
+    RecordingOutput out;
+    out.forkable = false;
+    statistics::dumpGroup(out, root, "", statistics::StatFilter(), 4);
+    EXPECT_EQ(out.names, allNames);
+}
+
+/**
+ * Test that computed stats, and stats that depend on them, are
+ * evaluated on the calling thread in a parallel dump.
+ */
+TEST_F(StatsDumpTest, ParallelComputed)
+{
+    // system.cpu1.ipc, system.mem.bw and system.cpu0.cycles
+    auto &ipc = *std::next(stats.begin(), 4);
+    auto &bw = *std::next(stats.begin(), 6);
+    auto &cycles = *std::next(stats.begin(), 3);
+    ipc.isComputed = true;
+    bw.isComputed = true;
+    cycles.prereq = &ipc;
+
+    for (unsigned threads : {2, 3, 8}) {
+        RecordingOutput out;
+        statistics::dumpGroup(out, root, "", statistics::StatFilter(),
+                              threads);
+        EXPECT_EQ(out.names, allNames);
+        EXPECT_EQ(ipc.thread, std::this_thread::get_id());
+        EXPECT_EQ(bw.thread, std::this_thread::get_id());
+        EXPECT_EQ(cycles.thread, std::this_thread::get_id());
+    }
+
+    for (const auto &stat : stats)
+        EXPECT_EQ(stat.evaluated, 3);
+}
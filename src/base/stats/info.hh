@@ -156,6 +156,13 @@ class Info
      */
     virtual bool zero() const = 0;
 
+    /**
+     * Check if the value of this stat is computed from other state
+     * (e.g., other stats or simulator objects) when it is read rather
+     * than read from its own storage.
+     */
+    virtual bool computed() const { return false; }
+
     /**
      * Visitor entry for outputing statistics data
      */
@@ -245,6 +252,7 @@ class FormulaInfo : public VectorInfo
 {
   public:
     virtual std::string str() const = 0;
+    bool computed() const override { return true; }
 };
 
 class SparseHistInfo : public Info
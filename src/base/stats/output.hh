@@ -42,6 +42,7 @@
 #define __BASE_STATS_OUTPUT_HH__
 
 #include <list>
+#include <memory>
 #include <string>
 
 #include "base/compiler.hh"
@@ -79,6 +80,19 @@ struct Output
     virtual void visit(const Vector2dInfo &info) = 0;
     virtual void visit(const FormulaInfo &info) = 0;
     virtual void visit(const SparseHistInfo &info) = 0; // Sparse histogram
+
+    /**
+     * Create an output that formats stats like this one, but into a
+     * private buffer. Forked outputs are used to format independent
+     * stat groups in parallel and are appended to their parent, in
+     * order, using merge(). Outputs that can't format stats out of
+     * order (e.g., because they number the stats they see) return
+     * nullptr, which makes dumps serial.
+     */
+    virtual std::unique_ptr<Output> fork() const { return nullptr; }
+
+    /** Append the contents of an output created by fork(). */
+    virtual void merge(Output &forked) {}
 };
 
 } // namespace statistics
@@ -139,6 +139,25 @@ Text::end()
     stream->flush();
 }
 
+std::unique_ptr<Output>
+Text::fork() const
+{
+    auto text = std::make_unique<Text>();
+    text->mystream = true;
+    text->stream = new std::ostringstream;
+    text->enableUnits = enableUnits;
+    text->descriptions = descriptions;
+    text->spaces = spaces;
+    return text;
+}
+
+void
+Text::merge(Output &forked)
+{
+    auto &text = dynamic_cast<Text &>(forked);
+    *stream << static_cast<std::ostringstream *>(text.stream)->str();
+}
+
 std::string
 Text::statName(const std::string &name) const
 {
@@ -42,6 +42,7 @@
 #define __BASE_STATS_TEXT_HH__
 
 #include <iosfwd>
+#include <memory>
 #include <stack>
 #include <string>
 
@@ -100,6 +101,9 @@ class Text : public Output
     bool valid() const override;
     void begin() override;
     void end() override;
+
+    std::unique_ptr<Output> fork() const override;
+    void merge(Output &forked) override;
 };
 
 std::string ValueToString(Result value, int precision);
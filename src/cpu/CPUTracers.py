@@ -35,6 +35,24 @@ class ExeTracer(InstTracer):
     cxx_header = "cpu/exetrace.hh"
 
 
+class BinaryExeTracer(InstTracer):
+    type = "BinaryExeTracer"
+    cxx_class = "gem5::trace::BinaryExeTracer"
+    cxx_header = "cpu/binary_exetrace.hh"
+
+    file_name = Param.String(
+        "",
+        "Trace file, compressed if its name ends in .gz "
+        "(<name>.bin.gz if empty)",
+    )
+    buffer_records = Param.Unsigned(
+        16384, "Number of records in each buffer handed to the writer"
+    )
+    num_buffers = Param.Unsigned(
+        4, "Number of buffers in the ring drained by the writer thread"
+    )
+
+
 class IntelTrace(InstTracer):
     type = "IntelTrace"
     cxx_class = "gem5::trace::IntelTrace"
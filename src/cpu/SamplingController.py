@@ -0,0 +1,126 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import m5
+from m5.objects.SimObject import SimObject
+from m5.params import *
+from m5.util.pybind import *
+
+
+class SamplingController(SimObject):
+    """A SMARTS style statistical sampling controller. Every sampling period
+    fast-forwards on fast_forward_cpus, warms the caches functionally on
+    warming_cpus, warms the pipeline on detailed_cpus and then measures the
+    CPI of one unit on detailed_cpus. The simulation exits with "sampling
+    complete" once the mean CPI is within target_error at the given
+    confidence. Each list holds a single, single threaded CPU.
+
+    Only state the CPUs share, like the caches, is warmed functionally. The
+    branch predictor of the detailed CPU is only warmed by detailed warming.
+
+    Switching CPUs has to drain the system, so it is done by run(), which
+    should be used in place of m5.simulate().
+    """
+
+    type = "SamplingController"
+    cxx_header = "cpu/sampling_controller.hh"
+    cxx_class = "gem5::SamplingController"
+
+    cxx_exports = [
+        PyBindMethod("startPhase"),
+        PyBindMethod("currentPhase"),
+        PyBindMethod("done"),
+        PyBindMethod("cpiMean"),
+        PyBindMethod("relativeError"),
+    ]
+
+    fast_forward_cpus = VectorParam.BaseCPU(
+        [], "CPUs to fast-forward on, e.g. KVM or atomic CPUs"
+    )
+    warming_cpus = VectorParam.BaseCPU(
+        [], "CPUs to functionally warm the caches on"
+    )
+    detailed_cpus = VectorParam.BaseCPU(
+        "CPUs to warm the pipeline and measure on"
+    )
+
+    period = Param.Counter(1000000, "Instructions per sampling period")
+    functional_warming = Param.Counter(
+        0, "Instructions of functional warming per period"
+    )
+    detailed_warming = Param.Counter(
+        2000, "Instructions of detailed warming per period"
+    )
+    unit_size = Param.Counter(1000, "Instructions per measurement unit")
+
+    target_error = Param.Float(0.03, "Target relative error of the mean CPI")
+    confidence = Param.Float(0.997, "Confidence level of the target error")
+    min_units = Param.Unsigned(
+        30, "Minimum number of units to measure before stopping"
+    )
+    max_units = Param.Unsigned(
+        0, "Maximum number of units to measure (0 for no limit)"
+    )
+
+    switch_cause = Param.String(
+        "sampling switch cpus",
+        "Exit cause used when the next phase runs on different CPUs",
+    )
+
+    def _phase_cpus(self, phase):
+        if phase == 0:
+            return self.fast_forward_cpus
+        elif phase == 1:
+            return self.warming_cpus
+        return self.detailed_cpus
+
+    def run(self, system, max_tick=None):
+        """Simulate until sampling is complete, switching CPUs as the
+        controller requests. Returns the exit event which ended sampling,
+        or any other exit event.
+        """
+        if max_tick is None:
+            max_tick = m5.MaxTick
+        cpu_lists = [
+            list(cpus)
+            for cpus in (
+                self.fast_forward_cpus,
+                self.warming_cpus,
+                self.detailed_cpus,
+            )
+            if len(cpus)
+        ]
+        while True:
+            event = m5.simulate(max_tick - m5.curTick())
+            if event.getCause() != self.switch_cause:
+                return event
+
+            next_cpus = list(self._phase_cpus(self.currentPhase()))
+            active = next(
+                cpus for cpus in cpu_lists if not cpus[0].switchedOut()
+            )
+            m5.switchCpus(system, list(zip(active, next_cpus)), verbose=False)
+            self.startPhase()
@@ -44,6 +44,7 @@
 #include "cpu/base.hh"
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -381,6 +382,8 @@ BaseCPU::regProbePoints()
     ppRetiredLoads = pmuProbePoint("RetiredLoads");
     ppRetiredStores = pmuProbePoint("RetiredStores");
     ppRetiredBranches = pmuProbePoint("RetiredBranches");
+    ppRetiredBranchInfo = new ProbePointArg<RetiredBranchInfo>(
+        getProbeManager(), "RetiredBranchInfo");
 
     ppSleeping = new ProbePointArg<bool>(this->getProbeManager(),
                                          "Sleeping");
@@ -404,6 +407,21 @@ BaseCPU::probeInstCommit(const StaticInstPtr &inst, Addr pc)
         ppRetiredBranches->notify(1);
 }
 
+void
+BaseCPU::probeBranchCommit(const StaticInstPtr &inst, const PCStateBase &pc,
+                           ThreadID tid)
+{
+    if (!inst->isControl() || !ppRetiredBranchInfo->hasListeners())
+        return;
+
+    std::unique_ptr<PCStateBase> next(pc.clone());
+    inst->advancePC(*next);
+
+    ppRetiredBranchInfo->notify(RetiredBranchInfo{
+            tid, pc.instAddr(), next->instAddr(), pc.branching(),
+            inst.get()});
+}
+
 BaseCPU::
 BaseCPUStats::BaseCPUStats(statistics::Group *parent)
     : statistics::Group(parent),
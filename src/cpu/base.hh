@@ -500,6 +500,30 @@ class BaseCPU : public ClockedObject
      */
     virtual void probeInstCommit(const StaticInstPtr &inst, Addr pc);
 
+    /** Information about a committed control instruction. */
+    struct RetiredBranchInfo
+    {
+        ThreadID tid;
+        /** The PC of the control instruction. */
+        Addr pc;
+        /** The PC of the instruction which followed it. */
+        Addr target;
+        /** Whether the instruction changed the flow of control. */
+        bool taken;
+        const StaticInst *inst;
+    };
+
+    /**
+     * Helper method to trigger the RetiredBranchInfo probe for a
+     * committed control instruction.
+     *
+     * @param inst Instruction that just committed
+     * @param pc PC state of the instruction after it executed
+     * @param tid Thread that committed the instruction
+     */
+    void probeBranchCommit(const StaticInstPtr &inst, const PCStateBase &pc,
+                           ThreadID tid);
+
    protected:
     /**
      * Helper method to instantiate probe points belonging to this
@@ -529,6 +553,9 @@ class BaseCPU : public ClockedObject
     /** Retired branches (any type) */
     probing::PMUUPtr ppRetiredBranches;
 
+    /** Retired branches with their direction and target */
+    ProbePointArg<RetiredBranchInfo> *ppRetiredBranchInfo;
+
     /** CPU cycle counter even if any thread Context is suspended*/
     probing::PMUUPtr ppAllCycles;
 
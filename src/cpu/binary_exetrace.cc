@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/binary_exetrace.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/loader/symtab.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "cpu/thread_context.hh"
+#include "debug/ExecAll.hh"
+#include "enums/OpClass.hh"
+#include "sim/byteswap.hh"
+#include "sim/core.hh"
+#include "sim/full_system.hh"
+
+namespace gem5
+{
+
+namespace trace {
+
+void
+BinaryExeTracerRecord::traceInst(const StaticInstPtr &inst, bool ran)
+{
+    const bool in_user_mode = thread->getIsaPtr()->inUserMode();
+    if (in_user_mode && !debug::ExecUser)
+        return;
+    if (!in_user_mode && !debug::ExecKernel)
+        return;
+
+    // Define any new strings before the record which refers to them.
+    const uint32_t cpu = tracer.cpuId(thread->getCpuPtr());
+    const uint32_t disasm = tracer.disasmId(inst, *pc);
+    uint32_t symbol = 0;
+    if (debug::ExecSymbol && (!FullSystem || !in_user_mode))
+        symbol = tracer.symbolId(pc->instAddr());
+
+    BinaryTraceRecord &rec = tracer.allocRecord();
+    rec.type = BinaryTraceRecord::Inst;
+    rec.tick = htole<uint64_t>(when);
+    rec.pc = htole<uint64_t>(pc->instAddr());
+    rec.cpu = htole(cpu);
+    rec.disasm = htole(disasm);
+    rec.symbol = htole(symbol);
+    rec.upc = htole<uint16_t>(pc->microPC());
+    rec.opClass = htole<uint16_t>(inst->opClass());
+    rec.asid = htole<uint32_t>(thread->getIsaPtr()->getExecutingAsid());
+    rec.thread = thread->threadId();
+
+    uint8_t flags = 0;
+    if (ran)
+        flags |= BinaryTraceRecord::Ran;
+    if (inst->isMicroop())
+        flags |= BinaryTraceRecord::Microop;
+    if (!predicate)
+        flags |= BinaryTraceRecord::PredicatedFalse;
+    if (getMemValid()) {
+        flags |= BinaryTraceRecord::MemValid;
+        rec.addr = htole<uint64_t>(addr);
+    }
+    rec.flags = flags;
+
+    if (!ran)
+        return;
+
+    rec.dataStatus = dataStatus;
+    if (dataStatus == DataReg) {
+        // Results wider than 64 bits follow the record as a string.
+        int64_t vec_bytes = thread->getIsaPtr()->getVectorLengthInBytes();
+        tracer.writeString(BinaryTraceRecord::Result, 0,
+                vec_bytes > 0 && inst->isVector() ?
+                data.asReg.asString(vec_bytes) : data.asReg.asString());
+    } else if (dataStatus != DataInvalid) {
+        rec.data = htole<uint64_t>(data.asInt);
+    }
+}
+
+void
+BinaryExeTracerRecord::dump()
+{
+    // Select the instructions to trace exactly as ExeTracerRecord does.
+    if (debug::ExecMacro && staticInst->isMicroop() &&
+        ((debug::ExecMicro &&
+            macroStaticInst && staticInst->isFirstMicroop()) ||
+            (!debug::ExecMicro &&
+             macroStaticInst && staticInst->isLastMicroop()))) {
+        traceInst(macroStaticInst, false);
+    }
+    if (debug::ExecMicro || !staticInst->isMicroop()) {
+        traceInst(staticInst, true);
+    }
+}
+
+BinaryExeTracer::BinaryExeTracer(const Params &p)
+    : InstTracer(p), nextStringId(enums::Num_OpClass + 1), output(nullptr),
+      bufferRecords(p.buffer_records), buffers(p.num_buffers),
+      curBuffer(0), curRecords(0), stopping(false)
+{
+    fatal_if(!bufferRecords, "%s: buffer_records must be non-zero.\n",
+             name());
+    fatal_if(buffers.size() < 2, "%s: num_buffers must be at least 2.\n",
+             name());
+
+    for (auto &buffer : buffers)
+        buffer.resize(bufferRecords);
+    for (size_t i = 1; i < buffers.size(); i++)
+        freeBuffers.push_back(i);
+
+    const std::string file_name =
+        p.file_name.empty() ? name() + ".bin.gz" : p.file_name;
+    output = simout.create(file_name, true);
+
+    BinaryTraceHeader header = {};
+    std::memcpy(header.magic, "gem5xtr", sizeof(header.magic));
+    header.version = htole<uint32_t>(1);
+    header.recordSize = htole<uint32_t>(sizeof(BinaryTraceRecord));
+    header.tickFrequency = htole<uint64_t>(sim_clock::Frequency);
+    output->stream()->write((const char *)&header, sizeof(header));
+
+    // The names of the op classes are the strings with the lowest ids.
+    for (int op = 0; op < enums::Num_OpClass; op++) {
+        writeString(BinaryTraceRecord::String, op + 1,
+                    enums::OpClassStrings[op]);
+    }
+
+    writer = std::thread([this]() { writerLoop(); });
+
+    // get a callback when we exit so we can close the file
+    registerExitCallback([this]() { close(); });
+}
+
+BinaryExeTracer::~BinaryExeTracer()
+{
+    close();
+}
+
+BinaryTraceRecord &
+BinaryExeTracer::allocRecord()
+{
+    if (curRecords == bufferRecords)
+        submitBuffer();
+
+    BinaryTraceRecord &rec = buffers[curBuffer][curRecords++];
+    rec = {};
+    return rec;
+}
+
+void
+BinaryExeTracer::writeString(BinaryTraceRecord::Type type, uint64_t id,
+                             const std::string &str)
+{
+    BinaryTraceRecord &rec = allocRecord();
+    rec.type = type;
+    rec.pc = htole(id);
+    rec.data = htole<uint64_t>(str.size());
+
+    // The payload is padded to a whole number of records.
+    for (size_t pos = 0; pos < str.size(); pos += sizeof(BinaryTraceRecord)) {
+        BinaryTraceRecord &payload = allocRecord();
+        std::memcpy(&payload, str.data() + pos,
+                    std::min(sizeof(payload), str.size() - pos));
+    }
+}
+
+uint32_t
+BinaryExeTracer::cpuId(const BaseCPU *cpu)
+{
+    auto it = cpuIds.find(cpu);
+    if (it != cpuIds.end())
+        return it->second;
+
+    const uint32_t id = nextStringId++;
+    writeString(BinaryTraceRecord::String, id, cpu->name());
+    cpuIds.emplace(cpu, id);
+    return id;
+}
+
+uint32_t
+BinaryExeTracer::disasmId(const StaticInstPtr &inst, const PCStateBase &pc)
+{
+    const auto key = std::make_pair(inst->serial(), pc.instAddr());
+    auto it = disasmIds.find(key);
+    if (it != disasmIds.end())
+        return it->second;
+
+    const uint32_t id = nextStringId++;
+    writeString(BinaryTraceRecord::String, id,
+                disassemble(inst, pc, &loader::debugSymbolTable));
+    disasmIds.emplace(key, id);
+    return id;
+}
+
+uint32_t
+BinaryExeTracer::symbolId(Addr pc)
+{
+    auto it = symbolIds.find(pc);
+    if (it != symbolIds.end())
+        return it->second;
+
+    uint32_t id = 0;
+    auto sym = loader::debugSymbolTable.findNearest(pc);
+    if (sym != loader::debugSymbolTable.end()) {
+        Addr delta = pc - sym->address();
+        id = nextStringId++;
+        writeString(BinaryTraceRecord::String, id, delta ?
+                csprintf("@%s+%d", sym->name(), delta) :
+                csprintf("@%s", sym->name()));
+    }
+    symbolIds.emplace(pc, id);
+    return id;
+}
+
+void
+BinaryExeTracer::submitBuffer()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    fullBuffers.emplace_back(curBuffer, curRecords);
+    bufferReady.notify_one();
+
+    // Only stall if the writer has fallen a whole ring behind.
+    bufferFreed.wait(lock, [this]() { return !freeBuffers.empty(); });
+    curBuffer = freeBuffers.front();
+    freeBuffers.pop_front();
+    curRecords = 0;
+}
+
+void
+BinaryExeTracer::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        bufferReady.wait(lock, [this]() {
+            return stopping || !fullBuffers.empty();
+        });
+        if (fullBuffers.empty())
+            return;
+
+        const auto [idx, count] = fullBuffers.front();
+        fullBuffers.pop_front();
+
+        lock.unlock();
+        output->stream()->write((const char *)buffers[idx].data(),
+                                count * sizeof(BinaryTraceRecord));
+        lock.lock();
+
+        freeBuffers.push_back(idx);
+        bufferFreed.notify_one();
+    }
+}
+
+void
+BinaryExeTracer::close()
+{
+    if (!output)
+        return;
+
+    if (curRecords)
+        submitBuffer();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    bufferReady.notify_one();
+    writer.join();
+
+    simout.close(output);
+    output = nullptr;
+}
+
+} // namespace trace
+} // namespace gem5
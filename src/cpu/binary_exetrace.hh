@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_BINARY_EXETRACE_HH__
+#define __CPU_BINARY_EXETRACE_HH__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+#include "debug/ExecEnable.hh"
+#include "params/BinaryExeTracer.hh"
+#include "sim/insttracer.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+class OutputStream;
+class ThreadContext;
+
+namespace trace {
+
+class BinaryExeTracer;
+
+/**
+ * A fixed size record of the binary instruction trace. The file starts with
+ * a BinaryTraceHeader followed by a sequence of these records, all little
+ * endian. Strings (CPU names, disassembly, symbols and results which don't
+ * fit in 64 bits) are stored in String and Result records whose payload
+ * occupies the following records. Interned strings are defined by a String
+ * record before the first instruction which refers to them by id, the name
+ * of op class N having id N + 1; a Result record applies to the instruction
+ * immediately before it.
+ * util/decode_exe_trace.py renders a trace in the format of ExeTracer.
+ */
+struct BinaryTraceRecord
+{
+    enum Type : uint8_t
+    {
+        Inst = 0,
+        String = 1,
+        Result = 2,
+    };
+
+    enum Flags : uint8_t
+    {
+        /** The instruction executed, rather than being a macroop. */
+        Ran = 0x1,
+        Microop = 0x2,
+        PredicatedFalse = 0x4,
+        MemValid = 0x8,
+    };
+
+    uint64_t tick;
+    /** The PC, or the id of a String record. */
+    uint64_t pc;
+    /** The effective address of memory instructions. */
+    uint64_t addr;
+    /** The result, or the payload length of String and Result records. */
+    uint64_t data;
+    /** String ids of the CPU name, disassembly and symbol (0 if none). */
+    uint32_t cpu;
+    uint32_t disasm;
+    uint32_t symbol;
+    uint16_t upc;
+    uint16_t opClass;
+    uint32_t asid;
+    uint8_t thread;
+    /** An InstRecord::DataStatus value. */
+    uint8_t dataStatus;
+    uint8_t flags;
+    uint8_t type;
+};
+
+static_assert(sizeof(BinaryTraceRecord) == 56,
+              "The binary trace record layout changed.");
+
+struct BinaryTraceHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t tickFrequency;
+};
+
+class BinaryExeTracerRecord : public InstRecord
+{
+  public:
+    BinaryExeTracerRecord(Tick _when, ThreadContext *_thread,
+               const StaticInstPtr _staticInst, const PCStateBase &_pc,
+               BinaryExeTracer &_tracer,
+               const StaticInstPtr _macroStaticInst = NULL)
+        : InstRecord(_when, _thread, _staticInst, _pc, _macroStaticInst),
+          tracer(_tracer)
+    {}
+
+    void traceInst(const StaticInstPtr &inst, bool ran);
+
+    void dump() override;
+
+  protected:
+    BinaryExeTracer &tracer;
+};
+
+/**
+ * An instruction tracer recording the same information as ExeTracer in a
+ * compact binary form. Records are written into a ring of buffers which a
+ * background thread drains to the output file, so the simulation only
+ * stalls when the writer falls a whole ring behind. The file is compressed
+ * if its name ends in .gz.
+ */
+class BinaryExeTracer : public InstTracer
+{
+  public:
+    typedef BinaryExeTracerParams Params;
+    BinaryExeTracer(const Params &params);
+    ~BinaryExeTracer();
+
+    InstRecord *
+    getInstRecord(Tick when, ThreadContext *tc,
+            const StaticInstPtr staticInst, const PCStateBase &pc,
+            const StaticInstPtr macroStaticInst=nullptr) override
+    {
+        if (!debug::ExecEnable)
+            return NULL;
+
+        return new BinaryExeTracerRecord(when, tc,
+                staticInst, pc, *this, macroStaticInst);
+    }
+
+  protected:
+    friend class BinaryExeTracerRecord;
+
+    /** Get the next free record, handing full buffers to the writer. */
+    BinaryTraceRecord &allocRecord();
+
+    /** Append a string record with the given payload. */
+    void writeString(BinaryTraceRecord::Type type, uint64_t id,
+                     const std::string &str);
+
+    uint32_t cpuId(const BaseCPU *cpu);
+    uint32_t disasmId(const StaticInstPtr &inst, const PCStateBase &pc);
+    uint32_t symbolId(Addr pc);
+
+    /** Hand the current buffer to the writer thread. */
+    void submitBuffer();
+
+    void writerLoop();
+
+    /** Drain the ring and close the output file. */
+    void close();
+
+    struct DisasmKeyHash
+    {
+        size_t
+        operator()(const std::pair<uint64_t, Addr> &key) const
+        {
+            return std::hash<uint64_t>()(key.first) ^
+                   std::hash<Addr>()(key.second);
+        }
+    };
+
+    /**
+     * Instructions are named by StaticInst::serial() so the table holds no
+     * references to them. The disassembly depends on the PC, e.g. for
+     * branch targets.
+     */
+    std::unordered_map<std::pair<uint64_t, Addr>, uint32_t,
+                       DisasmKeyHash> disasmIds;
+    std::unordered_map<Addr, uint32_t> symbolIds;
+    std::unordered_map<const BaseCPU *, uint32_t> cpuIds;
+    uint32_t nextStringId;
+
+    OutputStream *output;
+
+    const size_t bufferRecords;
+    std::vector<std::vector<BinaryTraceRecord>> buffers;
+    /** The buffer being filled and the number of records in it. */
+    size_t curBuffer;
+    size_t curRecords;
+
+    /** Buffers waiting for the writer, with their record counts. */
+    std::deque<std::pair<size_t, size_t>> fullBuffers;
+    std::deque<size_t> freeBuffers;
+    bool stopping;
+    std::mutex mutex;
+    std::condition_variable bufferReady;
+    std::condition_variable bufferFreed;
+    std::thread writer;
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __CPU_BINARY_EXETRACE_HH__
@@ -127,6 +127,15 @@ class AddrMap
         recent[0] = recent[1] = chunkMap.end();
     }
 
+    AddrMap(const AddrMap &) = delete;
+    AddrMap &operator=(const AddrMap &) = delete;
+
+    ~AddrMap()
+    {
+        for (auto &chunk: chunkMap)
+            delete chunk.second;
+    }
+
     Value &
     lookup(Addr addr)
     {
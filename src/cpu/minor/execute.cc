@@ -882,6 +882,8 @@ Execute::doInstCommitAccounting(MinorDynInstPtr inst)
         inst->traceData->setCPSeq(thread->numOp);
 
     cpu.probeInstCommit(inst->staticInst, inst->pc->instAddr());
+    cpu.probeBranchCommit(inst->staticInst, thread->pcState(),
+                          inst->id.threadId);
 }
 
 bool
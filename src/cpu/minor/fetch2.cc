@@ -374,7 +374,7 @@ Fetch2::evaluate()
                 DPRINTF(Fetch, "Fault being passed output_index: "
                     "%d: %s\n", output_index, dyn_inst->fault->name());
             } else {
-                uint8_t *line = line_in->line;
+                const uint8_t *line = line_in->line;
 
                 /* The instruction is wholly in the line, can just copy. */
                 memcpy(decoder->moreBytesPtr(), line + fetch_info.inputIndex,
@@ -192,7 +192,7 @@ ForwardLineData::adoptPacketData(Packet *packet)
     assert(!isFault());
     assert(!line);
 
-    line = packet->getPtr<uint8_t>();
+    line = packet->getConstPtr<uint8_t>();
 }
 
 void
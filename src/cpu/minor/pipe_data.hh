@@ -215,7 +215,7 @@ class ForwardLineData /* : public ReportIF, public BubbleIF */
 
     /** Line data.  line[0] is the byte at address pc.instAddr().  Data is
      *  only valid upto lineWidth - 1. */
-    uint8_t *line = nullptr;
+    const uint8_t *line = nullptr;
 
     /** Packet from which the line is taken */
     Packet *packet = nullptr;
@@ -1169,6 +1169,7 @@ CPU::instDone(ThreadID tid, const DynInstPtr &inst)
     commitStats[tid]->numOpsNotNOP++;
 
     probeInstCommit(inst->staticInst, inst->pcState().instAddr());
+    probeBranchCommit(inst->staticInst, inst->pcState(), tid);
 }
 
 void
@@ -615,7 +615,7 @@ Fetch::finishTranslation(const Fault &fault, const RequestPtr &mem_req)
 
         // Build packet here.
         PacketPtr data_pkt = new Packet(mem_req, MemCmd::ReadReq);
-        data_pkt->dataDynamic(new uint8_t[fetchBufferSize]);
+        data_pkt->allocate();
 
         fetchBufferPC[tid] = fetchBufferBlockPC;
         fetchBufferValid[tid] = false;
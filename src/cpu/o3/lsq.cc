@@ -1316,15 +1316,9 @@ LSQ::SplitDataRequest::buildPackets()
             PacketPtr pkt = isLoad() ? Packet::createRead(req)
                                      : Packet::createWrite(req);
             ptrdiff_t offset = req->getVaddr() - base_address;
-            if (isLoad()) {
-                pkt->dataStatic(_inst->memData + offset);
-            } else {
-                uint8_t* req_data = new uint8_t[req->getSize()];
-                std::memcpy(req_data,
-                        _inst->memData + offset,
-                        req->getSize());
-                pkt->dataDynamic(req_data);
-            }
+            // the instruction outlives its packets, stores can use its
+            // data in place just like loads
+            pkt->dataStatic(_inst->memData + offset);
             pkt->senderState = this;
             _packets.push_back(pkt);
 
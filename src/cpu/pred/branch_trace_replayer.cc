@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace_replayer.hh"
+
+#include <zlib.h>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+#include "arch/generic/pcstate.hh"
+#include "base/logging.hh"
+#include "sim/byteswap.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+namespace
+{
+
+/** Records are read and replayed in chunks of this many. */
+constexpr size_t chunkRecords = 1 << 16;
+
+typedef GenericISA::SimplePCState<4> ReplayPCState;
+
+/**
+ * A control instruction standing in for a branch of the trace. It carries
+ * the flags the predictors look at and the size of the original
+ * instruction, which gives the fall through and return addresses.
+ */
+class ReplayBranchInst : public StaticInst
+{
+  public:
+    ReplayBranchInst(uint8_t trace_flags, uint8_t inst_size)
+        : StaticInst("replayed branch", No_OpClass)
+    {
+        flags[IsControl] = true;
+        flags[IsCall] = trace_flags & BranchTraceRecord::Call;
+        flags[IsReturn] = trace_flags & BranchTraceRecord::Return;
+        flags[IsDirectControl] = trace_flags & BranchTraceRecord::Direct;
+        flags[IsIndirectControl] = trace_flags & BranchTraceRecord::Indirect;
+        flags[IsCondControl] = trace_flags & BranchTraceRecord::Cond;
+        flags[IsUncondControl] = trace_flags & BranchTraceRecord::Uncond;
+        size(inst_size);
+    }
+
+    Fault
+    execute(ExecContext *xc, trace::InstRecord *traceData) const override
+    {
+        panic("Replayed branches can't be executed.");
+    }
+
+    void
+    advancePC(PCStateBase &pc) const override
+    {
+        pc.as<ReplayPCState>().set(pc.instAddr() + size());
+    }
+
+    std::unique_ptr<PCStateBase>
+    buildRetPC(const PCStateBase &cur_pc,
+            const PCStateBase &call_pc) const override
+    {
+        std::unique_ptr<PCStateBase> ret_pc(call_pc.clone());
+        advancePC(*ret_pc);
+        return ret_pc;
+    }
+
+    std::string
+    generateDisassembly(Addr pc,
+            const loader::SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+};
+
+} // anonymous namespace
+
+BranchTraceReplayer::BranchTraceReplayer(
+        const BranchTraceReplayerParams &p)
+    : SimObject(p),
+      predictors(p.predictors),
+      traceFile(p.trace_file),
+      numThreads(p.numThreads),
+      chunkInsts(chunkRecords),
+      replayEvent([this]{ replay(); }, name()),
+      stats(this)
+{
+    fatal_if(predictors.empty(), "%s: No branch predictors to replay the "
+             "trace through.\n", name());
+
+    // Name the per predictor stats after the predictors.
+    for (unsigned i = 0; i < predictors.size(); i++) {
+        const std::string &bp_name = predictors[i]->name();
+        const std::string subname = bp_name.substr(bp_name.rfind('.') + 1);
+        stats.mispredicts.subname(i, subname);
+        stats.condMispredicts.subname(i, subname);
+    }
+}
+
+void
+BranchTraceReplayer::startup()
+{
+    schedule(replayEvent, curTick());
+}
+
+const StaticInstPtr &
+BranchTraceReplayer::branchInst(uint8_t flags, uint8_t size)
+{
+    flags &= ~BranchTraceRecord::Taken;
+    StaticInstPtr &inst = branchInsts[flags << 8 | size];
+    if (!inst)
+        inst = new ReplayBranchInst(flags, size);
+    return inst;
+}
+
+void
+BranchTraceReplayer::replay()
+{
+    gzFile trace = gzopen(traceFile.c_str(), "rb");
+    fatal_if(!trace, "%s: Unable to open branch trace %s.\n",
+             name(), traceFile);
+
+    BranchTraceHeader header;
+    fatal_if(gzread(trace, &header, sizeof(header)) != sizeof(header) ||
+             std::memcmp(header.magic, "gem5btr", sizeof(header.magic)),
+             "%s: %s is not a branch trace.\n", name(), traceFile);
+    fatal_if(letoh(header.version) != 1 ||
+             letoh(header.recordSize) != sizeof(BranchTraceRecord),
+             "%s: Unsupported branch trace version %d.\n",
+             name(), letoh(header.version));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<BranchTraceRecord> records(chunkRecords);
+    InstSeqNum seq_num = 1;
+    uint64_t num_branches = 0;
+    while (true) {
+        const int bytes = gzread(trace, records.data(),
+                                 chunkRecords * sizeof(BranchTraceRecord));
+        fatal_if(bytes < 0, "%s: Error reading branch trace %s.\n",
+                 name(), traceFile);
+        const size_t num_records = bytes / sizeof(BranchTraceRecord);
+        if (!num_records)
+            break;
+
+        for (size_t i = 0; i < num_records; i++) {
+            const BranchTraceRecord &record = records[i];
+            stats.insts += letoh(record.insts);
+            if (!(record.flags & BranchTraceRecord::Control))
+                continue;
+
+            fatal_if(record.thread >= numThreads, "%s: Branch trace has "
+                     "records of thread %d, but numThreads is %d.\n",
+                     name(), record.thread, numThreads);
+            chunkInsts[i] = &branchInst(record.flags, record.size);
+            num_branches++;
+            if (record.flags & BranchTraceRecord::Cond)
+                stats.condBranches++;
+        }
+
+        // Replay the chunk through one predictor at a time so its tables
+        // stay in the host caches.
+        for (unsigned idx = 0; idx < predictors.size(); idx++)
+            replayRecords(idx, records.data(), num_records, seq_num);
+        seq_num += num_records;
+    }
+    gzclose(trace);
+    stats.branches += num_branches;
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    inform("%s: Replayed %d branches through %d predictors in %.2fs.\n",
+           name(), num_branches, predictors.size(), elapsed.count());
+
+    exitSimLoop("branch trace replay complete");
+}
+
+void
+BranchTraceReplayer::replayRecords(unsigned idx,
+        const BranchTraceRecord *records, size_t num_records,
+        InstSeqNum seq_num)
+{
+    BPredUnit *bpred = predictors[idx];
+    ReplayPCState pc;
+
+    for (size_t i = 0; i < num_records; i++, seq_num++) {
+        const BranchTraceRecord &record = records[i];
+        if (!(record.flags & BranchTraceRecord::Control))
+            continue;
+
+        const ThreadID tid = record.thread;
+        const Addr target = letoh(record.target);
+        const bool taken = record.flags & BranchTraceRecord::Taken;
+
+        pc.set(letoh(record.pc));
+        const bool pred_taken =
+            bpred->predict(*chunkInsts[i], seq_num, pc, tid);
+
+        if (pred_taken != taken || pc.instAddr() != target) {
+            stats.mispredicts[idx]++;
+            if (record.flags & BranchTraceRecord::Cond &&
+                    pred_taken != taken) {
+                stats.condMispredicts[idx]++;
+            }
+            bpred->squash(seq_num, ReplayPCState(target), taken, tid);
+        }
+        bpred->update(seq_num, tid);
+    }
+}
+
+BranchTraceReplayer::ReplayerStats::ReplayerStats(
+        BranchTraceReplayer *replayer)
+    : statistics::Group(replayer),
+      ADD_STAT(insts, statistics::units::Count::get(),
+               "Number of instructions in the trace"),
+      ADD_STAT(branches, statistics::units::Count::get(),
+               "Number of branches replayed"),
+      ADD_STAT(condBranches, statistics::units::Count::get(),
+               "Number of conditional branches replayed"),
+      ADD_STAT(mispredicts, statistics::units::Count::get(),
+               "Number of mispredicted branches (direction or target)"),
+      ADD_STAT(condMispredicts, statistics::units::Count::get(),
+               "Number of conditional branches with a mispredicted "
+               "direction"),
+      ADD_STAT(mpki, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Count>::get(),
+               "Mispredictions per kilo instruction",
+               mispredicts * 1000 / insts)
+{
+    mispredicts.init(replayer->predictors.size());
+    condMispredicts.init(replayer->predictors.size());
+}
+
+} // namespace branch_prediction
+} // namespace gem5
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_REPLAYER_HH__
+#define __CPU_PRED_BRANCH_TRACE_REPLAYER_HH__
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "cpu/probes/branch_trace.hh"
+#include "cpu/static_inst.hh"
+#include "params/BranchTraceReplayer.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * Replays a branch trace written by a BranchTraceRecorder through a set of
+ * branch predictors, without simulating a CPU, and reports the
+ * mispredictions per kilo instruction of each. Every branch is predicted,
+ * corrected if mispredicted and committed before the next one is
+ * predicted, so the predictors see the committed path with immediate
+ * updates. The simulation exits once the whole trace has been replayed.
+ */
+class BranchTraceReplayer : public SimObject
+{
+  public:
+    BranchTraceReplayer(const BranchTraceReplayerParams &params);
+
+    void startup() override;
+
+  private:
+    /** Replay the whole trace and exit the simulation loop. */
+    void replay();
+
+    /** Replay a chunk of records through one predictor. */
+    void replayRecords(unsigned idx, const BranchTraceRecord *records,
+                       size_t num_records, InstSeqNum seq_num);
+
+    /**
+     * Get the instruction replaying branches with the given trace flags and
+     * size.
+     */
+    const StaticInstPtr &branchInst(uint8_t flags, uint8_t size);
+
+    const std::vector<BPredUnit *> predictors;
+    const std::string traceFile;
+    const unsigned numThreads;
+
+    /** Replayed branch instructions, indexed by trace flags and size. */
+    std::array<StaticInstPtr, 1 << 16> branchInsts;
+
+    /** The instruction of each record in the chunk being replayed. */
+    std::vector<const StaticInstPtr *> chunkInsts;
+
+    EventFunctionWrapper replayEvent;
+
+    struct ReplayerStats : public statistics::Group
+    {
+        ReplayerStats(BranchTraceReplayer *replayer);
+
+        statistics::Scalar insts;
+        statistics::Scalar branches;
+        statistics::Scalar condBranches;
+        /** Stats per predictor */
+        statistics::Vector mispredicts;
+        statistics::Vector condMispredicts;
+        statistics::Formula mpki;
+    } stats;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_REPLAYER_HH__
@@ -105,6 +105,10 @@ TAGEBase::init()
 
     assert(histBufferSize > maxHist * 2);
 
+    // The tag hits of all the tables are collected in a 64 bit mask
+    fatal_if(nHistoryTables > 63,
+             "%s: At most 63 history tables are supported.\n", name());
+
     useAltPredForNewlyAllocated.resize(numUseAltOnNa, 0);
 
     for (auto& history : threadHistory) {
@@ -127,9 +131,9 @@ TAGEBase::init()
     assert(tagTableTagWidths[0] == 0);
 
     for (auto& history : threadHistory) {
-        history.computeIndices = new FoldedHistory[nHistoryTables+1];
-        history.computeTags[0] = new FoldedHistory[nHistoryTables+1];
-        history.computeTags[1] = new FoldedHistory[nHistoryTables+1];
+        history.computeIndices.resize(nHistoryTables+1);
+        history.computeTags[0].resize(nHistoryTables+1);
+        history.computeTags[1].resize(nHistoryTables+1);
 
         initFoldedHistories(history);
     }
@@ -144,6 +148,14 @@ TAGEBase::init()
 
     tableIndices = new int [nHistoryTables+1];
     tableTags = new int [nHistoryTables+1];
+    readTags.resize(nHistoryTables+1);
+
+    noSkipMask = 0;
+    for (int i = 1; i <= nHistoryTables; i++) {
+        if (noSkip[i]) {
+            noSkipMask |= 1ULL << i;
+        }
+    }
     initialized = true;
 }
 
@@ -151,12 +163,13 @@ void
 TAGEBase::initFoldedHistories(ThreadHistory & history)
 {
     for (int i = 1; i <= nHistoryTables; i++) {
-        history.computeIndices[i].init(
-            histLengths[i], (logTagTableSizes[i]));
-        history.computeTags[0][i].init(
-            history.computeIndices[i].origLength, tagTableTagWidths[i]);
-        history.computeTags[1][i].init(
-            history.computeIndices[i].origLength, tagTableTagWidths[i]-1);
+        history.computeIndices.init(
+            i, histLengths[i], (logTagTableSizes[i]));
+        history.computeTags[0].init(
+            i, history.computeIndices.origLength[i], tagTableTagWidths[i]);
+        history.computeTags[1].init(
+            i, history.computeIndices.origLength[i],
+            tagTableTagWidths[i]-1);
         DPRINTF(Tage, "HistLength:%d, TTSize:%d, TTTWidth:%d\n",
                 histLengths[i], logTagTableSizes[i], tagTableTagWidths[i]);
     }
@@ -192,14 +205,12 @@ TAGEBase::btbUpdate(ThreadID tid, Addr branch_pc, BranchInfo* &bi)
         DPRINTF(Tage, "BTB miss resets prediction: %lx\n", branch_pc);
         assert(tHist.gHist == &tHist.globalHistory[tHist.ptGhist]);
         tHist.gHist[0] = 0;
-        for (int i = 1; i <= nHistoryTables; i++) {
-            tHist.computeIndices[i].comp = bi->ci[i];
-            tHist.computeTags[0][i].comp = bi->ct0[i];
-            tHist.computeTags[1][i].comp = bi->ct1[i];
-            tHist.computeIndices[i].update(tHist.gHist);
-            tHist.computeTags[0][i].update(tHist.gHist);
-            tHist.computeTags[1][i].update(tHist.gHist);
-        }
+        tHist.computeIndices.restore(bi->ci);
+        tHist.computeTags[0].restore(bi->ct0);
+        tHist.computeTags[1].restore(bi->ct1);
+        tHist.computeIndices.update(tHist.gHist);
+        tHist.computeTags[0].update(tHist.gHist);
+        tHist.computeTags[1].update(tHist.gHist);
     }
 }
 
@@ -236,7 +247,7 @@ TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
     index =
         shiftedPc ^
         (shiftedPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
-        threadHistory[tid].computeIndices[bank].comp ^
+        threadHistory[tid].computeIndices.comp[bank] ^
         F(threadHistory[tid].pathHist, hlen, bank);
 
     return (index & ((1ULL << (logTagTableSizes[bank])) - 1));
@@ -248,8 +259,8 @@ uint16_t
 TAGEBase::gtag(ThreadID tid, Addr pc, int bank) const
 {
     int tag = (pc >> instShiftAmt) ^
-              threadHistory[tid].computeTags[0][bank].comp ^
-              (threadHistory[tid].computeTags[1][bank].comp << 1);
+              threadHistory[tid].computeTags[0].comp[bank] ^
+              (threadHistory[tid].computeTags[1].comp[bank] << 1);
 
     return (tag & ((1ULL << tagTableTagWidths[bank]) - 1));
 }
@@ -370,25 +381,16 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
 
         bi->bimodalIndex = bindex(pc);
 
-        bi->hitBank = 0;
-        bi->altBank = 0;
-        //Look for the bank with longest matching history
-        for (int i = nHistoryTables; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->hitBank = i;
-                bi->hitBankIndex = tableIndices[bi->hitBank];
-                break;
-            }
+        //Look for the bank with longest matching history, then for the
+        //alternate bank, among the banks whose tag matches
+        hitBanks(tagHits(gtable, tableIndices, tableTags, nHistoryTables,
+                         noSkipMask, readTags.data()),
+                 bi->hitBank, bi->altBank);
+        if (bi->hitBank > 0) {
+            bi->hitBankIndex = tableIndices[bi->hitBank];
         }
-        //Look for the alternate bank
-        for (int i = bi->hitBank - 1; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->altBank = i;
-                bi->altBankIndex = tableIndices[bi->altBank];
-                break;
-            }
+        if (bi->altBank > 0) {
+            bi->altBankIndex = tableIndices[bi->altBank];
         }
         //computes the prediction and the alternate prediction
         if (bi->hitBank > 0) {
@@ -607,17 +609,14 @@ TAGEBase::updateHistories(ThreadID tid, Addr branch_pc, bool taken,
     }
 
     //prepare next index and tag computations for user branchs
-    for (int i = 1; i <= nHistoryTables; i++)
-    {
-        if (speculative) {
-            bi->ci[i]  = tHist.computeIndices[i].comp;
-            bi->ct0[i] = tHist.computeTags[0][i].comp;
-            bi->ct1[i] = tHist.computeTags[1][i].comp;
-        }
-        tHist.computeIndices[i].update(tHist.gHist);
-        tHist.computeTags[0][i].update(tHist.gHist);
-        tHist.computeTags[1][i].update(tHist.gHist);
+    if (speculative) {
+        tHist.computeIndices.save(bi->ci);
+        tHist.computeTags[0].save(bi->ct0);
+        tHist.computeTags[1].save(bi->ct1);
     }
+    tHist.computeIndices.update(tHist.gHist);
+    tHist.computeTags[0].update(tHist.gHist);
+    tHist.computeTags[1].update(tHist.gHist);
     DPRINTF(Tage, "Updating global histories with branch:%lx; taken?:%d, "
             "path Hist: %x; pointer:%d\n", branch_pc, taken, tHist.pathHist,
             tHist.ptGhist);
@@ -641,14 +640,12 @@ TAGEBase::squash(ThreadID tid, bool taken, TAGEBase::BranchInfo *bi,
     tHist.ptGhist = bi->ptGhist;
     tHist.gHist = &(tHist.globalHistory[tHist.ptGhist]);
     tHist.gHist[0] = (taken ? 1 : 0);
-    for (int i = 1; i <= nHistoryTables; i++) {
-        tHist.computeIndices[i].comp = bi->ci[i];
-        tHist.computeTags[0][i].comp = bi->ct0[i];
-        tHist.computeTags[1][i].comp = bi->ct1[i];
-        tHist.computeIndices[i].update(tHist.gHist);
-        tHist.computeTags[0][i].update(tHist.gHist);
-        tHist.computeTags[1][i].update(tHist.gHist);
-    }
+    tHist.computeIndices.restore(bi->ci);
+    tHist.computeTags[0].restore(bi->ct0);
+    tHist.computeTags[1].restore(bi->ct1);
+    tHist.computeIndices.update(tHist.gHist);
+    tHist.computeTags[0].update(tHist.gHist);
+    tHist.computeTags[1].update(tHist.gHist);
 }
 
 void
@@ -48,8 +48,10 @@
 #ifndef __CPU_PRED_TAGE_BASE_HH__
 #define __CPU_PRED_TAGE_BASE_HH__
 
+#include <algorithm>
 #include <vector>
 
+#include "base/bitfield.hh"
 #include "base/statistics.hh"
 #include "cpu/null_static_inst.hh"
 #include "cpu/static_inst.hh"
@@ -80,35 +82,62 @@ class TAGEBase : public SimObject
         TageEntry() : ctr(0), tag(0), u(0) { }
     };
 
-    // Folded History Table - compressed history
+    // Folded History Tables - compressed histories
     // to mix with instruction PC to index partially
-    // tagged tables.
-    struct FoldedHistory
+    // tagged tables. The histories of all the tables
+    // are kept in a structure of arrays, so that they
+    // are all updated in one branch free loop which
+    // the compiler can vectorize.
+    struct FoldedHistories
     {
-        unsigned comp;
-        int compLength;
-        int origLength;
-        int outpoint;
-        int bufferSize;
+        std::vector<unsigned> comp;
+        std::vector<int> compLength;
+        std::vector<int> origLength;
+        std::vector<int> outpoint;
+        std::vector<unsigned> mask;
+
+        /**
+         * Allocates the histories of n tables. A history which isn't
+         * initialized with init() stays 0.
+         */
+        void resize(size_t n)
+        {
+            comp.assign(n, 0);
+            compLength.assign(n, 0);
+            origLength.assign(n, 0);
+            outpoint.assign(n, 0);
+            mask.assign(n, 0);
+        }
+
+        void init(int i, int original_length, int compressed_length)
+        {
+            origLength[i] = original_length;
+            compLength[i] = compressed_length;
+            outpoint[i] = original_length % compressed_length;
+            mask[i] = (1ULL << compressed_length) - 1;
+        }
 
-        FoldedHistory()
+        void update(const uint8_t * h)
         {
-            comp = 0;
+            const unsigned h0 = h[0];
+            for (size_t i = 0; i < comp.size(); i++) {
+                unsigned c = (comp[i] << 1) | h0;
+                c ^= unsigned(h[origLength[i]]) << outpoint[i];
+                c ^= (c >> compLength[i]);
+                comp[i] = c & mask[i];
+            }
         }
 
-        void init(int original_length, int compressed_length)
+        /** Saves the folded histories to a checkpoint array. */
+        void save(int *dst) const
         {
-            origLength = original_length;
-            compLength = compressed_length;
-            outpoint = original_length % compressed_length;
+            std::copy(comp.begin(), comp.end(), dst);
         }
 
-        void update(uint8_t * h)
+        /** Restores the folded histories from a checkpoint array. */
+        void restore(const int *src)
         {
-            comp = (comp << 1) | h[0];
-            comp ^= h[origLength] << outpoint;
-            comp ^= (comp >> compLength);
-            comp &= (1ULL << compLength) - 1;
+            std::copy(src, src + comp.size(), comp.begin());
         }
     };
 
@@ -366,6 +395,42 @@ class TAGEBase : public SimObject
     virtual void calculateIndicesAndTags(
         ThreadID tid, Addr branch_pc, BranchInfo* bi);
 
+    /**
+     * Compares the tags computed by calculateIndicesAndTags with the
+     * tags of the indexed entries of tables 1 to n.
+     * @param enabled Mask of the tables which may hit.
+     * @param read_tags Scratch space for n+1 tags.
+     * @return A mask with bit i set if table i hits.
+     */
+    static uint64_t
+    tagHits(TageEntry *const *gtable, const int *indices, const int *tags,
+            int n, uint64_t enabled, int *read_tags)
+    {
+        // Gather the tags first so that the compares are done in a
+        // separate, branch free loop which the compiler can vectorize.
+        for (int i = 1; i <= n; i++) {
+            read_tags[i] = gtable[i][indices[i]].tag;
+        }
+        uint64_t hits = 0;
+        for (int i = 1; i <= n; i++) {
+            hits |= uint64_t(read_tags[i] == tags[i]) << i;
+        }
+        return hits & enabled;
+    }
+
+    /**
+     * Finds the bank with the longest matching history and the
+     * alternate bank, the next longest one, in a mask of tag hits.
+     * Either is 0 if there is no such bank.
+     */
+    static void
+    hitBanks(uint64_t hits, int &hit_bank, int &alt_bank)
+    {
+        hit_bank = hits ? findMsbSet(hits) : 0;
+        hits &= ~(1ULL << hit_bank);
+        alt_bank = hits ? findMsbSet(hits) : 0;
+    }
+
     /**
      * Calculation of the index for useAltPredForNewlyAllocated
      * On this base TAGE implementation it is always 0
@@ -457,8 +522,8 @@ class TAGEBase : public SimObject
         int ptGhist;
 
         // Speculative folded histories.
-        FoldedHistory *computeIndices;
-        FoldedHistory *computeTags[2];
+        FoldedHistories computeIndices;
+        FoldedHistories computeTags[2];
     };
 
     std::vector<ThreadHistory> threadHistory;
@@ -471,6 +536,8 @@ class TAGEBase : public SimObject
     int *histLengths;
     int *tableIndices;
     int *tableTags;
+    /** Tags read from the indexed entries, see tagHits(). */
+    std::vector<int> readTags;
 
     std::vector<int8_t> useAltPredForNewlyAllocated;
     int64_t tCounter;
@@ -484,6 +551,8 @@ class TAGEBase : public SimObject
     // (for the base TAGE implementation all are active)
     // Some other classes use this for handling associativity
     std::vector<bool> noSkip;
+    /** noSkip as a bit mask of the enabled tables. */
+    uint64_t noSkipMask;
 
     const bool speculativeHistUpdate;
 
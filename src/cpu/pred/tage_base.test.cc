@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "cpu/pred/tage_base.hh"
+
+using namespace gem5;
+using namespace gem5::branch_prediction;
+
+namespace
+{
+
+/** Exposes the building blocks of TAGEBase under test. */
+class TAGETest : public TAGEBase
+{
+  public:
+    using TAGEBase::FoldedHistories;
+    using TAGEBase::TageEntry;
+    using TAGEBase::tagHits;
+    using TAGEBase::hitBanks;
+};
+
+/** The folded history of a single table, as TAGEBase used to keep it. */
+struct RefFoldedHistory
+{
+    unsigned comp = 0;
+    int compLength;
+    int origLength;
+    int outpoint;
+
+    void
+    init(int original_length, int compressed_length)
+    {
+        origLength = original_length;
+        compLength = compressed_length;
+        outpoint = original_length % compressed_length;
+    }
+
+    void
+    update(uint8_t *h)
+    {
+        comp = (comp << 1) | h[0];
+        comp ^= h[origLength] << outpoint;
+        comp ^= (comp >> compLength);
+        comp &= (1ULL << compLength) - 1;
+    }
+};
+
+/** The geometric history lengths and table sizes of the default TAGE. */
+constexpr int numTables = 7;
+constexpr int histLengths[numTables + 1] = {0, 5, 9, 15, 25, 44, 76, 130};
+constexpr int logTableSizes[numTables + 1] = {13, 9, 9, 9, 9, 9, 9, 9};
+constexpr int tagWidths[numTables + 1] = {0, 8, 8, 8, 8, 8, 12, 12};
+
+} // anonymous namespace
+
+/**
+ * Feed a random branch stream, with speculative updates that are later
+ * squashed, to the folded histories and to the single table histories
+ * they replaced, and check that they always agree.
+ */
+TEST(TAGEBaseTest, FoldedHistoriesMatchPerTableHistories)
+{
+    std::mt19937 rng(1);
+    std::vector<uint8_t> buffer(4096);
+    int pt = buffer.size() - histLengths[numTables] - 1;
+
+    TAGETest::FoldedHistories indices, tags[2];
+    std::vector<RefFoldedHistory> ref_indices(numTables + 1);
+    std::vector<RefFoldedHistory> ref_tags[2] = {
+        std::vector<RefFoldedHistory>(numTables + 1),
+        std::vector<RefFoldedHistory>(numTables + 1)};
+
+    indices.resize(numTables + 1);
+    tags[0].resize(numTables + 1);
+    tags[1].resize(numTables + 1);
+    for (int i = 1; i <= numTables; i++) {
+        indices.init(i, histLengths[i], logTableSizes[i]);
+        tags[0].init(i, histLengths[i], tagWidths[i]);
+        tags[1].init(i, histLengths[i], tagWidths[i] - 1);
+        ref_indices[i].init(histLengths[i], logTableSizes[i]);
+        ref_tags[0][i].init(histLengths[i], tagWidths[i]);
+        ref_tags[1][i].init(histLengths[i], tagWidths[i] - 1);
+    }
+
+    auto check = [&](int step) {
+        for (int i = 1; i <= numTables; i++) {
+            ASSERT_EQ(indices.comp[i], ref_indices[i].comp)
+                << "table " << i << " at step " << step;
+            ASSERT_EQ(tags[0].comp[i], ref_tags[0][i].comp)
+                << "table " << i << " at step " << step;
+            ASSERT_EQ(tags[1].comp[i], ref_tags[1][i].comp)
+                << "table " << i << " at step " << step;
+        }
+    };
+
+    auto push = [&](bool taken) {
+        if (pt == 0) {
+            // Wrap around the history buffer the way TAGEBase does.
+            std::copy(buffer.begin(), buffer.begin() + histLengths[numTables],
+                      buffer.end() - histLengths[numTables]);
+            pt = buffer.size() - histLengths[numTables];
+        }
+        uint8_t *h = &buffer[--pt];
+        h[0] = taken;
+        indices.update(h);
+        tags[0].update(h);
+        tags[1].update(h);
+        for (int i = 1; i <= numTables; i++) {
+            ref_indices[i].update(h);
+            ref_tags[0][i].update(h);
+            ref_tags[1][i].update(h);
+        }
+    };
+
+    std::vector<int> ci(numTables + 1), ct0(numTables + 1),
+        ct1(numTables + 1);
+    for (int step = 0; step < 100000; step++) {
+        if (rng() % 8) {
+            push(rng() % 2);
+            check(step);
+            continue;
+        }
+
+        // Checkpoint, go down a wrong path and squash back to the
+        // checkpoint with the correct direction.
+        const int saved_pt = pt;
+        indices.save(ci.data());
+        tags[0].save(ct0.data());
+        tags[1].save(ct1.data());
+        const bool taken = rng() % 2;
+        push(!taken);
+        for (int i = rng() % 4; i > 0; i--)
+            push(rng() % 2);
+
+        if (saved_pt < pt)
+            continue; // The buffer wrapped, don't rewind across it.
+        pt = saved_pt;
+        indices.restore(ci.data());
+        tags[0].restore(ct0.data());
+        tags[1].restore(ct1.data());
+        for (int i = 1; i <= numTables; i++) {
+            ref_indices[i].comp = ci[i];
+            ref_tags[0][i].comp = ct0[i];
+            ref_tags[1][i].comp = ct1[i];
+        }
+        push(taken);
+        check(step);
+    }
+}
+
+/**
+ * Look up random tables with the tag hit mask and with the two searches
+ * it replaced, and check that they find the same banks.
+ */
+TEST(TAGEBaseTest, TagHitsMatchLinearSearch)
+{
+    constexpr int entries = 16;
+    std::mt19937 rng(2);
+
+    std::vector<std::vector<TAGETest::TageEntry>> tables(
+        numTables + 1, std::vector<TAGETest::TageEntry>(entries));
+    std::vector<TAGETest::TageEntry *> gtable(numTables + 1);
+    for (int i = 1; i <= numTables; i++)
+        gtable[i] = tables[i].data();
+
+    std::vector<int> indices(numTables + 1), tags(numTables + 1),
+        read_tags(numTables + 1);
+    std::vector<bool> no_skip(numTables + 1);
+
+    int hits_seen = 0, alts_seen = 0;
+    for (int step = 0; step < 100000; step++) {
+        uint64_t enabled = 0;
+        for (int i = 1; i <= numTables; i++) {
+            // Few distinct tags, so that most lookups hit somewhere.
+            for (auto &entry : tables[i])
+                entry.tag = rng() % 4;
+            indices[i] = rng() % entries;
+            tags[i] = rng() % 4;
+            no_skip[i] = rng() % 4;
+            if (no_skip[i])
+                enabled |= 1ULL << i;
+        }
+
+        int ref_hit = 0, ref_alt = 0;
+        for (int i = numTables; i > 0; i--) {
+            if (no_skip[i] && gtable[i][indices[i]].tag == tags[i]) {
+                ref_hit = i;
+                break;
+            }
+        }
+        for (int i = ref_hit - 1; i > 0; i--) {
+            if (no_skip[i] && gtable[i][indices[i]].tag == tags[i]) {
+                ref_alt = i;
+                break;
+            }
+        }
+
+        int hit, alt;
+        TAGETest::hitBanks(
+            TAGETest::tagHits(gtable.data(), indices.data(), tags.data(),
+                              numTables, enabled, read_tags.data()),
+            hit, alt);
+        ASSERT_EQ(hit, ref_hit) << "at step " << step;
+        ASSERT_EQ(alt, ref_alt) << "at step " << step;
+        hits_seen += hit > 0;
+        alts_seen += alt > 0;
+    }
+
+    // Both searches were exercised.
+    EXPECT_GT(hits_seen, 0);
+    EXPECT_GT(alts_seen, 0);
+}
@@ -0,0 +1,103 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects import SimObject
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+
+
+class LoopPointProfilerManager(SimObject):
+    """Global state of LoopPoint profiling of a multi-threaded workload.
+    Execution is split into regions of about region_length instructions,
+    summed over all threads, which start and end on loop entries. For every
+    region a global basic block vector is written to bb_file, in the SimPoint
+    format, and its start and end markers (PC and global execution count) to
+    markers_file. The last region runs to the end of the program and has no
+    end marker. Cluster the BBVs with SimPoint and load the result with
+    gem5.resources.looppoint.LooppointMarkersLoader to simulate the
+    representative regions.
+
+    Instructions in synchronization code aren't counted. Functions are
+    excluded by name prefix (exclude_symbols) or by address
+    (exclude_ranges). Optionally, short loops which don't store anything
+    are treated as spin loops when they repeat (spin_max_insts).
+    """
+
+    type = "LoopPointProfilerManager"
+    cxx_header = "cpu/probes/looppoint_profiler.hh"
+    cxx_class = "gem5::LoopPointProfilerManager"
+
+    region_length = Param.UInt64(
+        100000000, "Region length in instructions summed over all threads"
+    )
+    # Loops that only read memory, like a search or a reduction kept in
+    # registers, look the same as spin loops to the filter, so it is only
+    # safe to use when the workload has no such short loops.
+    spin_max_insts = Param.UInt64(
+        0,
+        "Maximum instructions in an iteration of a spin loop, "
+        "0 to only filter excluded code",
+    )
+    exclude_symbols = VectorParam.String(
+        [
+            "gomp_barrier_",
+            "gomp_team_barrier_",
+            "gomp_mutex_",
+            "gomp_sem_",
+            "do_spin",
+            "do_wait",
+            "futex_wait",
+            "pthread_mutex_",
+            "pthread_spin_",
+            "pthread_barrier_",
+            "pthread_cond_",
+            "__lll_lock",
+        ],
+        "Name prefixes of synchronization functions to exclude",
+    )
+    exclude_ranges = VectorParam.AddrRange(
+        [], "Address ranges of synchronization code to exclude"
+    )
+    marker_ranges = VectorParam.AddrRange(
+        [], "Address ranges to place region markers in, empty for any"
+    )
+    bb_file = Param.String("looppoint.bb.gz", "Global BBV (output) file")
+    markers_file = Param.String(
+        "looppoint.markers", "Region markers (output) file"
+    )
+
+
+class LoopPointProfiler(ProbeListenerObject):
+    """Profiles the instructions committed by one core for LoopPoint. Set
+    manager to the core and lpmanager to the LoopPointProfilerManager shared
+    by all cores.
+    """
+
+    type = "LoopPointProfiler"
+    cxx_header = "cpu/probes/looppoint_profiler.hh"
+    cxx_class = "gem5::LoopPointProfiler"
+
+    lpmanager = Param.LoopPointProfilerManager("The LoopPoint manager")
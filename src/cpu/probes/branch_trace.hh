@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_BRANCH_TRACE_HH__
+#define __CPU_PROBES_BRANCH_TRACE_HH__
+
+#include <cstdint>
+
+namespace gem5
+{
+
+/**
+ * A fixed size record of a branch trace. The file starts with a
+ * BranchTraceHeader followed by a sequence of these records, all little
+ * endian. A record without the Control flag carries no branch and only
+ * accounts for the instructions committed after the last branch.
+ */
+struct BranchTraceRecord
+{
+    enum Flags : uint8_t
+    {
+        Control = 0x1,
+        Taken = 0x2,
+        Call = 0x4,
+        Return = 0x8,
+        Direct = 0x10,
+        Indirect = 0x20,
+        Cond = 0x40,
+        Uncond = 0x80,
+    };
+
+    /** The PC of the branch. */
+    uint64_t pc;
+    /** The PC of the instruction which followed the branch. */
+    uint64_t target;
+    /**
+     * The number of instructions committed since the previous record,
+     * including this branch.
+     */
+    uint32_t insts;
+    uint8_t flags;
+    /** The size of the branch instruction in bytes. */
+    uint8_t size;
+    uint8_t thread;
+    uint8_t pad;
+};
+
+static_assert(sizeof(BranchTraceRecord) == 24,
+              "The branch trace record layout changed.");
+
+struct BranchTraceHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_BRANCH_TRACE_HH__
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/branch_trace_recorder.hh"
+
+#include <cstring>
+#include <limits>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/byteswap.hh"
+#include "sim/core.hh"
+
+namespace gem5
+{
+
+BranchTraceRecorder::BranchTraceRecorder(const BranchTraceRecorderParams &p)
+    : ProbeListenerObject(p),
+      output(nullptr),
+      buffer(p.buffer_records),
+      numBuffered(0),
+      instsSinceRecord(0)
+{
+    fatal_if(buffer.empty(), "%s: buffer_records must be non-zero.\n",
+             name());
+
+    const std::string file_name =
+        p.file_name.empty() ? name() + ".trace.gz" : p.file_name;
+    output = simout.create(file_name, true);
+    fatal_if(!output, "%s: unable to open branch trace %s.\n",
+             name(), file_name);
+
+    BranchTraceHeader header = {};
+    std::memcpy(header.magic, "gem5btr", sizeof(header.magic));
+    header.version = htole<uint32_t>(1);
+    header.recordSize = htole<uint32_t>(sizeof(BranchTraceRecord));
+    output->stream()->write((const char *)&header, sizeof(header));
+
+    // get a callback when we exit so we can close the file
+    registerExitCallback([this]() { close(); });
+}
+
+BranchTraceRecorder::~BranchTraceRecorder()
+{
+    close();
+}
+
+void
+BranchTraceRecorder::regProbeListeners()
+{
+    typedef ProbeListenerArg<BranchTraceRecorder, uint64_t> InstListener;
+    typedef ProbeListenerArg<BranchTraceRecorder, BaseCPU::RetiredBranchInfo>
+        BranchListener;
+    listeners.push_back(new InstListener(this, "RetiredInsts",
+                                         &BranchTraceRecorder::countInsts));
+    listeners.push_back(new BranchListener(
+        this, "RetiredBranchInfo", &BranchTraceRecorder::recordBranch));
+}
+
+void
+BranchTraceRecorder::countInsts(const uint64_t &count)
+{
+    instsSinceRecord += count;
+}
+
+BranchTraceRecord &
+BranchTraceRecorder::nextRecord()
+{
+    if (numBuffered == buffer.size())
+        flush();
+
+    BranchTraceRecord &record = buffer[numBuffered++];
+    record = {};
+    return record;
+}
+
+BranchTraceRecord &
+BranchTraceRecorder::allocRecord()
+{
+    // A record can only account for 2^32 - 1 instructions, so long stretches
+    // without branches are split over several records.
+    constexpr uint64_t max_insts = std::numeric_limits<uint32_t>::max();
+    while (instsSinceRecord > max_insts) {
+        nextRecord().insts = htole<uint32_t>(max_insts);
+        instsSinceRecord -= max_insts;
+    }
+
+    BranchTraceRecord &record = nextRecord();
+    record.insts = htole<uint32_t>(instsSinceRecord);
+    instsSinceRecord = 0;
+    return record;
+}
+
+void
+BranchTraceRecorder::recordBranch(const BaseCPU::RetiredBranchInfo &info)
+{
+    if (!output)
+        return;
+
+    const StaticInst *inst = info.inst;
+    uint8_t flags = BranchTraceRecord::Control;
+    if (info.taken)
+        flags |= BranchTraceRecord::Taken;
+    if (inst->isCall())
+        flags |= BranchTraceRecord::Call;
+    if (inst->isReturn())
+        flags |= BranchTraceRecord::Return;
+    if (inst->isDirectCtrl())
+        flags |= BranchTraceRecord::Direct;
+    if (inst->isIndirectCtrl())
+        flags |= BranchTraceRecord::Indirect;
+    if (inst->isCondCtrl())
+        flags |= BranchTraceRecord::Cond;
+    if (inst->isUncondCtrl())
+        flags |= BranchTraceRecord::Uncond;
+
+    BranchTraceRecord &record = allocRecord();
+    record.pc = htole<uint64_t>(info.pc);
+    record.target = htole<uint64_t>(info.target);
+    record.flags = flags;
+    record.size = inst->size();
+    record.thread = info.tid;
+}
+
+void
+BranchTraceRecorder::flush()
+{
+    output->stream()->write((const char *)buffer.data(),
+                            numBuffered * sizeof(BranchTraceRecord));
+    numBuffered = 0;
+}
+
+void
+BranchTraceRecorder::close()
+{
+    if (!output)
+        return;
+
+    // Account for the instructions committed after the last branch.
+    if (instsSinceRecord)
+        allocRecord();
+
+    flush();
+    simout.close(output);
+    output = nullptr;
+}
+
+} // namespace gem5
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_BRANCH_TRACE_RECORDER_HH__
+#define __CPU_PROBES_BRANCH_TRACE_RECORDER_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "cpu/base.hh"
+#include "cpu/probes/branch_trace.hh"
+#include "params/BranchTraceRecorder.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+/**
+ * A probe listener which writes the branches committed by a CPU to a
+ * compact binary trace (see BranchTraceRecord). The trace can be replayed
+ * through any branch predictor by a BranchTraceReplayer.
+ */
+class BranchTraceRecorder : public ProbeListenerObject
+{
+  public:
+    BranchTraceRecorder(const BranchTraceRecorderParams &params);
+    ~BranchTraceRecorder();
+
+    /** setup the probelisteners */
+    void regProbeListeners() override;
+
+    /** Count the committed instructions. */
+    void countInsts(const uint64_t &count);
+
+    /** Record a committed branch. */
+    void recordBranch(const BaseCPU::RetiredBranchInfo &info);
+
+    /** Write out the buffered records and close the trace. */
+    void close();
+
+  private:
+    /** Get the next free buffered record, cleared. */
+    BranchTraceRecord &nextRecord();
+
+    /**
+     * Get a record accounting for the instructions committed since the
+     * last one.
+     */
+    BranchTraceRecord &allocRecord();
+
+    /** Write the buffered records to the trace. */
+    void flush();
+
+    OutputStream *output;
+
+    /** Records waiting to be written to the trace. */
+    std::vector<BranchTraceRecord> buffer;
+    size_t numBuffered;
+
+    /** Instructions committed since the last record. */
+    uint64_t instsSinceRecord;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_BRANCH_TRACE_RECORDER_HH__
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/looppoint_profiler.hh"
+
+#include <algorithm>
+
+#include "base/loader/symtab.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/LoopPoint.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+OutputStream *
+createOutput(const std::string &name, const std::string &file)
+{
+    OutputStream *os = simout.create(file, false);
+    fatal_if(!os, "%s: Unable to open %s.", name, file);
+    return os;
+}
+
+} // anonymous namespace
+
+LoopPointProfilerManager::LoopPointProfilerManager(
+        const LoopPointProfilerManagerParams &p)
+    : SimObject(p),
+      excludedSymbols(p.exclude_symbols),
+      bbStream(createOutput(name(), p.bb_file)),
+      markerStream(createOutput(name(), p.markers_file)),
+      _regions(p.region_length, p.spin_max_insts,
+               AddrRangeList(p.marker_ranges.begin(), p.marker_ranges.end()),
+               *bbStream->stream(), *markerStream->stream()),
+      stats(this)
+{
+    fatal_if(p.region_length == 0, "%s: region_length must be non-zero.",
+             name());
+
+    for (const auto &range : p.exclude_ranges)
+        _regions.exclude(range);
+
+    // get a callback when we exit so we can write the last region
+    registerExitCallback([this]() { close(); });
+}
+
+LoopPointProfilerManager::~LoopPointProfilerManager()
+{
+    close();
+}
+
+void
+LoopPointProfilerManager::startup()
+{
+    // Synchronization functions are looked up once the workload has been
+    // loaded. A function without a size extends to the next symbol.
+    int num_excluded = 0;
+    for (const auto &symbol : loader::debugSymbolTable) {
+        if (symbol.type() != loader::Symbol::SymbolType::Function)
+            continue;
+
+        const std::string sym_name = symbol.name();
+        bool match = std::any_of(excludedSymbols.begin(),
+                                 excludedSymbols.end(),
+                                 [&sym_name](const std::string &prefix) {
+            return sym_name.compare(0, prefix.size(), prefix) == 0;
+        });
+        if (!match)
+            continue;
+
+        Addr start = symbol.address();
+        Addr end = start + symbol.sizeOrDefault(0);
+        if (end == start)
+            loader::debugSymbolTable.findNearest(start, end);
+        if (end <= start)
+            continue;
+
+        if (_regions.exclude(RangeEx(start, end))) {
+            DPRINTF(LoopPoint, "Excluding %s [%#x, %#x).\n",
+                    sym_name, start, end);
+            num_excluded++;
+        }
+    }
+    DPRINTF(LoopPoint, "Excluded %d synchronization functions.\n",
+            num_excluded);
+}
+
+void
+LoopPointProfilerManager::close()
+{
+    if (!bbStream)
+        return;
+
+    _regions.finish();
+
+    simout.close(bbStream);
+    simout.close(markerStream);
+    bbStream = markerStream = nullptr;
+}
+
+LoopPointProfilerManager::LoopPointStats::LoopPointStats(
+        LoopPointProfilerManager *manager)
+    : statistics::Group(manager),
+      ADD_STAT(regions, statistics::units::Count::get(),
+               "Number of regions profiled"),
+      ADD_STAT(profiledInsts, statistics::units::Count::get(),
+               "Number of instructions in the regions"),
+      ADD_STAT(spinInsts, statistics::units::Count::get(),
+               "Number of instructions filtered in spin loops"),
+      ADD_STAT(excludedInsts, statistics::units::Count::get(),
+               "Number of instructions filtered in excluded code")
+{
+    // Profiling covers the whole run, so these are totals which stats
+    // resets don't clear.
+    const LoopPointRegions &r = manager->_regions;
+    regions.functor([&r]() { return r.counts().regions; });
+    profiledInsts.functor([&r]() { return r.counts().profiledInsts; });
+    spinInsts.functor([&r]() { return r.counts().spinInsts; });
+    excludedInsts.functor([&r]() { return r.counts().excludedInsts; });
+}
+
+LoopPointProfiler::LoopPointProfiler(const LoopPointProfilerParams &p)
+    : ProbeListenerObject(p),
+      regions(p.lpmanager->regions()),
+      thread(regions.addThread())
+{
+    auto *cpu = dynamic_cast<BaseCPU *>(p.manager);
+    fatal_if(!cpu, "%s: The manager must be a CPU.", name());
+    fatal_if(cpu->numThreads > 1,
+             "%s: LoopPoint profiling of SMT cores isn't supported.",
+             name());
+}
+
+void
+LoopPointProfiler::regProbeListeners()
+{
+    typedef ProbeListenerArg<LoopPointProfiler, Addr> PcListener;
+    typedef ProbeListenerArg<LoopPointProfiler, uint64_t> StoreListener;
+    typedef ProbeListenerArg<LoopPointProfiler, BaseCPU::RetiredBranchInfo>
+        BranchListener;
+    listeners.push_back(new PcListener(this, "RetiredInstsPC",
+                                       &LoopPointProfiler::countInst));
+    listeners.push_back(new StoreListener(this, "RetiredStores",
+                                          &LoopPointProfiler::countStore));
+    listeners.push_back(new BranchListener(this, "RetiredBranchInfo",
+                                           &LoopPointProfiler::endBlock));
+}
+
+} // namespace gem5
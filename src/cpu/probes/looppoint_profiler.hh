@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_LOOPPOINT_PROFILER_HH__
+#define __CPU_PROBES_LOOPPOINT_PROFILER_HH__
+
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "cpu/base.hh"
+#include "cpu/probes/looppoint_regions.hh"
+#include "params/LoopPointProfiler.hh"
+#include "params/LoopPointProfilerManager.hh"
+#include "sim/probe/probe.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Global state of LoopPoint profiling. LoopPoint divides the execution of
+ * a multi-threaded program into regions which start and end at loop
+ * entries, and describes every region by a global basic block vector,
+ * which concatenates the basic block vectors of all threads. The regions
+ * are clustered like SimPoints, and a representative region is simulated
+ * by restoring to its start marker, a PC and the number of times it has
+ * been executed by all threads, and stopping at its end marker. The last
+ * region runs to the end of the program and has no end marker.
+ *
+ * Instructions spent in synchronization code, such as spin loops waiting
+ * on a lock or barrier, depend on the timing of the threads rather than
+ * the work done. They are left out of both the region lengths and the
+ * basic block vectors. Synchronization functions are excluded by name,
+ * and spin loops anywhere else can be filtered dynamically.
+ *
+ * The manager owns the output files and looks up the synchronization
+ * functions, the profiling itself is done by LoopPointRegions.
+ */
+class LoopPointProfilerManager : public SimObject
+{
+  public:
+    LoopPointProfilerManager(const LoopPointProfilerManagerParams &params);
+    ~LoopPointProfilerManager();
+
+    void startup() override;
+
+    /** The regions all the profiled threads add to */
+    LoopPointRegions &regions() { return _regions; }
+
+  private:
+    /** Write out the final region on exit. */
+    void close();
+
+    const std::vector<std::string> excludedSymbols;
+
+    OutputStream *bbStream;
+    OutputStream *markerStream;
+
+    LoopPointRegions _regions;
+
+    struct LoopPointStats : public statistics::Group
+    {
+        LoopPointStats(LoopPointProfilerManager *manager);
+
+        statistics::Value regions;
+        statistics::Value profiledInsts;
+        statistics::Value spinInsts;
+        statistics::Value excludedInsts;
+    } stats;
+};
+
+/**
+ * Per-core half of LoopPoint profiling. This passes the instructions,
+ * stores and branches committed by a core on to the regions of the
+ * manager.
+ */
+class LoopPointProfiler : public ProbeListenerObject
+{
+  public:
+    LoopPointProfiler(const LoopPointProfilerParams &params);
+
+    void regProbeListeners() override;
+
+    void countInst(const Addr &pc) { regions.countInst(thread, pc); }
+
+    void
+    countStore(const uint64_t &count)
+    {
+        regions.countStores(thread, count);
+    }
+
+    void
+    endBlock(const BaseCPU::RetiredBranchInfo &info)
+    {
+        regions.endBlock(thread, info.pc, info.taken, info.target);
+    }
+
+  private:
+    LoopPointRegions &regions;
+    const int thread;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_LOOPPOINT_PROFILER_HH__
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/looppoint_regions.hh"
+
+#include <algorithm>
+
+#include "base/cprintf.hh"
+#include "base/trace.hh"
+#include "debug/LoopPoint.hh"
+
+namespace gem5
+{
+
+LoopPointRegions::LoopPointRegions(uint64_t region_length,
+        uint64_t spin_max_insts, const AddrRangeList &marker_ranges,
+        std::ostream &bb_os, std::ostream &markers_os)
+    : regionLength(region_length), spinMaxInsts(spin_max_insts),
+      markerRanges(marker_ranges), bbStream(bb_os), markersStream(markers_os)
+{
+    markersStream << "# region start_pc start_count end_pc end_count insts\n";
+}
+
+int
+LoopPointRegions::addThread()
+{
+    threads.emplace_back();
+    return threads.size() - 1;
+}
+
+bool
+LoopPointRegions::exclude(const AddrRange &range)
+{
+    return excludedRanges.insert(range, true) != excludedRanges.end();
+}
+
+void
+LoopPointRegions::countInst(int thread, Addr pc)
+{
+    if (!numPcs++)
+        firstPc = pc;
+    ++pcCounts[pc];
+
+    Thread &t = threads[thread];
+    if (!t.blockInsts) {
+        t.blockStart = pc;
+        t.blockExcluded = excluded(pc);
+    }
+    ++t.blockInsts;
+    if (!t.blockExcluded)
+        ++t.iterationInsts;
+}
+
+void
+LoopPointRegions::countStores(int thread, uint64_t stores)
+{
+    threads[thread].iterationStores += stores;
+}
+
+void
+LoopPointRegions::endBlock(int thread, Addr pc, bool taken, Addr target)
+{
+    Thread &t = threads[thread];
+    if (!t.blockInsts)
+        return;
+
+    if (t.blockExcluded) {
+        _counts.excludedInsts += t.blockInsts;
+        t.blockInsts = 0;
+        return;
+    }
+
+    t.pendingBlocks.emplace_back(basicBlockId(t.blockStart, pc),
+                                 t.blockInsts);
+    t.pendingInsts += t.blockInsts;
+    t.blockInsts = 0;
+
+    if (taken && target <= pc) {
+        // A backward branch ends a loop iteration. Repeated iterations of
+        // a short loop which doesn't store anything are taken to be
+        // waiting on another thread rather than doing work.
+        bool spin = spinMaxInsts && pc == t.lastBackwardBranch &&
+            t.iterationStores == 0 && t.iterationInsts <= spinMaxInsts;
+        if (spin) {
+            _counts.spinInsts += t.pendingInsts;
+            t.pendingBlocks.clear();
+            t.pendingInsts = 0;
+        } else {
+            flushBlocks(t);
+        }
+
+        t.lastBackwardBranch = pc;
+        t.iterationInsts = 0;
+        t.iterationStores = 0;
+
+        if (!spin)
+            loopEntry(target);
+    } else if (t.iterationInsts > spinMaxInsts) {
+        // Too long to be spinning
+        flushBlocks(t);
+    }
+}
+
+uint64_t
+LoopPointRegions::basicBlockId(Addr start, Addr end)
+{
+    auto [it, inserted] = basicBlocks.emplace(std::make_pair(start, end),
+                                              basicBlocks.size() + 1);
+    return it->second;
+}
+
+void
+LoopPointRegions::flushBlocks(Thread &t)
+{
+    for (const auto &[id, count] : t.pendingBlocks)
+        t.regionCounts[id] += count;
+
+    regionInsts += t.pendingInsts;
+    _counts.profiledInsts += t.pendingInsts;
+    t.pendingBlocks.clear();
+    t.pendingInsts = 0;
+}
+
+void
+LoopPointRegions::loopEntry(Addr header)
+{
+    if (finished || regionInsts < regionLength || excluded(header))
+        return;
+
+    if (!markerRanges.empty() &&
+            std::none_of(markerRanges.begin(), markerRanges.end(),
+                         [header](const AddrRange &r) {
+                return r.contains(header);
+            })) {
+        return;
+    }
+
+    // The header is next to execute, so the marker is reached when its
+    // count goes up by one.
+    endRegion(false, header, pcCounts[header] + 1);
+}
+
+void
+LoopPointRegions::endRegion(bool last, Addr end_pc, uint64_t end_count)
+{
+    // The first region starts with the first instruction.
+    if (regionId == 0) {
+        regionStartPc = firstPc;
+        regionStartCount = 1;
+    }
+
+    DPRINTF(LoopPoint, "Region %d: %#x:%d to %#x:%d, %d instructions.\n",
+            regionId, regionStartPc, regionStartCount, end_pc, end_count,
+            regionInsts);
+
+    // The global BBV interleaves the BBVs of the threads, so every
+    // (basic block, thread) pair is a dimension.
+    std::vector<std::pair<uint64_t, uint64_t>> bbv;
+    for (int i = 0; i < threads.size(); i++) {
+        for (const auto &[id, count] : threads[i].regionCounts)
+            bbv.emplace_back((id - 1) * threads.size() + i + 1, count);
+        threads[i].regionCounts.clear();
+    }
+    std::sort(bbv.begin(), bbv.end());
+
+    bbStream << "T";
+    for (const auto &[dim, count] : bbv)
+        bbStream << ":" << dim << ":" << count << " ";
+    bbStream << "\n";
+
+    if (last) {
+        ccprintf(markersStream, "%d %#x %d - - %d\n",
+                 regionId, regionStartPc, regionStartCount, regionInsts);
+    } else {
+        ccprintf(markersStream, "%d %#x %d %#x %d %d\n",
+                 regionId, regionStartPc, regionStartCount, end_pc,
+                 end_count, regionInsts);
+    }
+
+    _counts.regions++;
+    regionId++;
+    regionInsts = 0;
+    regionStartPc = end_pc;
+    regionStartCount = end_count;
+}
+
+void
+LoopPointRegions::finish()
+{
+    if (finished)
+        return;
+
+    for (auto &t : threads)
+        flushBlocks(t);
+
+    // The last region runs to the end of the program.
+    if (regionInsts)
+        endRegion(true, 0, 0);
+    finished = true;
+}
+
+} // namespace gem5
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_LOOPPOINT_REGIONS_HH__
+#define __CPU_PROBES_LOOPPOINT_REGIONS_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/addr_range.hh"
+#include "base/addr_range_map.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Splits the instructions committed by the threads of a program into
+ * LoopPoint regions. The committed instructions of every thread are
+ * split into basic blocks and loop iterations, instructions in excluded
+ * code and spin loops are filtered out, and the rest is accumulated into
+ * the global basic block vector of the current region. A region ends
+ * when a thread enters a loop iteration once it is long enough.
+ *
+ * The BBVs are written in the SimPoint format, and the markers of every
+ * region as a line of "region start_pc start_count end_pc end_count
+ * insts". The last region runs to the end of the program and has "- -"
+ * in place of its end marker.
+ */
+class LoopPointRegions
+{
+  public:
+    struct Counts
+    {
+        uint64_t regions = 0;
+        uint64_t profiledInsts = 0;
+        uint64_t spinInsts = 0;
+        uint64_t excludedInsts = 0;
+    };
+
+    /**
+     * @param region_length Minimum instructions in a region, summed over
+     * all threads.
+     * @param spin_max_insts Maximum instructions in an iteration of a spin
+     * loop, 0 to not filter spin loops.
+     * @param marker_ranges Ranges regions may end in, empty for any.
+     * @param bb_os Stream to write the BBVs to.
+     * @param markers_os Stream to write the region markers to.
+     */
+    LoopPointRegions(uint64_t region_length, uint64_t spin_max_insts,
+                     const AddrRangeList &marker_ranges,
+                     std::ostream &bb_os, std::ostream &markers_os);
+
+    /** Add a thread, returning its index. */
+    int addThread();
+
+    /**
+     * Exclude a range of (synchronization) code.
+     * @return Whether the range didn't overlap an excluded one.
+     */
+    bool exclude(const AddrRange &range);
+
+    /** Whether a PC is in excluded code. */
+    bool
+    excluded(Addr pc) const
+    {
+        return excludedRanges.contains(pc) != excludedRanges.end();
+    }
+
+    /** A thread committed the instruction at pc. */
+    void countInst(int thread, Addr pc);
+
+    /** A thread committed stores. */
+    void countStores(int thread, uint64_t stores);
+
+    /**
+     * A thread committed a branch, which ends its current basic block.
+     * @param pc The PC of the branch.
+     * @param taken Whether the branch was taken.
+     * @param target The target of the branch.
+     */
+    void endBlock(int thread, Addr pc, bool taken, Addr target);
+
+    /** Write out the last region. Nothing is written afterwards. */
+    void finish();
+
+    const Counts &counts() const { return _counts; }
+
+  private:
+    /** Per thread state */
+    struct Thread
+    {
+        /** The current basic block */
+        Addr blockStart = 0;
+        uint64_t blockInsts = 0;
+        bool blockExcluded = false;
+
+        /**
+         * Basic blocks of the current loop iteration, which aren't passed
+         * on until the iteration is known not to be spinning.
+         */
+        std::vector<std::pair<uint64_t, uint64_t>> pendingBlocks;
+        uint64_t pendingInsts = 0;
+
+        /** The current loop iteration */
+        Addr lastBackwardBranch = 0;
+        uint64_t iterationInsts = 0;
+        uint64_t iterationStores = 0;
+
+        /** Basic block counts in the current region */
+        std::unordered_map<uint64_t, uint64_t> regionCounts;
+    };
+
+    /** Get the global ID of the basic block from start to end. */
+    uint64_t basicBlockId(Addr start, Addr end);
+
+    /** Add the pending basic blocks of a thread to the current region. */
+    void flushBlocks(Thread &t);
+
+    /**
+     * Called when a thread is about to enter a loop iteration at header,
+     * which ends the current region if it is long enough.
+     */
+    void loopEntry(Addr header);
+
+    /**
+     * End the current region.
+     * @param last Whether this is the last region, which has no end
+     * marker.
+     */
+    void endRegion(bool last, Addr end_pc, uint64_t end_count);
+
+    struct BasicBlockHash
+    {
+        size_t
+        operator()(const std::pair<Addr, Addr> &bb) const
+        {
+            return std::hash<Addr>()(bb.first ^ (bb.second << 16));
+        }
+    };
+
+    const uint64_t regionLength;
+    const uint64_t spinMaxInsts;
+    const AddrRangeList markerRanges;
+    AddrRangeMap<bool, 2> excludedRanges;
+
+    std::ostream &bbStream;
+    std::ostream &markersStream;
+    bool finished = false;
+
+    std::vector<Thread> threads;
+
+    /** Number of executions of every PC, summed over all threads */
+    std::unordered_map<Addr, uint64_t> pcCounts;
+    uint64_t numPcs = 0;
+    Addr firstPc = 0;
+
+    /** IDs of all basic blocks seen so far */
+    std::unordered_map<std::pair<Addr, Addr>, uint64_t, BasicBlockHash>
+        basicBlocks;
+
+    uint64_t regionInsts = 0;
+    uint64_t regionId = 0;
+    Addr regionStartPc = 0;
+    uint64_t regionStartCount = 0;
+
+    Counts _counts;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_LOOPPOINT_REGIONS_HH__
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "cpu/probes/looppoint_regions.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const std::string MarkersHeader =
+    "# region start_pc start_count end_pc end_count insts\n";
+
+/**
+ * Commit a basic block of insts instructions starting at start, which
+ * ends with a branch to target.
+ */
+void
+runBlock(LoopPointRegions &regions, int thread, Addr start, unsigned insts,
+         bool taken, Addr target)
+{
+    Addr pc = start;
+    for (unsigned i = 0; i < insts; i++, pc += 4)
+        regions.countInst(thread, pc);
+    regions.endBlock(thread, pc - 4, taken, target);
+}
+
+/** Run an iteration of a loop of 4 instructions at header. */
+void
+runLoop(LoopPointRegions &regions, int thread, Addr header)
+{
+    runBlock(regions, thread, header, 4, true, header);
+}
+
+} // anonymous namespace
+
+TEST(LoopPointRegionsTest, EndAtLoopEntry)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(10, 0, {}, bb, markers);
+    int t = regions.addThread();
+
+    // The third iteration brings the region to 12 instructions, and the
+    // region ends as the fourth one is entered.
+    for (int i = 0; i < 4; i++)
+        runLoop(regions, t, 0x100);
+    regions.finish();
+
+    EXPECT_EQ(markers.str(), MarkersHeader +
+              "0 0x100 1 0x100 4 12\n"
+              "1 0x100 4 - - 4\n");
+    EXPECT_EQ(bb.str(), "T:1:12 \nT:1:4 \n");
+    EXPECT_EQ(regions.counts().regions, 2);
+    EXPECT_EQ(regions.counts().profiledInsts, 16);
+}
+
+TEST(LoopPointRegionsTest, LastRegionHasNoEndMarker)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(1000, 0, {}, bb, markers);
+    int t = regions.addThread();
+
+    runBlock(regions, t, 0x100, 3, false, 0);
+    runBlock(regions, t, 0x10c, 2, true, 0x200);
+    regions.finish();
+
+    EXPECT_EQ(markers.str(), MarkersHeader + "0 0x100 1 - - 5\n");
+    EXPECT_EQ(bb.str(), "T:1:3 :2:2 \n");
+
+    // Nothing is written once finished.
+    regions.finish();
+    runLoop(regions, t, 0x100);
+    EXPECT_EQ(markers.str(), MarkersHeader + "0 0x100 1 - - 5\n");
+}
+
+TEST(LoopPointRegionsTest, NoInstructions)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(10, 0, {}, bb, markers);
+    regions.addThread();
+    regions.finish();
+
+    EXPECT_EQ(markers.str(), MarkersHeader);
+    EXPECT_EQ(bb.str(), "");
+    EXPECT_EQ(regions.counts().regions, 0);
+}
+
+TEST(LoopPointRegionsTest, GlobalBBV)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(1000, 0, {}, bb, markers);
+    int t0 = regions.addThread();
+    int t1 = regions.addThread();
+
+    runLoop(regions, t0, 0x100);
+    runLoop(regions, t1, 0x200);
+    runLoop(regions, t1, 0x200);
+    runLoop(regions, t1, 0x100);
+    regions.finish();
+
+    // Block 1 (0x100) is dimension 1 on thread 0 and 2 on thread 1, and
+    // block 2 (0x200) is dimension 4 on thread 1.
+    EXPECT_EQ(bb.str(), "T:1:4 :2:4 :4:8 \n");
+}
+
+TEST(LoopPointRegionsTest, MarkerCountsAllThreads)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(8, 0, {}, bb, markers);
+    int t0 = regions.addThread();
+    int t1 = regions.addThread();
+
+    runLoop(regions, t0, 0x100);
+    runLoop(regions, t1, 0x100);
+    runLoop(regions, t0, 0x100);
+    regions.finish();
+
+    // The header was executed twice when the region reached 8
+    // instructions.
+    EXPECT_EQ(markers.str(), MarkersHeader +
+              "0 0x100 1 0x100 3 8\n"
+              "1 0x100 3 - - 4\n");
+}
+
+TEST(LoopPointRegionsTest, ExcludedCode)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(4, 0, {}, bb, markers);
+    int t = regions.addThread();
+    EXPECT_TRUE(regions.exclude(RangeSize(0x300, 0x10)));
+    EXPECT_FALSE(regions.exclude(RangeSize(0x308, 0x10)));
+    EXPECT_TRUE(regions.excluded(0x30c));
+    EXPECT_FALSE(regions.excluded(0x310));
+
+    runLoop(regions, t, 0x300);
+    runLoop(regions, t, 0x300);
+    runLoop(regions, t, 0x100);
+    runLoop(regions, t, 0x300);
+    regions.finish();
+
+    EXPECT_EQ(regions.counts().excludedInsts, 12);
+    EXPECT_EQ(regions.counts().profiledInsts, 4);
+    // Excluded loops aren't region boundaries.
+    EXPECT_EQ(markers.str(), MarkersHeader +
+              "0 0x300 1 0x100 2 4\n");
+    EXPECT_EQ(bb.str(), "T:1:4 \n");
+}
+
+TEST(LoopPointRegionsTest, MarkerRanges)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(4, 0, {RangeSize(0x200, 0x100)}, bb, markers);
+    int t = regions.addThread();
+
+    runLoop(regions, t, 0x100);
+    runLoop(regions, t, 0x100);
+    runLoop(regions, t, 0x200);
+    regions.finish();
+
+    EXPECT_EQ(markers.str(), MarkersHeader +
+              "0 0x100 1 0x200 2 12\n");
+}
+
+TEST(LoopPointRegionsTest, NoSpinFilterByDefault)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(1000, 0, {}, bb, markers);
+    int t = regions.addThread();
+
+    for (int i = 0; i < 3; i++)
+        runLoop(regions, t, 0x100);
+    regions.finish();
+
+    EXPECT_EQ(regions.counts().spinInsts, 0);
+    EXPECT_EQ(regions.counts().profiledInsts, 12);
+}
+
+TEST(LoopPointRegionsTest, SpinFilter)
+{
+    std::ostringstream bb, markers;
+    LoopPointRegions regions(1000, 8, {}, bb, markers);
+    int t = regions.addThread();
+
+    // The first iteration could be doing work, the repeats are spinning.
+    runLoop(regions, t, 0x100);
+    runLoop(regions, t, 0x100);
+    runLoop(regions, t, 0x100);
+    EXPECT_EQ(regions.counts().spinInsts, 8);
+    EXPECT_EQ(regions.counts().profiledInsts, 4);
+
+    // An iteration that stores does work.
+    regions.countStores(t, 1);
+    runLoop(regions, t, 0x100);
+    EXPECT_EQ(regions.counts().spinInsts, 8);
+    EXPECT_EQ(regions.counts().profiledInsts, 8);
+
+    // So does one which is too long.
+    runBlock(regions, t, 0x100, 12, true, 0x100);
+    EXPECT_EQ(regions.counts().profiledInsts, 20);
+
+    regions.finish();
+    EXPECT_EQ(bb.str(), "T:1:8 :2:12 \n");
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011 Google
+ * Copyright (c) 2026 The Regents of the University of California
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -26,15 +26,54 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "arch/sparc/decoder.hh"
+#include "cpu/sample_estimator.hh"
+
+#include <cmath>
+#include <limits>
 
 namespace gem5
 {
 
-namespace SparcISA
+SampleEstimator::SampleEstimator(double confidence)
+    : z(zScore(confidence))
+{}
+
+void
+SampleEstimator::sample(double value)
+{
+    n++;
+    double delta = value - _mean;
+    _mean += delta / n;
+    m2 += delta * (value - _mean);
+}
+
+double
+SampleEstimator::stdDev() const
 {
+    return n > 1 ? std::sqrt(m2 / (n - 1)) : 0.0;
+}
 
-GenericISA::BasicDecodeCache<Decoder, ExtMachInst> Decoder::defaultCache;
+double
+SampleEstimator::relativeError() const
+{
+    if (n < 2 || _mean == 0)
+        return std::numeric_limits<double>::infinity();
+    return z * stdDev() / (std::fabs(_mean) * std::sqrt(double(n)));
+}
+
+double
+SampleEstimator::zScore(double confidence)
+{
+    // Invert erf(z / sqrt(2)) = confidence by bisection.
+    double lo = 0.0, hi = 10.0;
+    for (int i = 0; i < 64; i++) {
+        double mid = (lo + hi) / 2;
+        if (std::erf(mid / std::sqrt(2.0)) < confidence)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return (lo + hi) / 2;
+}
 
-} // namespace SparcISA
 } // namespace gem5
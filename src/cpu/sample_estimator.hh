@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SAMPLE_ESTIMATOR_HH__
+#define __CPU_SAMPLE_ESTIMATOR_HH__
+
+#include <cstdint>
+
+namespace gem5
+{
+
+/**
+ * Online estimate of the mean of a sampled quantity and of the confidence
+ * interval around it. The mean and variance are accumulated with
+ * Welford's algorithm, which stays accurate however many samples are
+ * taken.
+ */
+class SampleEstimator
+{
+  public:
+    /** @param confidence Confidence level of the interval, in (0, 1). */
+    explicit SampleEstimator(double confidence);
+
+    /** Add a sample. */
+    void sample(double value);
+
+    uint64_t count() const { return n; }
+    double mean() const { return _mean; }
+
+    /** The sample standard deviation, 0 with fewer than two samples. */
+    double stdDev() const;
+
+    /**
+     * Half the width of the confidence interval of the mean relative to
+     * the mean, or infinity while it can't be estimated.
+     */
+    double relativeError() const;
+
+    /** The two sided standard score of a confidence level. */
+    static double zScore(double confidence);
+
+  private:
+    const double z;
+
+    uint64_t n = 0;
+    double _mean = 0;
+    /** Sum of the squared differences from the mean */
+    double m2 = 0;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SAMPLE_ESTIMATOR_HH__
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "cpu/sample_estimator.hh"
+
+using namespace gem5;
+
+TEST(SampleEstimatorTest, ZScore)
+{
+    EXPECT_NEAR(SampleEstimator::zScore(0.6827), 1.0, 1e-3);
+    EXPECT_NEAR(SampleEstimator::zScore(0.95), 1.959964, 1e-5);
+    EXPECT_NEAR(SampleEstimator::zScore(0.99), 2.575829, 1e-5);
+    EXPECT_NEAR(SampleEstimator::zScore(0.997), 2.967738, 1e-5);
+}
+
+TEST(SampleEstimatorTest, Empty)
+{
+    SampleEstimator est(0.95);
+    EXPECT_EQ(est.count(), 0);
+    EXPECT_EQ(est.mean(), 0.0);
+    EXPECT_EQ(est.stdDev(), 0.0);
+    EXPECT_TRUE(std::isinf(est.relativeError()));
+}
+
+TEST(SampleEstimatorTest, OneSample)
+{
+    SampleEstimator est(0.95);
+    est.sample(2.5);
+    EXPECT_EQ(est.count(), 1);
+    EXPECT_EQ(est.mean(), 2.5);
+    EXPECT_EQ(est.stdDev(), 0.0);
+    // A single sample says nothing about the spread.
+    EXPECT_TRUE(std::isinf(est.relativeError()));
+}
+
+TEST(SampleEstimatorTest, MeanAndStdDev)
+{
+    SampleEstimator est(0.95);
+    for (double v : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0})
+        est.sample(v);
+
+    EXPECT_EQ(est.count(), 8);
+    EXPECT_DOUBLE_EQ(est.mean(), 5.0);
+    // The sum of squared differences is 32, over n - 1 samples.
+    EXPECT_DOUBLE_EQ(est.stdDev(), std::sqrt(32.0 / 7));
+}
+
+TEST(SampleEstimatorTest, RelativeError)
+{
+    SampleEstimator est(0.95);
+    for (double v : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0})
+        est.sample(v);
+
+    double expected = SampleEstimator::zScore(0.95) *
+        std::sqrt(32.0 / 7) / (5.0 * std::sqrt(8.0));
+    EXPECT_DOUBLE_EQ(est.relativeError(), expected);
+}
+
+TEST(SampleEstimatorTest, ErrorShrinksWithSamples)
+{
+    SampleEstimator est(0.997);
+    double last = INFINITY;
+    for (int i = 0; i < 100; i++) {
+        est.sample(i % 2 ? 1.5 : 0.5);
+        if (i >= 1) {
+            EXPECT_LT(est.relativeError(), last);
+            last = est.relativeError();
+        }
+    }
+    EXPECT_DOUBLE_EQ(est.mean(), 1.0);
+}
+
+TEST(SampleEstimatorTest, ConstantSamples)
+{
+    SampleEstimator est(0.997);
+    for (int i = 0; i < 10; i++)
+        est.sample(1.25);
+    EXPECT_DOUBLE_EQ(est.mean(), 1.25);
+    EXPECT_EQ(est.stdDev(), 0.0);
+    EXPECT_EQ(est.relativeError(), 0.0);
+}
+
+TEST(SampleEstimatorTest, ZeroMean)
+{
+    SampleEstimator est(0.95);
+    est.sample(0.0);
+    est.sample(0.0);
+    EXPECT_TRUE(std::isinf(est.relativeError()));
+}
+
+TEST(SampleEstimatorTest, LargeOffset)
+{
+    // The naive sum of squares loses all precision here.
+    SampleEstimator est(0.95);
+    for (double v : {4.0, 7.0, 13.0, 16.0})
+        est.sample(1e9 + v);
+    EXPECT_DOUBLE_EQ(est.mean(), 1e9 + 10.0);
+    EXPECT_DOUBLE_EQ(est.stdDev(), std::sqrt(30.0));
+}
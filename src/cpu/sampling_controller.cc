@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/sampling_controller.hh"
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "cpu/base.hh"
+#include "cpu/thread_context.hh"
+#include "debug/Sampling.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+const char *phaseNames[] = {
+    "fast-forward", "functional warming", "detailed warming", "measurement"
+};
+
+} // anonymous namespace
+
+SamplingController::SamplingController(const SamplingControllerParams &p)
+    : SimObject(p),
+      fastForwardCpus(p.fast_forward_cpus),
+      warmingCpus(p.warming_cpus),
+      detailedCpus(p.detailed_cpus),
+      targetError(p.target_error),
+      minUnits(p.min_units),
+      maxUnits(p.max_units),
+      switchCause(p.switch_cause),
+      schedule(p.period, p.functional_warming, p.detailed_warming,
+               p.unit_size, !fastForwardCpus.empty(), !warmingCpus.empty()),
+      converged(false),
+      unitStartCycles(0), unitStartInsts(0),
+      cpiSamples(p.confidence),
+      phaseEndEvent([this]{ endPhase(); }, name()),
+      stats(this)
+{
+    fatal_if(p.confidence <= 0 || p.confidence >= 1,
+             "%s: The confidence must be between 0 and 1.", name());
+    // Phase lengths and the CPI are measured on a single thread.
+    fatal_if(detailedCpus.size() != 1,
+             "%s: Exactly one CPU can be sampled.", name());
+    for (auto *cpus : {&fastForwardCpus, &warmingCpus, &detailedCpus}) {
+        fatal_if(cpus->size() > 1,
+                 "%s: Only one CPU can be used in each phase.", name());
+        for (auto *cpu : *cpus) {
+            fatal_if(cpu->numThreads != 1,
+                     "%s: Sampling %s, which has more than one thread, is "
+                     "not supported.", name(), cpu->name());
+        }
+    }
+    fatal_if(p.unit_size == 0, "%s: The unit size must be non-zero.",
+             name());
+
+    Counter sampled = p.functional_warming + p.detailed_warming +
+        p.unit_size;
+    fatal_if(sampled > p.period,
+             "%s: Warming and measurement (%d instructions) don't fit in "
+             "the sampling period (%d instructions).",
+             name(), sampled, p.period);
+}
+
+const std::vector<BaseCPU *> &
+SamplingController::phaseCpus(SamplingSchedule::Phase p) const
+{
+    switch (SamplingSchedule::cpus(p)) {
+      case SamplingSchedule::FastForwardCpus:
+        return fastForwardCpus;
+      case SamplingSchedule::WarmingCpus:
+        return warmingCpus;
+      default:
+        return detailedCpus;
+    }
+}
+
+void
+SamplingController::startup()
+{
+    fatal_if(phaseCpus(schedule.phase())[0]->switchedOut(),
+             "%s: The CPUs of the first phase (%s) must be active.",
+             name(), phaseNames[schedule.phase()]);
+    startPhase();
+}
+
+void
+SamplingController::startPhase()
+{
+    const SamplingSchedule::Phase phase = schedule.phase();
+    BaseCPU *cpu = phaseCpus(phase)[0];
+    panic_if(cpu->switchedOut(), "%s: Starting %s on an inactive CPU.",
+             name(), phaseNames[phase]);
+
+    DPRINTF(Sampling, "Starting %s for %d instructions on %s.\n",
+            phaseNames[phase], schedule.insts(), cpu->name());
+
+    if (phase == SamplingSchedule::Measurement) {
+        unitStartCycles = cpu->curCycle();
+        unitStartInsts = cpu->totalInsts();
+    }
+
+    ThreadContext *tc = cpu->getContext(0);
+    tc->scheduleInstCountEvent(&phaseEndEvent,
+                               tc->getCurrentInstCount() + schedule.insts());
+}
+
+void
+SamplingController::endPhase()
+{
+    if (schedule.phase() == SamplingSchedule::Measurement) {
+        BaseCPU *cpu = detailedCpus[0];
+        Counter insts = cpu->totalInsts() - unitStartInsts;
+        if (insts > 0)
+            addSample(double(cpu->curCycle() - unitStartCycles) / insts);
+
+        if (converged) {
+            exitSimLoop("sampling complete");
+            return;
+        }
+        if (maxUnits && cpiSamples.count() >= maxUnits) {
+            warn("%s: The sampling target error was not reached after %d "
+                 "units (error %f).", name(), cpiSamples.count(),
+                 relativeError());
+            converged = true;
+            exitSimLoop("sampling complete");
+            return;
+        }
+    }
+
+    if (schedule.next()) {
+        DPRINTF(Sampling, "Switching CPUs for %s.\n",
+                phaseNames[schedule.phase()]);
+        exitSimLoop(switchCause);
+    } else {
+        startPhase();
+    }
+}
+
+void
+SamplingController::addSample(double cpi)
+{
+    cpiSamples.sample(cpi);
+
+    double error = relativeError();
+    DPRINTF(Sampling, "Unit %d: CPI %f, mean CPI %f, error %f.\n",
+            cpiSamples.count(), cpi, cpiSamples.mean(), error);
+
+    if (cpiSamples.count() >= minUnits && error <= targetError)
+        converged = true;
+}
+
+SamplingController::SamplingStats::SamplingStats(
+        SamplingController *controller)
+    : statistics::Group(controller),
+      ADD_STAT(units, statistics::units::Count::get(),
+               "Number of measured sampling units"),
+      ADD_STAT(cpi, statistics::units::Rate<
+                    statistics::units::Cycle, statistics::units::Count>::get(),
+               "Mean CPI of the sampling units"),
+      ADD_STAT(cpiStdDev, statistics::units::Rate<
+                    statistics::units::Cycle, statistics::units::Count>::get(),
+               "Standard deviation of the CPI of the sampling units"),
+      ADD_STAT(cpiRelError, statistics::units::Ratio::get(),
+               "Relative error of the mean CPI at the target confidence")
+{
+    // The samples are gathered across stats dumps and resets, so these
+    // are computed rather than accumulated.
+    units.functor([controller]() {
+        return controller->cpiSamples.count();
+    });
+    cpi.functor([controller]() { return controller->cpiSamples.mean(); });
+    cpiStdDev.functor([controller]() {
+        return controller->cpiSamples.stdDev();
+    });
+    cpiRelError.functor([controller]() {
+        return controller->relativeError();
+    });
+}
+
+} // namespace gem5
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SAMPLING_CONTROLLER_HH__
+#define __CPU_SAMPLING_CONTROLLER_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/sample_estimator.hh"
+#include "cpu/sampling_schedule.hh"
+#include "params/SamplingController.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+
+/**
+ * A SMARTS style statistical sampling controller. Execution is divided
+ * into periods of a fixed number of instructions, each of which consists
+ * of fast-forwarding, functional warming, detailed warming and a detailed
+ * measurement unit. The CPI of every measurement unit is sampled, and the
+ * simulation stops once the confidence interval of the mean CPI is within
+ * the target relative error.
+ *
+ * Only a single, single threaded CPU can be sampled: the lengths of the
+ * phases are counted in instructions it commits, and the CPI of a unit is
+ * its cycles over its instructions. Switching CPUs requires draining the
+ * system, which is done from Python: whenever the next phase runs on
+ * different CPUs the controller exits the simulation loop, and
+ * SamplingController.run() switches to the CPUs of currentPhase() and
+ * calls startPhase().
+ */
+class SamplingController : public SimObject
+{
+  public:
+    SamplingController(const SamplingControllerParams &params);
+
+    void startup() override;
+
+    /** Start the current phase once its CPUs are active. */
+    void startPhase();
+
+    /** The current phase, to switch to if the controller exited. */
+    int currentPhase() const { return schedule.phase(); }
+
+    /** Whether the target error has been reached. */
+    bool done() const { return converged; }
+
+    /** The mean CPI of the measured units. */
+    double cpiMean() const { return cpiSamples.mean(); }
+
+    /** The relative error of the mean CPI at the target confidence. */
+    double relativeError() const { return cpiSamples.relativeError(); }
+
+  private:
+    /** Called when the current phase has run for its instructions. */
+    void endPhase();
+
+    /** The CPUs of the given phase */
+    const std::vector<BaseCPU *> &
+    phaseCpus(SamplingSchedule::Phase p) const;
+
+    /** Record the CPI of a measurement unit. */
+    void addSample(double cpi);
+
+    const std::vector<BaseCPU *> fastForwardCpus;
+    const std::vector<BaseCPU *> warmingCpus;
+    const std::vector<BaseCPU *> detailedCpus;
+
+    const double targetError;
+    const unsigned minUnits;
+    const unsigned maxUnits;
+
+    const std::string switchCause;
+
+    SamplingSchedule schedule;
+    bool converged;
+
+    /** Counters at the start of the current measurement unit */
+    Cycles unitStartCycles;
+    Counter unitStartInsts;
+
+    /** The CPIs of the measured units */
+    SampleEstimator cpiSamples;
+
+    EventFunctionWrapper phaseEndEvent;
+
+    struct SamplingStats : public statistics::Group
+    {
+        SamplingStats(SamplingController *controller);
+
+        statistics::Value units;
+        statistics::Value cpi;
+        statistics::Value cpiStdDev;
+        statistics::Value cpiRelError;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SAMPLING_CONTROLLER_HH__
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/sampling_schedule.hh"
+
+namespace gem5
+{
+
+SamplingSchedule::SamplingSchedule(Counter period,
+        Counter functional_warming, Counter detailed_warming,
+        Counter unit_size, bool fast_forward_cpus, bool warming_cpus)
+{
+    phaseInsts[FastForward] =
+        period - functional_warming - detailed_warming - unit_size;
+    phaseInsts[FunctionalWarming] = functional_warming;
+    phaseInsts[DetailedWarming] = detailed_warming;
+    phaseInsts[Measurement] = unit_size;
+
+    // Without separate CPUs, fast-forwarding and warming happen on the
+    // next CPUs which are used.
+    if (!fast_forward_cpus && !warming_cpus) {
+        phaseInsts[DetailedWarming] += phaseInsts[FastForward] +
+            phaseInsts[FunctionalWarming];
+        phaseInsts[FastForward] = phaseInsts[FunctionalWarming] = 0;
+    } else if (!fast_forward_cpus) {
+        phaseInsts[FunctionalWarming] += phaseInsts[FastForward];
+        phaseInsts[FastForward] = 0;
+    } else if (!warming_cpus) {
+        phaseInsts[FastForward] += phaseInsts[FunctionalWarming];
+        phaseInsts[FunctionalWarming] = 0;
+    }
+
+    // Start with the first phase that runs any instructions.
+    while (_phase < Measurement && phaseInsts[_phase] == 0)
+        _phase = Phase(_phase + 1);
+}
+
+SamplingSchedule::CpuSet
+SamplingSchedule::cpus(Phase p)
+{
+    switch (p) {
+      case FastForward:
+        return FastForwardCpus;
+      case FunctionalWarming:
+        return WarmingCpus;
+      default:
+        return DetailedCpus;
+    }
+}
+
+bool
+SamplingSchedule::next()
+{
+    const CpuSet prev = cpus(_phase);
+    do {
+        _phase = Phase((_phase + 1) % NumPhases);
+    } while (phaseInsts[_phase] == 0);
+    return cpus(_phase) != prev;
+}
+
+} // namespace gem5
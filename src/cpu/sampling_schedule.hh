@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SAMPLING_SCHEDULE_HH__
+#define __CPU_SAMPLING_SCHEDULE_HH__
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * The sequence of phases of a sampling period, as run by a
+ * SamplingController: fast-forwarding, functional warming, detailed
+ * warming and a measurement unit, each for a number of instructions.
+ * Phases without CPUs of their own are folded into the next phase which
+ * has some, and phases with no instructions are skipped.
+ */
+class SamplingSchedule
+{
+  public:
+    enum Phase
+    {
+        FastForward,
+        FunctionalWarming,
+        DetailedWarming,
+        Measurement,
+        NumPhases
+    };
+
+    /** The CPUs a phase runs on. */
+    enum CpuSet
+    {
+        FastForwardCpus,
+        WarmingCpus,
+        DetailedCpus
+    };
+
+    /**
+     * The instructions of all the phases must fit in the period, and the
+     * unit size must be non-zero.
+     *
+     * @param fast_forward_cpus Whether there are CPUs to fast-forward on.
+     * @param warming_cpus Whether there are CPUs to warm functionally on.
+     */
+    SamplingSchedule(Counter period, Counter functional_warming,
+                     Counter detailed_warming, Counter unit_size,
+                     bool fast_forward_cpus, bool warming_cpus);
+
+    Phase phase() const { return _phase; }
+
+    /** Instructions of the current phase. */
+    Counter insts() const { return phaseInsts[_phase]; }
+
+    /** Instructions of phase p. */
+    Counter insts(Phase p) const { return phaseInsts[p]; }
+
+    static CpuSet cpus(Phase p);
+
+    /**
+     * Move on to the next phase which has any instructions to run.
+     * @return Whether it runs on different CPUs than the current one.
+     */
+    bool next();
+
+  private:
+    Counter phaseInsts[NumPhases];
+    Phase _phase = FastForward;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SAMPLING_SCHEDULE_HH__
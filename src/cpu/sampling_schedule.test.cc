@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "cpu/sampling_schedule.hh"
+
+using namespace gem5;
+
+typedef SamplingSchedule S;
+
+TEST(SamplingScheduleTest, AllPhases)
+{
+    S schedule(1000, 200, 100, 50, true, true);
+    EXPECT_EQ(schedule.insts(S::FastForward), 650);
+    EXPECT_EQ(schedule.insts(S::FunctionalWarming), 200);
+    EXPECT_EQ(schedule.insts(S::DetailedWarming), 100);
+    EXPECT_EQ(schedule.insts(S::Measurement), 50);
+
+    // Every period switches from the fast-forward CPUs to the warming
+    // CPUs to the detailed CPUs, which both warm and measure.
+    for (int period = 0; period < 3; period++) {
+        EXPECT_EQ(schedule.phase(), S::FastForward);
+        EXPECT_EQ(schedule.insts(), 650);
+        EXPECT_TRUE(schedule.next());
+        EXPECT_EQ(schedule.phase(), S::FunctionalWarming);
+        EXPECT_EQ(schedule.insts(), 200);
+        EXPECT_TRUE(schedule.next());
+        EXPECT_EQ(schedule.phase(), S::DetailedWarming);
+        EXPECT_EQ(schedule.insts(), 100);
+        EXPECT_FALSE(schedule.next());
+        EXPECT_EQ(schedule.phase(), S::Measurement);
+        EXPECT_EQ(schedule.insts(), 50);
+        EXPECT_TRUE(schedule.next());
+    }
+}
+
+TEST(SamplingScheduleTest, CpuSets)
+{
+    EXPECT_EQ(S::cpus(S::FastForward), S::FastForwardCpus);
+    EXPECT_EQ(S::cpus(S::FunctionalWarming), S::WarmingCpus);
+    EXPECT_EQ(S::cpus(S::DetailedWarming), S::DetailedCpus);
+    EXPECT_EQ(S::cpus(S::Measurement), S::DetailedCpus);
+}
+
+/** Without warming CPUs, fast-forwarding covers functional warming. */
+TEST(SamplingScheduleTest, NoWarmingCpus)
+{
+    S schedule(1000, 200, 100, 50, true, false);
+    EXPECT_EQ(schedule.insts(S::FastForward), 850);
+    EXPECT_EQ(schedule.insts(S::FunctionalWarming), 0);
+
+    EXPECT_EQ(schedule.phase(), S::FastForward);
+    EXPECT_TRUE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::DetailedWarming);
+    EXPECT_FALSE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::Measurement);
+    EXPECT_TRUE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::FastForward);
+}
+
+/** Without fast-forward CPUs, the warming CPUs fast-forward. */
+TEST(SamplingScheduleTest, NoFastForwardCpus)
+{
+    S schedule(1000, 200, 100, 50, false, true);
+    EXPECT_EQ(schedule.insts(S::FastForward), 0);
+    EXPECT_EQ(schedule.insts(S::FunctionalWarming), 850);
+
+    EXPECT_EQ(schedule.phase(), S::FunctionalWarming);
+    EXPECT_TRUE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::DetailedWarming);
+    EXPECT_FALSE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::Measurement);
+    EXPECT_TRUE(schedule.next());
+    EXPECT_EQ(schedule.phase(), S::FunctionalWarming);
+}
+
+/**
+ * With only detailed CPUs, the whole period but the unit is detailed
+ * warming, and the CPUs are never switched.
+ */
+TEST(SamplingScheduleTest, DetailedCpusOnly)
+{
+    S schedule(1000, 200, 100, 50, false, false);
+    EXPECT_EQ(schedule.insts(S::DetailedWarming), 950);
+
+    for (int period = 0; period < 3; period++) {
+        EXPECT_EQ(schedule.phase(), S::DetailedWarming);
+        EXPECT_FALSE(schedule.next());
+        EXPECT_EQ(schedule.phase(), S::Measurement);
+        EXPECT_FALSE(schedule.next());
+    }
+}
+
+/** Phases without instructions are skipped. */
+TEST(SamplingScheduleTest, EmptyPhases)
+{
+    // Only measurement units, back to back.
+    S units(50, 0, 0, 50, true, true);
+    EXPECT_EQ(units.phase(), S::Measurement);
+    EXPECT_FALSE(units.next());
+    EXPECT_EQ(units.phase(), S::Measurement);
+
+    // No functional warming, straight from fast-forwarding to detailed
+    // warming.
+    S no_warming(1000, 0, 100, 50, true, true);
+    EXPECT_EQ(no_warming.phase(), S::FastForward);
+    EXPECT_TRUE(no_warming.next());
+    EXPECT_EQ(no_warming.phase(), S::DetailedWarming);
+
+    // No detailed warming, from functional warming to the unit.
+    S no_detailed(1000, 200, 0, 50, true, true);
+    no_detailed.next();
+    EXPECT_EQ(no_detailed.phase(), S::FunctionalWarming);
+    EXPECT_TRUE(no_detailed.next());
+    EXPECT_EQ(no_detailed.phase(), S::Measurement);
+    EXPECT_TRUE(no_detailed.next());
+    EXPECT_EQ(no_detailed.phase(), S::FastForward);
+}
@@ -61,6 +61,15 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    block_cache_entries = Param.Unsigned(
+        0,
+        "Number of decoded basic blocks kept to be executed again without "
+        "fetching and decoding them (0 to disable). Cached blocks are run "
+        "from a single tick event for as long as no other event is due.",
+    )
+    max_block_insts = Param.Unsigned(
+        64, "Maximum number of instructions in a cached basic block"
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
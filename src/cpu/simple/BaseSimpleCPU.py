@@ -38,3 +38,8 @@ class BaseSimpleCPU(BaseCPU):
     cxx_class = "gem5::BaseSimpleCPU"
 
     branchPred = Param.BranchPredictor(NULL, "Branch Predictor")
+    host_tlb_entries = Param.Unsigned(
+        0,
+        "Number of entries of the software TLB mapping virtual pages to "
+        "host memory, used by the atomic CPU (0 to disable)",
+    )
@@ -78,11 +78,23 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      blockCacheEntries(p.block_cache_entries),
+      maxBlockInsts(p.max_block_insts),
+      blockCache(p.block_cache_entries, blockPageShift),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
+    fatal_if(blockCacheEntries && simulate_inst_stalls,
+             "Block execution skips instruction fetches and can't be used "
+             "to simulate icache stalls.");
+    fatal_if(blockCacheEntries && !maxBlockInsts,
+             "Cached blocks need to hold at least one instruction.");
+    fatal_if(!hostTlb.empty() && simulate_data_stalls,
+             "The software TLB skips the memory system and can't be used "
+             "to simulate dcache stalls.");
+
     _status = Idle;
     ifetch_req = std::make_shared<Request>();
     data_read_req = std::make_shared<Request>();
@@ -147,6 +159,8 @@ AtomicSimpleCPU::drainResume()
 
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
+    flushBlockCache();
+    flushHostTlb();
 
     assert(!threadContexts.empty());
 
@@ -206,6 +220,9 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *old_cpu)
 
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
+
+    flushBlockCache();
+    flushHostTlb();
 }
 
 void
@@ -298,6 +315,7 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
             t_info->thread->getIsaPtr()->handleLockedSnoop(pkt,
                     cacheBlockMask);
         }
+        cpu->invalidateBlocks(pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -325,6 +343,10 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
                     cacheBlockMask);
         }
     }
+
+    // Functional writes (e.g. loading code) may modify cached blocks.
+    if (pkt->isInvalidate() || pkt->isWrite())
+        cpu->invalidateBlocks(pkt->getAddr(), pkt->getSize());
 }
 
 bool
@@ -371,6 +393,14 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 
     dcache_latency = 0;
 
+    if (byte_enable.empty()) {
+        if (auto *entry = lookupHostTlb(addr, size, flags, false)) {
+            memcpy(data, entry->host + (addr & mask(hostTlbPageShift)), size);
+            dcache_access = true;
+            return NoFault;
+        }
+    }
+
     req->taskId(taskId());
 
     Addr frag_addr = addr;
@@ -387,6 +417,8 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
         if (predicate) {
             fault = thread->mmu->translateAtomic(req, thread->getTC(),
                                                  BaseMMU::Read);
+            if (fault == NoFault)
+                fillHostTlb(req, flags, false);
         }
 
         // Now do the access.
@@ -457,6 +489,16 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
     dcache_latency = 0;
 
+    if (byte_enable.empty()) {
+        if (auto *entry = lookupHostTlb(addr, size, flags, true)) {
+            Addr offset = addr & mask(hostTlbPageShift);
+            memcpy(entry->host + offset, data, size);
+            invalidateBlocks(entry->paddr + offset, size);
+            dcache_access = true;
+            return NoFault;
+        }
+    }
+
     req->taskId(taskId());
 
     Addr frag_addr = addr;
@@ -471,9 +513,12 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                                           byte_enable, frag_size, size_left);
 
         // translate to physical address
-        if (predicate)
+        if (predicate) {
             fault = thread->mmu->translateAtomic(req, thread->getTC(),
                                                  BaseMMU::Write);
+            if (fault == NoFault)
+                fillHostTlb(req, flags, true);
+        }
 
         // Now do the access.
         if (predicate && fault == NoFault) {
@@ -503,6 +548,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
+                    invalidateBlocks(req->getPaddr(), frag_size);
                 }
                 dcache_access = true;
                 panic_if(pkt.isError(), "Data write (%s) failed: %s",
@@ -590,6 +636,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
             dcache_latency += req->localAccessor(thread->getTC(), &pkt);
         } else {
             dcache_latency += sendPacket(dcachePort, &pkt);
+            invalidateBlocks(req->getPaddr(), size);
         }
 
         dcache_access = true;
@@ -629,13 +676,18 @@ AtomicSimpleCPU::tick()
     SimpleThread *thread = t_info.thread;
 
     Tick latency = 0;
+    // Ticks of the cycles already simulated ahead of the current one.
+    Tick ahead = 0;
 
     for (int i = 0; i < width || locked; ++i) {
         baseStats.numCycles++;
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
         if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
-            checkForInterrupts();
+            if (checkForInterrupts()) {
+                flushBlockCache();
+                flushHostTlb();
+            }
             checkPcEventQueue();
         }
 
@@ -652,7 +704,11 @@ AtomicSimpleCPU::tick()
         const PCStateBase &pc = thread->pcState();
 
         bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
-        if (needToFetch) {
+        const BlockInst *block_inst = nullptr;
+        if (needToFetch && blockCacheEntries)
+            block_inst = nextBlockInst(false);
+
+        if (needToFetch && !block_inst) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
@@ -664,7 +720,10 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            if (needToFetch && !block_inst && blockCacheEntries)
+                block_inst = nextBlockInst(true);
+
+            if (needToFetch && !block_inst) {
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -677,7 +736,13 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (block_inst) {
+                preExecute(block_inst->inst, *block_inst->decodedPC);
+            } else {
+                preExecute();
+                if (needToFetch && recordingBlock)
+                    recordBlockInst();
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -725,6 +790,26 @@ AtomicSimpleCPU::tick()
         }
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
+
+        if (fault != NoFault || (curStaticInst &&
+                    (curStaticInst->isSerializing() ||
+                     curStaticInst->isSquashAfter()))) {
+            // Faults and instructions that serialize the pipeline may
+            // change the state the decoder and the MMU depend on.
+            flushBlockCache();
+            flushHostTlb();
+        } else if (blockCacheEntries) {
+            endBlockInst();
+        }
+
+        // Keep replaying the cached block in this event while no other
+        // event is due, one more cycle at a time.
+        Tick cycle_latency = std::max(latency, clockPeriod());
+        if (i + 1 >= width && !locked && canRunAhead(ahead + cycle_latency)) {
+            ahead += cycle_latency;
+            latency = 0;
+            i = -1;
+        }
     }
 
     if (tryCompleteDrain())
@@ -733,11 +818,217 @@ AtomicSimpleCPU::tick()
     // instruction takes at least one cycle
     if (latency < clockPeriod())
         latency = clockPeriod();
+    latency += ahead;
 
     if (_status != Idle)
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+void
+AtomicSimpleCPU::fillHostTlb(const RequestPtr &req, Request::Flags flags,
+                             bool write)
+{
+    if (hostTlb.empty() ||
+            flags.isSet(~Request::FlagsType(Request::ARCH_BITS)) ||
+            req->isUncacheable() || req->isStrictlyOrdered() ||
+            req->isLocalAccess()) {
+        return;
+    }
+
+    ThreadContext *tc = threadContexts[curThread];
+    if (!tc->getMMUPtr()->cacheableTranslations(tc))
+        return;
+
+    // Stores that skip the memory system aren't snooped, so they can only
+    // do so when no other thread may hold a reservation or a monitor.
+    if (write && (numThreads > 1 || system->threads.size() > 1))
+        return;
+
+    Addr paddr = req->getPaddr();
+    if (!system->isMemAddr(paddr))
+        return;
+
+    AddrRange page = RangeSize(paddr & ~mask(hostTlbPageShift),
+                               1ULL << hostTlbPageShift);
+    MemBackdoorPtr bd = nullptr;
+    auto bd_it = hostTlbBackdoors.contains(page);
+    if (bd_it != hostTlbBackdoors.end()) {
+        bd = bd_it->second;
+    } else {
+        dcachePort.sendMemBackdoorReq(MemBackdoorReq(page,
+                    (MemBackdoor::Flags)(MemBackdoor::Readable |
+                                         MemBackdoor::Writeable)), bd);
+        if (!bd) {
+            // Memory is behind something, like a cache, that has to see
+            // every access.
+            DPRINTF(SimpleCPU, "No backdoor to %s, disabling the software "
+                    "TLB.\n", page.to_string());
+            hostTlb.clear();
+            return;
+        }
+
+        if (hostTlbBackdoors.insert(bd->range(), bd) !=
+                hostTlbBackdoors.end()) {
+            // Install a callback to erase this backdoor if it goes away.
+            auto callback = [this](const MemBackdoor &backdoor) {
+                    for (auto it = hostTlbBackdoors.begin();
+                            it != hostTlbBackdoors.end(); it++) {
+                        if (it->second == &backdoor) {
+                            hostTlbBackdoors.erase(it);
+                            flushHostTlb();
+                            return;
+                        }
+                    }
+                    panic("Got invalidation for unknown memory backdoor.");
+                };
+            bd->addInvalidationCallback(callback);
+        }
+        if (!page.isSubset(bd->range()))
+            return;
+    }
+
+    if (!bd->readable() || (write && !bd->writeable()))
+        return;
+
+    BaseSimpleCPU::fillHostTlb(req->getVaddr(), paddr, flags,
+            bd->ptr() + (page.start() - bd->range().start()), write);
+}
+
+const AtomicSimpleCPU::BlockInst *
+AtomicSimpleCPU::nextBlockInst(bool translated)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    const PCStateBase &pc = t_info.thread->pcState();
+
+    if (curBlock && curBlock->tid != curThread)
+        curBlock = nullptr;
+
+    if (!translated) {
+        // Keep replaying the current block as long as the thread follows
+        // the path it was recorded on.
+        if (!curBlock || recordingBlock)
+            return nullptr;
+        if (curBlockPos < curBlock->insts.size() && !t_info.fetchOffset) {
+            const BlockInst &block_inst = curBlock->insts[curBlockPos];
+            if (block_inst.fetchPC->equals(pc)) {
+                ++curBlockPos;
+                return &block_inst;
+            }
+        }
+        curBlock = nullptr;
+        return nullptr;
+    }
+
+    Addr paddr = ifetch_req->getPaddr();
+    Addr phys_offset = paddr - ifetch_req->getVaddr();
+
+    if (curBlock && recordingBlock) {
+        // Only record instructions whose bytes come from the same
+        // physical page, so that the block stays valid whatever the
+        // mappings of neighbouring pages.
+        if (paddr >> blockPageShift == curBlock->paddr >> blockPageShift &&
+                phys_offset == curBlock->physOffset &&
+                curBlock->insts.size() < maxBlockInsts) {
+            if (!t_info.fetchOffset)
+                set(blockFetchPC, pc);
+            return nullptr;
+        }
+        curBlock = nullptr;
+    }
+
+    // Blocks start at instruction boundaries only.
+    if (t_info.fetchOffset)
+        return nullptr;
+
+    Addr inst_paddr = pc.instAddr() + phys_offset;
+    if (Block *cached = blockCache.find(inst_paddr)) {
+        Block &block = *cached;
+        if (block.tid == curThread && !block.insts.empty() &&
+                block.insts[0].fetchPC->equals(pc)) {
+            // The decoder is bypassed while replaying, so make sure it
+            // holds no stale bytes once decoding resumes.
+            t_info.thread->decoder->reset();
+            curBlock = &block;
+            curBlockPos = 1;
+            recordingBlock = false;
+            return &block.insts[0];
+        }
+    }
+
+    // Record a new block starting here.
+    Block &block = blockCache.insert(inst_paddr);
+    block.tid = curThread;
+    block.paddr = inst_paddr;
+    block.physOffset = phys_offset;
+    block.insts.clear();
+
+    curBlock = &block;
+    recordingBlock = true;
+    set(blockFetchPC, pc);
+    return nullptr;
+}
+
+void
+AtomicSimpleCPU::recordBlockInst()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+
+    // Wait until the decoder has all the bytes of the instruction.
+    if (!curBlock || t_info.stayAtPC || !curStaticInst)
+        return;
+
+    BlockInst block_inst;
+    block_inst.inst = curMacroStaticInst ? curMacroStaticInst : curStaticInst;
+    block_inst.fetchPC.reset(blockFetchPC->clone());
+    block_inst.decodedPC.reset(t_info.thread->pcState().clone());
+    curBlock->insts.push_back(std::move(block_inst));
+}
+
+void
+AtomicSimpleCPU::endBlockInst()
+{
+    if (!curBlock || !recordingBlock || !curStaticInst)
+        return;
+
+    if (curStaticInst->isControl() ||
+            isRomMicroPC(threadInfo[curThread]->thread->pcState().microPC())) {
+        curBlock = nullptr;
+    }
+}
+
+bool
+AtomicSimpleCPU::canRunAhead(Tick ahead) const
+{
+    if (!curBlock || recordingBlock || curBlockPos >= curBlock->insts.size())
+        return false;
+
+    // Other threads and draining need to be taken care of from the tick
+    // event.
+    if (numThreads > 1 || _status != BaseSimpleCPU::Running ||
+            drainState() != DrainState::Running) {
+        return false;
+    }
+
+    const SimpleExecContext &t_info = *threadInfo[curThread];
+    if (curMacroStaticInst || t_info.fetchOffset ||
+            !curBlock->insts[curBlockPos].fetchPC->equals(
+                t_info.thread->pcState())) {
+        return false;
+    }
+
+    // Anything scheduled in the meantime, like a device raising an
+    // interrupt, has to happen before the next cycle is simulated.
+    const EventQueue *eq = eventQueue();
+    return eq->empty() || eq->nextTick() > curTick() + ahead;
+}
+
+void
+AtomicSimpleCPU::flushBlockCache()
+{
+    blockCache.flush();
+    curBlock = nullptr;
+}
+
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
@@ -41,7 +41,12 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <memory>
+#include <vector>
+
+#include "base/addr_range_map.hh"
 #include "cpu/simple/base.hh"
+#include "cpu/simple/block_cache.hh"
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
@@ -67,6 +72,100 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
 
+    /** An instruction of a cached basic block. */
+    struct BlockInst
+    {
+        /** The instruction as returned by the decoder. */
+        StaticInstPtr inst;
+        /** The PC state the instruction was decoded at. */
+        std::unique_ptr<PCStateBase> fetchPC;
+        /** The PC state the decoder produced for the instruction. */
+        std::unique_ptr<PCStateBase> decodedPC;
+    };
+
+    /**
+     * A straight line of decoded instructions, starting at a physical
+     * address and ending with the first control or serializing
+     * instruction. All of its bytes live in the same physical page.
+     */
+    struct Block
+    {
+        ThreadID tid;
+        /** Physical address of the first instruction. */
+        Addr paddr;
+        /** Offset from the virtual to the physical fetch addresses. */
+        Addr physOffset;
+        std::vector<BlockInst> insts;
+    };
+
+    /** Size of the pages blocks are confined to; no larger than the
+     * smallest page size of any supported ISA. */
+    static constexpr unsigned blockPageShift = 12;
+
+    /** Maximum number of cached blocks, 0 if block execution is off. */
+    const unsigned blockCacheEntries;
+    /** Maximum number of instructions in a block. */
+    const unsigned maxBlockInsts;
+
+    BlockCache<Block> blockCache;
+
+    /** The block being replayed or recorded, if any. */
+    Block *curBlock = nullptr;
+    /** Position of the next instruction to replay in curBlock. */
+    size_t curBlockPos = 0;
+    /** Whether curBlock is being recorded rather than replayed. */
+    bool recordingBlock = false;
+    /** PC state the instruction being recorded is decoded at. */
+    std::unique_ptr<PCStateBase> blockFetchPC;
+
+    /**
+     * Finds the next decoded instruction to execute at a macroop
+     * boundary. Continues the block being replayed, or looks the block
+     * at the fetch address up once the fetch has been translated and
+     * starts recording it if it isn't cached.
+     * @param translated Whether ifetch_req holds a fresh translation.
+     * @return The instruction, or nullptr if it has to be fetched.
+     */
+    const BlockInst *nextBlockInst(bool translated);
+
+    /** Adds the instruction that was just decoded to curBlock. */
+    void recordBlockInst();
+
+    /** Ends curBlock after the current instruction if needed. */
+    void endBlockInst();
+
+    /** Drops every cached block. */
+    void flushBlockCache();
+
+    /**
+     * Whether the next cycle can be simulated right away, ahead of the
+     * current tick, rather than from a new tick event. This is only done
+     * while replaying a cached block and as long as no other event is due
+     * before that cycle, so nothing can observe the difference but the
+     * tick the block's instructions see as the current one.
+     * @param ahead How far past the current tick the next cycle starts.
+     */
+    bool canRunAhead(Tick ahead) const;
+
+    /** Backdoors to the memories the software TLB points into. */
+    AddrRangeMap<MemBackdoorPtr, 1> hostTlbBackdoors;
+
+    /**
+     * Adds the page of a successful translation to the software TLB if
+     * it is plain RAM that can be accessed through a backdoor.
+     * @param flags The flags the access was issued with.
+     */
+    void fillHostTlb(const RequestPtr &req, Request::Flags flags,
+                     bool write);
+
+    /** Drops the cached blocks if code in the given range changes. */
+    void
+    invalidateBlocks(Addr paddr, Addr size)
+    {
+        if (blockCache.invalidate(paddr, size))
+            curBlock = nullptr;
+    }
+
     // main simulation loop (one cycle)
     void tick();
 
@@ -141,7 +240,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     {
 
       public:
-        AtomicCPUDPort(const std::string &_name, BaseSimpleCPU *_cpu)
+        AtomicCPUDPort(const std::string &_name, AtomicSimpleCPU *_cpu)
             : AtomicCPUPort(_name), cpu(_cpu)
         {
             cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -151,7 +250,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
         Addr cacheBlockMask;
       protected:
-        BaseSimpleCPU *cpu;
+        AtomicSimpleCPU *cpu;
 
         virtual Tick recvAtomicSnoop(PacketPtr pkt);
         virtual void recvFunctionalSnoop(PacketPtr pkt);
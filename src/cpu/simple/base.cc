@@ -44,6 +44,7 @@
 #include "arch/generic/decoder.hh"
 #include "base/cprintf.hh"
 #include "base/inifile.hh"
+#include "base/intmath.hh"
 #include "base/loader/symtab.hh"
 #include "base/logging.hh"
 #include "base/pollevent.hh"
@@ -85,8 +86,12 @@ BaseSimpleCPU::BaseSimpleCPU(const BaseSimpleCPUParams &p)
       curThread(0),
       branchPred(p.branchPred),
       traceData(NULL),
-      _status(Idle)
+      _status(Idle),
+      hostTlb(p.host_tlb_entries)
 {
+    fatal_if(!hostTlb.empty() && !isPowerOf2(hostTlb.size()),
+             "The number of software TLB entries must be a power of 2.");
+
     SimpleThread *thread;
 
     for (unsigned i = 0; i < numThreads; i++) {
@@ -269,7 +274,7 @@ BaseSimpleCPU::traceFault()
     }
 }
 
-void
+bool
 BaseSimpleCPU::checkForInterrupts()
 {
     SimpleExecContext&t_info = *threadInfo[curThread];
@@ -288,15 +293,17 @@ BaseSimpleCPU::checkForInterrupts()
                 DPRINTF(HtmCpu, "Deferring pending interrupt - %s -"
                     "due to transactional state\n",
                     interrupt->name());
-                return;
+                return false;
             }
 
             t_info.fetchOffset = 0;
             interrupts[curThread]->updateIntrInfo();
             interrupt->invoke(tc);
             thread->decoder->reset();
+            return true;
         }
     }
+    return false;
 }
 
 
@@ -324,6 +331,23 @@ BaseSimpleCPU::serviceInstCountEvents()
     t_info.thread->comInstEventQueue.serviceEvents(t_info.numInst);
 }
 
+const HostTlb::Entry *
+BaseSimpleCPU::lookupHostTlb(Addr vaddr, unsigned size, Request::Flags flags,
+                             bool write)
+{
+    return hostTlb.lookup(vaddr, size, flags, curThread,
+            threadInfo[curThread]->thread->mmu->translationEpoch(), write);
+}
+
+void
+BaseSimpleCPU::fillHostTlb(Addr vaddr, Addr paddr, Request::Flags flags,
+                           uint8_t *host_page, bool write)
+{
+    hostTlb.fill(vaddr, paddr, flags, curThread,
+            threadInfo[curThread]->thread->mmu->translationEpoch(),
+            host_page, write);
+}
+
 void
 BaseSimpleCPU::preExecute()
 {
@@ -380,6 +404,41 @@ BaseSimpleCPU::preExecute()
         curStaticInst = curMacroStaticInst->fetchMicroop(pc_state.microPC());
     }
 
+    finishPreExecute();
+}
+
+void
+BaseSimpleCPU::preExecute(const StaticInstPtr &inst,
+                          const PCStateBase &decoded_pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
+    assert(!curMacroStaticInst && !isRomMicroPC(decoded_pc.microPC()));
+
+    // resets predicates
+    t_info.setPredicate(true);
+    t_info.setMemAccPredicate(true);
+
+    t_info.stayAtPC = false;
+    thread->pcState(decoded_pc);
+
+    if (inst->isMacroop()) {
+        curMacroStaticInst = inst;
+        curStaticInst = inst->fetchMicroop(decoded_pc.microPC());
+    } else {
+        curStaticInst = inst;
+    }
+
+    finishPreExecute();
+}
+
+void
+BaseSimpleCPU::finishPreExecute()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
     //If we decoded an instruction this "tick", record information about it.
     if (curStaticInst) {
 #if TRACING_ON
@@ -487,6 +546,8 @@ BaseSimpleCPU::postExecute()
 
     // Call CPU instruction commit probes
     probeInstCommit(curStaticInst, instAddr);
+    probeBranchCommit(curStaticInst, t_info.thread->pcState(),
+                      t_info.thread->threadId());
 }
 
 void
@@ -520,9 +581,11 @@ BaseSimpleCPU::advancePC(const Fault &fault)
             // Correctly predicted branch
             branchPred->update(cur_sn, curThread);
         } else {
-            // Mis-predicted branch
+            // Mis-predicted branch. It commits right away as well, so the
+            // predictor is trained before the next branch is predicted.
             branchPred->squash(cur_sn, thread->pcState(), branching,
                     curThread);
+            branchPred->update(cur_sn, curThread);
             ++t_info.execContextStats.numBranchMispred;
         }
     }
@@ -43,6 +43,7 @@
 #define __CPU_SIMPLE_BASE_HH__
 
 #include <memory>
+#include <vector>
 
 #include "arch/generic/pcstate.hh"
 #include "base/statistics.hh"
@@ -50,6 +51,7 @@
 #include "cpu/checker/cpu.hh"
 #include "cpu/exec_context.hh"
 #include "cpu/pc_event.hh"
+#include "cpu/simple/host_tlb.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/static_inst.hh"
 #include "mem/packet.hh"
@@ -132,11 +134,48 @@ class BaseSimpleCPU : public BaseCPU
 
     std::unique_ptr<PCStateBase> preExecuteTempPC;
 
+    /** Size of the pages of the software TLB. */
+    static constexpr unsigned hostTlbPageShift = HostTlb::PageShift;
+
+    /** Software TLB of the threads, empty if it is disabled. */
+    HostTlb hostTlb;
+
+    /**
+     * Looks up the host page an access of the current thread goes to,
+     * see HostTlb::lookup.
+     * @return The entry, or nullptr if the access takes the slow path.
+     */
+    const HostTlb::Entry *lookupHostTlb(Addr vaddr, unsigned size,
+                                        Request::Flags flags, bool write);
+
+    /**
+     * Records the host page backing a translation of the current thread.
+     * @param flags The flags the access was translated with.
+     * @param host_page Host address of the start of the page.
+     */
+    void fillHostTlb(Addr vaddr, Addr paddr, Request::Flags flags,
+                     uint8_t *host_page, bool write);
+
+    /** Drops every entry of the software TLB. */
+    void flushHostTlb() { hostTlb.flush(); }
+
+    /** Tracing, branch prediction and fetch accounting shared by both
+     * versions of preExecute. */
+    void finishPreExecute();
+
   public:
-    void checkForInterrupts();
+    /** Takes a pending interrupt, if any. @return Whether one was taken. */
+    bool checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
     void preExecute();
+    /**
+     * Prepares to execute an instruction that was decoded at the current
+     * PC earlier, skipping the decoder.
+     * @param inst The instruction as returned by the decoder.
+     * @param decoded_pc The PC state the decoder produced for it.
+     */
+    void preExecute(const StaticInstPtr &inst, const PCStateBase &decoded_pc);
     void postExecute();
     void advancePC(const Fault &fault);
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_BLOCK_CACHE_HH__
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of decoded code blocks indexed by the physical address they
+ * start at. Every block is confined to a single page, and the cache keeps
+ * track of the pages holding a block so that writes to code can drop the
+ * blocks that would otherwise go stale.
+ *
+ * @tparam Block The type of the cached blocks.
+ */
+template <class Block>
+class BlockCache
+{
+  public:
+    /**
+     * @param max_entries Maximum number of cached blocks.
+     * @param page_shift Log2 of the size of the pages blocks live in.
+     */
+    BlockCache(unsigned max_entries, unsigned page_shift)
+        : maxEntries(max_entries), pageShift(page_shift)
+    {}
+
+    /** @return The block starting at paddr, or nullptr if none. */
+    Block *
+    find(Addr paddr)
+    {
+        auto it = blocks.find(paddr);
+        return it == blocks.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * Returns the block starting at paddr, allocating it if needed. All
+     * blocks are dropped first if the cache is full, so any pointer to a
+     * block obtained before may be invalid afterwards.
+     */
+    Block &
+    insert(Addr paddr)
+    {
+        if (blocks.size() >= maxEntries && !blocks.count(paddr))
+            flush();
+        pages.insert(paddr >> pageShift);
+        return blocks[paddr];
+    }
+
+    /**
+     * Drops every block if the range written to overlaps a page holding
+     * a block.
+     * @return Whether the blocks were dropped.
+     */
+    bool
+    invalidate(Addr paddr, Addr size)
+    {
+        if (pages.empty() || !size)
+            return false;
+        for (Addr page = paddr >> pageShift;
+                page <= (paddr + size - 1) >> pageShift; ++page) {
+            if (pages.count(page)) {
+                flush();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Drops every block. */
+    void
+    flush()
+    {
+        blocks.clear();
+        pages.clear();
+    }
+
+    size_t size() const { return blocks.size(); }
+    bool empty() const { return blocks.empty(); }
+
+  private:
+    const unsigned maxEntries;
+    const unsigned pageShift;
+
+    std::unordered_map<Addr, Block> blocks;
+    /** Pages holding the code of a cached block. */
+    std::unordered_set<Addr> pages;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_BLOCK_CACHE_HH__
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "cpu/simple/block_cache.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+constexpr unsigned PageShift = 12;
+constexpr Addr PageSize = 1ULL << PageShift;
+
+} // anonymous namespace
+
+TEST(BlockCacheTest, FindInserted)
+{
+    BlockCache<int> cache(4, PageShift);
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.find(0x1000), nullptr);
+
+    cache.insert(0x1000) = 1;
+    cache.insert(0x1010) = 2;
+    EXPECT_EQ(cache.size(), 2);
+    ASSERT_NE(cache.find(0x1000), nullptr);
+    EXPECT_EQ(*cache.find(0x1000), 1);
+    ASSERT_NE(cache.find(0x1010), nullptr);
+    EXPECT_EQ(*cache.find(0x1010), 2);
+    EXPECT_EQ(cache.find(0x1008), nullptr);
+}
+
+TEST(BlockCacheTest, InsertExisting)
+{
+    BlockCache<int> cache(1, PageShift);
+    cache.insert(0x1000) = 1;
+    // Allocating a block that is already cached never flushes.
+    EXPECT_EQ(cache.insert(0x1000), 1);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(BlockCacheTest, FlushWhenFull)
+{
+    BlockCache<int> cache(2, PageShift);
+    cache.insert(0x1000) = 1;
+    cache.insert(0x2000) = 2;
+    cache.insert(0x3000) = 3;
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.find(0x1000), nullptr);
+    EXPECT_EQ(cache.find(0x2000), nullptr);
+    ASSERT_NE(cache.find(0x3000), nullptr);
+    EXPECT_EQ(*cache.find(0x3000), 3);
+
+    // The pages of the dropped blocks no longer hold code.
+    EXPECT_FALSE(cache.invalidate(0x1000, 4));
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(BlockCacheTest, Flush)
+{
+    BlockCache<int> cache(4, PageShift);
+    cache.insert(0x1000) = 1;
+    cache.insert(0x5000) = 2;
+    cache.flush();
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.find(0x1000), nullptr);
+    EXPECT_EQ(cache.find(0x5000), nullptr);
+
+    // Writes to the pages the blocks were in are plain data writes now.
+    EXPECT_FALSE(cache.invalidate(0x1000, 8));
+    EXPECT_FALSE(cache.invalidate(0x5000, 8));
+
+    cache.insert(0x5000) = 3;
+    EXPECT_EQ(*cache.find(0x5000), 3);
+}
+
+TEST(BlockCacheTest, CodeWriteInvalidates)
+{
+    BlockCache<int> cache(4, PageShift);
+    cache.insert(0x1040) = 1;
+    cache.insert(0x3000) = 2;
+
+    // A write anywhere in a page holding a block drops every block, even
+    // if it doesn't overlap the block itself.
+    EXPECT_TRUE(cache.invalidate(0x1ff8, 8));
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.find(0x1040), nullptr);
+    EXPECT_EQ(cache.find(0x3000), nullptr);
+}
+
+TEST(BlockCacheTest, DataWriteKeepsBlocks)
+{
+    BlockCache<int> cache(4, PageShift);
+    cache.insert(0x1040) = 1;
+
+    EXPECT_FALSE(cache.invalidate(0x0ff8, 8));
+    EXPECT_FALSE(cache.invalidate(0x2000, 64));
+    EXPECT_FALSE(cache.invalidate(0x1040, 0));
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(*cache.find(0x1040), 1);
+}
+
+TEST(BlockCacheTest, StraddlingWriteInvalidates)
+{
+    BlockCache<int> cache(4, PageShift);
+    cache.insert(0x2000) = 1;
+
+    // The write starts in the page before the block's.
+    EXPECT_TRUE(cache.invalidate(PageSize * 2 - 4, 8));
+    EXPECT_TRUE(cache.empty());
+
+    cache.insert(0x2000) = 1;
+    // The write covers the block's page entirely.
+    EXPECT_TRUE(cache.invalidate(0x0, PageSize * 4));
+    EXPECT_TRUE(cache.empty());
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_HOST_TLB_HH__
+#define __CPU_SIMPLE_HOST_TLB_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/types.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+/**
+ * A direct-mapped software TLB, which maps virtual pages straight to the
+ * host memory backing them so that loads and stores to RAM can skip both
+ * the MMU and the memory system. Entries are tagged with the translation
+ * epoch of the MMU they were filled from, so that anything flushing the
+ * MMU's TLBs also drops them.
+ */
+class HostTlb
+{
+  public:
+    struct Entry
+    {
+        /** Virtual page number, MaxAddr if the entry is unused. */
+        Addr vpn = MaxAddr;
+        ThreadID tid = InvalidThreadID;
+        /** Architecture specific flags of the translated requests. */
+        Request::ArchFlagsType archFlags = 0;
+        /** MMU translation epoch the entry was filled in. */
+        uint64_t epoch = 0;
+        /** Physical address of the page. */
+        Addr paddr = 0;
+        /** Host address of the page. */
+        uint8_t *host = nullptr;
+        bool readable = false;
+        bool writable = false;
+    };
+
+    /** Size of the pages; no larger than the smallest page size of any
+     * supported ISA. */
+    static constexpr unsigned PageShift = 12;
+
+    /** @param num_entries Number of entries, a power of 2, or 0. */
+    explicit HostTlb(unsigned num_entries) : entries(num_entries) {}
+
+    /** Whether the TLB is disabled. */
+    bool empty() const { return entries.empty(); }
+
+    size_t size() const { return entries.size(); }
+
+    /** Disables the TLB for good. */
+    void clear() { entries.clear(); }
+
+    /**
+     * Looks up the host page an access goes to. Only naturally aligned
+     * accesses without any flags other than architecture specific ones
+     * are eligible, so that they neither cross a page nor need alignment
+     * or ordering checks.
+     * @param epoch Current translation epoch of the thread's MMU.
+     * @return The entry, or nullptr if the access takes the slow path.
+     */
+    const Entry *
+    lookup(Addr vaddr, unsigned size, Request::Flags flags, ThreadID tid,
+           uint64_t epoch, bool write) const
+    {
+        if (entries.empty() || !isPowerOf2(size) || (vaddr & (size - 1)) ||
+                flags.isSet(~Request::FlagsType(Request::ARCH_BITS))) {
+            return nullptr;
+        }
+
+        Addr vpn = vaddr >> PageShift;
+        const Entry &entry = entries[vpn & (entries.size() - 1)];
+        if (entry.vpn != vpn || entry.tid != tid ||
+                entry.archFlags != (flags & Request::ARCH_BITS) ||
+                entry.epoch != epoch ||
+                !(write ? entry.writable : entry.readable)) {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    /**
+     * Records the host page backing a translation.
+     * @param flags The flags the access was translated with.
+     * @param epoch Translation epoch of the MMU that did the translation.
+     * @param host_page Host address of the start of the page.
+     */
+    void
+    fill(Addr vaddr, Addr paddr, Request::Flags flags, ThreadID tid,
+         uint64_t epoch, uint8_t *host_page, bool write)
+    {
+        if (entries.empty())
+            return;
+
+        Addr vpn = vaddr >> PageShift;
+        Addr ppage = paddr & ~mask(PageShift);
+        Request::ArchFlagsType arch_flags = flags & Request::ARCH_BITS;
+
+        Entry &entry = entries[vpn & (entries.size() - 1)];
+        if (entry.vpn != vpn || entry.tid != tid ||
+                entry.archFlags != arch_flags || entry.epoch != epoch ||
+                entry.paddr != ppage) {
+            entry = Entry();
+            entry.vpn = vpn;
+            entry.tid = tid;
+            entry.archFlags = arch_flags;
+            entry.epoch = epoch;
+            entry.paddr = ppage;
+            entry.host = host_page;
+        }
+
+        // Reads and writes are translated, and thus allowed, separately.
+        if (write)
+            entry.writable = true;
+        else
+            entry.readable = true;
+    }
+
+    /** Drops every entry. */
+    void
+    flush()
+    {
+        for (auto &entry : entries)
+            entry.vpn = MaxAddr;
+    }
+
+  private:
+    std::vector<Entry> entries;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_HOST_TLB_HH__
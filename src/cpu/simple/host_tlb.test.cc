@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "cpu/simple/host_tlb.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+constexpr Addr PageSize = 1ULL << HostTlb::PageShift;
+
+uint8_t page[PageSize];
+
+} // anonymous namespace
+
+TEST(HostTlbTest, LookupFilled)
+{
+    HostTlb tlb(4);
+    EXPECT_EQ(tlb.lookup(0x1008, 8, 0, 0, 0, false), nullptr);
+
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, false);
+    const HostTlb::Entry *entry = tlb.lookup(0x1008, 8, 0, 0, 0, false);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->host, page);
+    EXPECT_EQ(entry->paddr, 0x8000);
+
+    // Only reads were translated so far.
+    EXPECT_EQ(tlb.lookup(0x1008, 8, 0, 0, 0, true), nullptr);
+    tlb.fill(0x1010, 0x8010, 0, 0, 0, page, true);
+    EXPECT_NE(tlb.lookup(0x1008, 8, 0, 0, 0, true), nullptr);
+    EXPECT_NE(tlb.lookup(0x1008, 8, 0, 0, 0, false), nullptr);
+}
+
+TEST(HostTlbTest, IneligibleAccesses)
+{
+    HostTlb tlb(4);
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, false);
+
+    // Misaligned accesses could cross the page.
+    EXPECT_EQ(tlb.lookup(0x1004, 8, 0, 0, 0, false), nullptr);
+    EXPECT_EQ(tlb.lookup(0x1000, 6, 0, 0, 0, false), nullptr);
+    // Accesses with generic flags need the slow path.
+    EXPECT_EQ(tlb.lookup(0x1000, 8, Request::UNCACHEABLE, 0, 0, false),
+              nullptr);
+}
+
+TEST(HostTlbTest, TaggedWithThreadAndArchFlags)
+{
+    HostTlb tlb(4);
+    tlb.fill(0x1000, 0x8000, 0x1, 0, 0, page, false);
+
+    EXPECT_NE(tlb.lookup(0x1000, 8, 0x1, 0, 0, false), nullptr);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0x2, 0, 0, false), nullptr);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0x1, 1, 0, false), nullptr);
+}
+
+/**
+ * BaseSimpleCPU fills and looks up entries with the translation epoch of
+ * the thread's MMU, which BaseMMU::flushAll and BaseMMU::demapPage bump.
+ * The translations cached before are then dropped.
+ */
+TEST(HostTlbTest, EpochBumpInvalidates)
+{
+    HostTlb tlb(4);
+    uint64_t epoch = 7;
+    tlb.fill(0x1000, 0x8000, 0, 0, epoch, page, false);
+    tlb.fill(0x1000, 0x8000, 0, 0, epoch, page, true);
+    ASSERT_NE(tlb.lookup(0x1000, 8, 0, 0, epoch, false), nullptr);
+
+    ++epoch;
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, epoch, false), nullptr);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, epoch, true), nullptr);
+
+    // Refilling in the new epoch doesn't keep any stale permission.
+    tlb.fill(0x1000, 0x8000, 0, 0, epoch, page, false);
+    EXPECT_NE(tlb.lookup(0x1000, 8, 0, 0, epoch, false), nullptr);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, epoch, true), nullptr);
+}
+
+TEST(HostTlbTest, RefillWithNewMapping)
+{
+    HostTlb tlb(4);
+    uint8_t other_page[PageSize];
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, true);
+    tlb.fill(0x1000, 0x9000, 0, 0, 0, other_page, false);
+
+    const HostTlb::Entry *entry = tlb.lookup(0x1000, 8, 0, 0, 0, false);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->host, other_page);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, 0, true), nullptr);
+}
+
+TEST(HostTlbTest, Conflict)
+{
+    HostTlb tlb(4);
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, false);
+    tlb.fill(0x1000 + 4 * PageSize, 0x9000, 0, 0, 0, page, false);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, 0, false), nullptr);
+    EXPECT_NE(tlb.lookup(0x1000 + 4 * PageSize, 8, 0, 0, 0, false),
+              nullptr);
+}
+
+TEST(HostTlbTest, FlushAndDisable)
+{
+    HostTlb tlb(4);
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, false);
+    tlb.flush();
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, 0, false), nullptr);
+
+    tlb.clear();
+    EXPECT_TRUE(tlb.empty());
+    tlb.fill(0x1000, 0x8000, 0, 0, 0, page, false);
+    EXPECT_EQ(tlb.lookup(0x1000, 8, 0, 0, 0, false), nullptr);
+}
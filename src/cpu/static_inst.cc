@@ -35,6 +35,8 @@
 namespace gem5
 {
 
+std::atomic<uint64_t> StaticInst::nextSerial{0};
+
 StaticInstPtr
 StaticInst::fetchMicroop(MicroPC upc) const
 {
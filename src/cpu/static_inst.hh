@@ -44,6 +44,7 @@
 #define __CPU_STATIC_INST_HH__
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <cstdint>
 #include <memory>
@@ -97,6 +98,13 @@ class StaticInst : public RefCounted, public StaticInstFlags
     /// See destRegIdx().
     RegIdArrayPtr _destRegIdxPtr = nullptr;
 
+    /// Source of serial numbers; see serial().
+    static std::atomic<uint64_t> nextSerial;
+
+    /// See serial().
+    const uint64_t _serial =
+        nextSerial.fetch_add(1, std::memory_order_relaxed);
+
   protected:
 
     /// Flag values for this instruction.
@@ -213,6 +221,11 @@ class StaticInst : public RefCounted, public StaticInstFlags
     /// Operation class.  Used to select appropriate function unit in issue.
     OpClass opClass() const { return _opClass; }
 
+    /// A number identifying this instruction object. Unlike its address,
+    /// it is never reused by another instruction, so it can name an
+    /// instruction in a table that doesn't hold a reference to it.
+    uint64_t serial() const { return _serial; }
+
 
     /// Return logical index (architectural reg num) of i'th destination reg.
     /// Only the entries from 0 through numDestRegs()-1 are valid.
@@ -67,6 +67,14 @@ class TraceCPU(ClockedObject):
     sizeLoadBuffer = Param.Unsigned(16, "Number of entries in the load buffer")
     sizeROB = Param.Unsigned(40, "Number of entries in the re-order buffer")
 
+    # Decoding the protobuf records of the data dependency trace on a helper
+    # thread, a window ahead of the replay, takes it off the critical path of
+    # the simulation. The replay itself is unaffected. It is off by default
+    # so that a TraceCPU doesn't start a host thread unless asked to.
+    asyncTraceDecode = Param.Bool(
+        False, "Decode the data dependency trace on a helper thread"
+    )
+
     # Frequency multiplier used to effectively scale the Trace CPU frequency
     # either up or down. Note that the Trace CPU's clock domain must also be
     # changed when frequency is scaled. A default value of 1.0 means the same
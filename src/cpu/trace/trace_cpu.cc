@@ -37,6 +37,8 @@
 
 #include "cpu/trace/trace_cpu.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "sim/sim_exit.hh"
 #include "sim/system.hh"
@@ -306,13 +308,14 @@ TraceCPU::ElasticDataGen::readNextWindow()
     while (num_read != windowSize) {
 
         // Create a new graph node
-        GraphNode* new_node = new GraphNode;
+        GraphNode* new_node = allocNode();
 
         // Read the next line to get the next record. If that fails then end of
         // trace has been reached and traceComplete needs to be set in addition
         // to returning false.
         if (!trace.read(new_node)) {
             DPRINTF(TraceCPUData, "\tTrace complete!\n");
+            freeNode(new_node);
             traceComplete = true;
             return false;
         }
@@ -339,6 +342,28 @@ TraceCPU::ElasticDataGen::readNextWindow()
     return true;
 }
 
+TraceCPU::ElasticDataGen::GraphNode *
+TraceCPU::ElasticDataGen::allocNode()
+{
+    if (freeNodes.empty()) {
+        // Grow the arena by a window worth of nodes at a time
+        const size_t chunk_size = std::max<size_t>(windowSize, 64);
+        nodeChunks.emplace_back(new GraphNode[chunk_size]);
+        GraphNode *chunk = nodeChunks.back().get();
+        for (size_t i = chunk_size; i > 0; i--)
+            freeNodes.push_back(&chunk[i - 1]);
+    }
+    GraphNode *node = freeNodes.back();
+    freeNodes.pop_back();
+    return node;
+}
+
+void
+TraceCPU::ElasticDataGen::freeNode(GraphNode *node)
+{
+    freeNodes.push_back(node);
+}
+
 template<typename T>
 void
 TraceCPU::ElasticDataGen::addDepsOnParent(GraphNode *new_node, T& dep_list)
@@ -504,7 +529,7 @@ TraceCPU::ElasticDataGen::execute()
             // Update the stat for numOps simulated
             owner.updateNumOps(node_ptr->robNum);
             // delete node
-            delete node_ptr;
+            freeNode(node_ptr);
             // remove from graph
             depGraph.erase(graph_itr);
         }
@@ -712,7 +737,7 @@ TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
         // Update the stat for numOps completed
         owner.updateNumOps(node_ptr->robNum);
         // delete node
-        delete node_ptr;
+        freeNode(node_ptr);
         // remove from graph
         depGraph.erase(graph_itr);
     }
@@ -1203,10 +1228,17 @@ TraceCPU::DcachePort::recvReqRetry()
 }
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
-        const std::string& filename, const double time_multiplier) :
+        const std::string& filename, const double time_multiplier,
+        bool async_decode) :
     trace(filename),
     timeMultiplier(time_multiplier),
-    microOpCount(0)
+    microOpCount(0),
+    readMicroOpCount(0),
+    async(async_decode),
+    readBatch(0),
+    readPos(0),
+    haveBatch(false),
+    stopping(false)
 {
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::InstDepRecordHeader header_msg;
@@ -1222,16 +1254,137 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
         // when the data dependency trace was captured in the o3cpu model
         windowSize = header_msg.window_size();
     }
+
+    if (async) {
+        // Decode a window worth of nodes ahead of the simulation
+        for (auto &batch : batches)
+            batch.nodes.resize(std::max<uint32_t>(windowSize, 64));
+        startDecoder();
+    }
+}
+
+TraceCPU::ElasticDataGen::InputStream::~InputStream()
+{
+    stopDecoder();
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::startDecoder()
+{
+    stopping = false;
+    readBatch = 0;
+    readPos = 0;
+    haveBatch = false;
+    for (auto &batch : batches) {
+        batch.size = 0;
+        batch.last = false;
+        batch.full = false;
+    }
+    decoder = std::thread([this]() { decodeLoop(); });
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::stopDecoder()
+{
+    if (!decoder.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batchChanged.notify_all();
+    decoder.join();
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::decodeLoop()
+{
+    for (unsigned idx = 0; ; idx ^= 1) {
+        Batch &batch = batches[idx];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchChanged.wait(lock, [&]() { return stopping || !batch.full; });
+            if (stopping)
+                return;
+        }
+
+        // The batch is owned by this thread until it is marked full
+        size_t size = 0;
+        bool last = false;
+        while (size < batch.nodes.size()) {
+            if (!decode(&batch.nodes[size])) {
+                last = true;
+                break;
+            }
+            size++;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batch.size = size;
+            batch.last = last;
+            batch.full = true;
+        }
+        batchChanged.notify_all();
+
+        if (last)
+            return;
+    }
 }
 
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
+    stopDecoder();
     trace.reset();
+    microOpCount = 0;
+    readMicroOpCount = 0;
+    if (async)
+        startDecoder();
 }
 
 bool
 TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
+{
+    if (!async) {
+        if (!decode(element))
+            return false;
+        readMicroOpCount = element->robNum;
+        return true;
+    }
+
+    while (true) {
+        Batch &batch = batches[readBatch];
+        if (!haveBatch) {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchChanged.wait(lock, [&]() { return batch.full; });
+            haveBatch = true;
+            readPos = 0;
+        }
+
+        if (readPos < batch.size) {
+            *element = std::move(batch.nodes[readPos++]);
+            readMicroOpCount = element->robNum;
+            return true;
+        }
+
+        if (batch.last)
+            return false;
+
+        // Hand the consumed batch back to the helper thread
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batch.full = false;
+        }
+        batchChanged.notify_all();
+        readBatch ^= 1;
+        haveBatch = false;
+    }
+}
+
+bool
+TraceCPU::ElasticDataGen::InputStream::decode(GraphNode* element)
 {
     ProtoMessage::InstDepRecord pkt_msg;
     if (trace.read(pkt_msg)) {
@@ -1241,6 +1394,8 @@ TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
         // Scale the compute delay to effectively scale the Trace CPU frequency
         element->compDelay = pkt_msg.comp_delay() * timeMultiplier;
 
+        element->dependents.clear();
+
         // Repeated field robDepList
         element->robDep.clear();
         for (int i = 0; i < (pkt_msg.rob_dep()).size(); i++) {
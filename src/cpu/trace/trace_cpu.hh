@@ -38,11 +38,16 @@
 #ifndef __CPU_TRACE_TRACE_CPU_HH__
 #define __CPU_TRACE_TRACE_CPU_HH__
 
+#include <condition_variable>
 #include <cstdint>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "debug/TraceCPUData.hh"
@@ -742,6 +747,10 @@ class TraceCPU : public ClockedObject
          * The InputStream encapsulates a trace file and the
          * internal buffers and populates GraphNodes based on
          * the input.
+         *
+         * Decoding the protobuf records can optionally be done on a helper
+         * thread, which fills two batches of GraphNodes in turn while the
+         * simulation consumes the other one.
          */
         class InputStream
         {
@@ -757,24 +766,70 @@ class TraceCPU : public ClockedObject
              */
             const double timeMultiplier;
 
-            /** Count of committed ops read from trace plus the filtered ops */
+            /**
+             * Count of committed ops decoded from the trace plus the
+             * filtered ops
+             */
             uint64_t microOpCount;
 
+            /** Count of committed ops up to the last node read */
+            uint64_t readMicroOpCount;
+
             /**
              * The window size that is read from the header of the protobuf
              * trace and used to process the dependency trace
              */
             uint32_t windowSize;
 
+            /** Nodes decoded ahead of the simulation by the helper thread */
+            struct Batch
+            {
+                std::vector<GraphNode> nodes;
+                /** Number of valid nodes */
+                size_t size = 0;
+                /** The end of the trace follows the last valid node */
+                bool last = false;
+                /** Filled by the helper thread, not yet consumed */
+                bool full = false;
+            };
+
+            /** Decode nodes on a helper thread */
+            const bool async;
+
+            Batch batches[2];
+
+            /** The batch being consumed and the position within it */
+            unsigned readBatch;
+            size_t readPos;
+            bool haveBatch;
+
+            std::thread decoder;
+            std::mutex mutex;
+            std::condition_variable batchChanged;
+            bool stopping;
+
+            /** Decode the next record of the trace into a node */
+            bool decode(GraphNode* element);
+
+            /** Body of the helper thread, filling the batches in turn */
+            void decodeLoop();
+
+            void startDecoder();
+            void stopDecoder();
+
           public:
             /**
              * Create a trace input stream for a given file name.
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param async_decode decode the trace on a helper thread
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier,
+                        bool async_decode);
+
+            ~InputStream();
 
             /**
              * Reset the stream such that it can be played once
@@ -797,7 +852,7 @@ class TraceCPU : public ClockedObject
             uint32_t getWindowSize() const { return windowSize; }
 
             /** Get number of micro-ops modelled in the TraceCPU replay */
-            uint64_t getMicroOpCount() const { return microOpCount; }
+            uint64_t getMicroOpCount() const { return readMicroOpCount; }
         };
 
         public:
@@ -809,7 +864,8 @@ class TraceCPU : public ClockedObject
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file, 1.0 / params.freqMultiplier),
+            trace(trace_file, 1.0 / params.freqMultiplier,
+                  params.asyncTraceDecode),
             genName(owner.name() + ".elastic." + _name),
             retryPkt(nullptr),
             traceComplete(false),
@@ -821,6 +877,7 @@ class TraceCPU : public ClockedObject
         {
             DPRINTF(TraceCPUData, "Window size in the trace is %d.\n",
                     windowSize);
+            depGraph.reserve(2 * windowSize);
         }
 
         /**
@@ -978,6 +1035,21 @@ class TraceCPU : public ClockedObject
         /** Store the depGraph of GraphNodes */
         std::unordered_map<NodeSeqNum, GraphNode*> depGraph;
 
+        /**
+         * Flat arena the GraphNodes of the dependency window are allocated
+         * from. It grows in chunks of nodes which are recycled through
+         * freeNodes as nodes complete, rather than allocating and freeing
+         * every node individually.
+         */
+        std::vector<std::unique_ptr<GraphNode[]>> nodeChunks;
+        std::vector<GraphNode *> freeNodes;
+
+        /** Allocate a node from the arena. */
+        GraphNode *allocNode();
+
+        /** Return a completed node to the arena. */
+        void freeNode(GraphNode *node);
+
         /**
          * Queue of dependency-free nodes that are pending issue because
          * resources are not available. This is chosen to be FIFO so that
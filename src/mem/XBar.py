@@ -154,6 +154,16 @@ class SnoopFilter(SimObject):
     # Sanity check on max capacity to track, adjust if needed.
     max_capacity = Param.MemorySize("8MiB", "Maximum capacity of snoop filter")
 
+    # Associativity of the snoop filter. If non-zero, the filter holds at
+    # most max_capacity worth of entries, and evicts the least recently
+    # used entry of a full set, back-invalidating its holders.
+    assoc = Param.Unsigned(0, "Associativity, 0 for an unbounded filter")
+
+    # Allocate the entries of a bounded filter for coarse-grain regions
+    # (e.g. 1KiB) instead of individual cache lines. The entry of a region
+    # holds the sharers of each of its lines, and is evicted as a whole.
+    region_size = Param.MemorySize("0B", "Region size, 0 to track lines")
+
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
@@ -44,6 +44,7 @@ from m5.objects.Tags import *
 from m5.params import *
 from m5.proxy import *
 from m5.SimObject import SimObject
+from m5.util.pybind import PyBindMethod
 
 
 # Enum for cache clusivity, currently mostly inclusive or mostly
@@ -83,6 +84,11 @@ class BaseCache(ClockedObject):
     cxx_header = "mem/cache/base.hh"
     cxx_class = "gem5::BaseCache"
 
+    cxx_exports = [
+        PyBindMethod("setFunctionalWarming"),
+        PyBindMethod("functionalWarmingConverged"),
+    ]
+
     size = Param.MemorySize("Capacity")
     assoc = Param.Unsigned("Associativity")
 
@@ -98,6 +104,23 @@ class BaseCache(ClockedObject):
         0, "Number of misses to handle before calling exit"
     )
 
+    # Functional warming only maintains tag and replacement state during
+    # atomic fast-forwarding. It is enabled at run time through
+    # setFunctionalWarming(), or whenever the system is in atomic mode if
+    # functional_warming is set. If a window is given, the miss
+    # ratio of consecutive windows is compared and the cache stops
+    # warming (freezes its contents) once it changes by less than the
+    # threshold.
+    functional_warming = Param.Bool(
+        False, "Warm functionally whenever the system is in atomic mode"
+    )
+    warming_window = Param.Counter(
+        0, "Accesses per warming convergence window (0 to disable)"
+    )
+    warming_threshold = Param.Float(
+        0.001, "Miss ratio change below which warming has converged"
+    )
+
     mshrs = Param.Unsigned("Number of MSHRs (max outstanding requests)")
     demand_mshr_reserve = Param.Unsigned(1, "MSHRs reserved for demand access")
     tgts_per_mshr = Param.Unsigned("Max number of accesses per MSHR")
@@ -132,6 +155,12 @@ class BaseCache(ClockedObject):
         False, "Whether to access tags and data sequentially"
     )
 
+    checkpoint_contents = Param.Bool(
+        False,
+        "Save the valid blocks (including dirty data and replacement "
+        "state) in checkpoints, so that restored runs start warm",
+    )
+
     cpu_side = ResponsePort("Upstream port closer to the CPU and/or device")
     mem_side = RequestPort("Downstream port closer to memory")
 
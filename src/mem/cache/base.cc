@@ -45,6 +45,13 @@
 
 #include "mem/cache/base.hh"
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -52,6 +59,7 @@
 #include "debug/CachePort.hh"
 #include "debug/CacheRepl.hh"
 #include "debug/CacheVerbose.hh"
+#include "debug/Checkpoint.hh"
 #include "debug/HWPrefetch.hh"
 #include "mem/cache/compressors/base.hh"
 #include "mem/cache/mshr.hh"
@@ -102,6 +110,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       fillLatency(p.data_latency),
       responseLatency(p.response_latency),
       sequentialAccess(p.sequential_access),
+      checkpointContents(p.checkpoint_contents),
       numTarget(p.tgts_per_mshr),
       forwardSnoops(true),
       clusivity(p.clusivity),
@@ -112,6 +121,14 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       order(0),
       noTargetMSHR(nullptr),
       missCount(p.max_miss_count),
+      functionalWarming(false),
+      autoWarming(p.functional_warming),
+      warmingFrozen(false),
+      warmingWindow(p.warming_window),
+      warmingThreshold(p.warming_threshold),
+      warmingAccesses(0),
+      warmingMisses(0),
+      warmingLastRatio(-1.0),
       addrRanges(p.addr_ranges.begin(), p.addr_ranges.end()),
       system(p.system),
       stats(*this)
@@ -201,6 +218,96 @@ BaseCache::init()
     forwardSnoops = cpuSidePort.isSnooping();
 }
 
+void
+BaseCache::startup()
+{
+    updateFunctionalWarming();
+}
+
+void
+BaseCache::drainResume()
+{
+    // CPU switches change the memory mode while the system is drained
+    updateFunctionalWarming();
+}
+
+void
+BaseCache::updateFunctionalWarming()
+{
+    if (autoWarming && functionalWarming != system->isAtomicMode())
+        setFunctionalWarming(system->isAtomicMode());
+}
+
+void
+BaseCache::setFunctionalWarming(bool enable)
+{
+    DPRINTF(Cache, "%s functional warming\n",
+            enable ? "Entering" : "Leaving");
+    functionalWarming = enable;
+    warmingFrozen = false;
+    warmingAccesses = 0;
+    warmingMisses = 0;
+    warmingLastRatio = -1.0;
+}
+
+void
+BaseCache::warmingAccess(bool miss)
+{
+    if (!warmingWindow || warmingFrozen)
+        return;
+
+    warmingMisses += miss;
+    if (++warmingAccesses < warmingWindow)
+        return;
+
+    const double ratio = double(warmingMisses) / warmingAccesses;
+    if (warmingLastRatio >= 0 &&
+        std::abs(ratio - warmingLastRatio) <= warmingThreshold) {
+        inform("%s: functional warming converged (miss ratio %.4f), "
+               "freezing contents\n", name(), ratio);
+        warmingFrozen = true;
+    }
+    warmingLastRatio = ratio;
+    warmingAccesses = 0;
+    warmingMisses = 0;
+}
+
+bool
+BaseCache::warmAtomic(PacketPtr pkt)
+{
+    // Only plain reads and writes are handled here. Misses, upgrades
+    // and anything else that needs to allocate, write back or snoop
+    // go through the regular atomic path to keep the hierarchy
+    // coherent.
+    if (pkt->req->isUncacheable() || pkt->req->isCacheMaintenance() ||
+        pkt->isLLSC() || pkt->isEviction() || pkt->isClean() ||
+        !(pkt->isRead() || pkt->isWrite())) {
+        return false;
+    }
+
+    CacheBlk *blk = tags->findBlock(pkt->getAddr(), pkt->isSecure());
+    if (!blk || !(pkt->needsWritable() ?
+                  blk->isSet(CacheBlk::WritableBit) :
+                  blk->isSet(CacheBlk::ReadableBit))) {
+        return false;
+    }
+
+    // A converged cache leaves its replacement state untouched
+    if (!warmingFrozen) {
+        tags->touchBlock(blk, pkt);
+    }
+    warmingAccess(false);
+
+    satisfyRequest(pkt, blk);
+    maintainClusivity(pkt->fromCache(), blk);
+
+    if (pkt->needsResponse()) {
+        pkt->makeAtomicResponse();
+    }
+
+    return true;
+}
+
 Port &
 BaseCache::getPort(const std::string &if_name, PortID idx)
 {
@@ -641,6 +748,12 @@ BaseCache::recvAtomic(PacketPtr pkt)
     // writebacks... that would mean that someone used an atomic
     // access in timing mode
 
+    // While warming, hits are handled without any latency or stats
+    // bookkeeping; everything else takes the regular path below
+    if (GEM5_UNLIKELY(functionalWarming) && warmAtomic(pkt)) {
+        return 0;
+    }
+
     // We use lookupLatency here because it is used to specify the latency
     // to access.
     Cycles lat = lookupLatency;
@@ -711,7 +824,8 @@ BaseCache::recvAtomic(PacketPtr pkt)
         pkt->makeAtomicResponse();
     }
 
-    return lat * clockPeriod();
+    // Latency is meaningless while warming, so do not charge any
+    return functionalWarming ? 0 : lat * clockPeriod();
 }
 
 void
@@ -969,7 +1083,8 @@ BaseCache::handleEvictions(std::vector<CacheBlk*> &evict_blks,
     // The victim will be replaced by a new entry, so increase the replacement
     // counter if a valid block is being replaced
     if (replacement) {
-        stats.replacements++;
+        if (!functionalWarming)
+            stats.replacements++;
 
         // Evict valid blocks associated to this victim block
         for (auto& blk : evict_blks) {
@@ -1251,7 +1366,13 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
 
     // Access block in the tags
     Cycles tag_latency(0);
-    blk = tags->accessBlock(pkt, tag_latency);
+    if (GEM5_UNLIKELY(warmingFrozen)) {
+        // A converged cache only looks up its contents, leaving the
+        // replacement state untouched
+        blk = tags->findBlock(pkt->getAddr(), pkt->isSecure());
+    } else {
+        blk = tags->accessBlock(pkt, tag_latency);
+    }
 
     DPRINTF(Cache, "%s for %s %s\n", __func__, pkt->print(),
             blk ? "hit " + blk->print() : "miss");
@@ -1618,6 +1739,12 @@ BaseCache::handleFill(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
 CacheBlk*
 BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
 {
+    // A cache whose warming has converged keeps its contents as they
+    // are; fills then go through the temporary block and writebacks
+    // are forwarded to the next level
+    if (GEM5_UNLIKELY(warmingFrozen))
+        return nullptr;
+
     // Get address
     const Addr addr = pkt->getAddr();
 
@@ -2008,6 +2135,14 @@ BaseCache::sendWriteQueuePacket(WriteQueueEntry* wq_entry)
 void
 BaseCache::serialize(CheckpointOut &cp) const
 {
+    if (checkpointContents) {
+        // Dirty data is saved along with the rest of the contents
+        bool bad_checkpoint(false);
+        SERIALIZE_SCALAR(bad_checkpoint);
+        serializeContents(cp);
+        return;
+    }
+
     bool dirty(isDirty());
 
     if (dirty) {
@@ -2035,6 +2170,190 @@ BaseCache::unserialize(CheckpointIn &cp)
               "supported in the classic memory system. Please remove any "
               "caches or drain them properly before taking checkpoints.\n");
     }
+
+    std::string filename;
+    if (UNSERIALIZE_OPT_SCALAR(filename)) {
+        unserializeContents(cp, filename);
+    }
+}
+
+namespace
+{
+
+/**
+ * Flag stored alongside the coherence bits of a checkpointed block to
+ * mark it as secure; the coherence bits never use the lowest bit.
+ */
+constexpr uint8_t CptSecureFlag = 0x01;
+
+} // anonymous namespace
+
+void
+BaseCache::serializeContents(CheckpointOut &cp) const
+{
+    std::vector<Addr> blk_addr;
+    std::vector<uint8_t> blk_state;
+    std::vector<uint32_t> blk_requestor;
+    std::vector<uint64_t> blk_repl;
+
+    std::string filename = name() + ".blocks";
+    std::string filepath = CheckpointIn::dir() + "/" + filename;
+    gzFile compressed_data = gzopen(filepath.c_str(), "wb");
+    if (compressed_data == NULL)
+        fatal("Can't open cache checkpoint file '%s'\n", filename);
+
+    tags->forEachBlk([&](CacheBlk &blk) {
+        if (!blk.isValid())
+            return;
+
+        uint8_t state = blk.isSecure() ? CptSecureFlag : 0;
+        for (auto bit : {CacheBlk::WritableBit, CacheBlk::ReadableBit,
+                         CacheBlk::DirtyBit}) {
+            if (blk.isSet(bit))
+                state |= bit;
+        }
+
+        blk_addr.push_back(tags->regenerateBlkAddr(&blk));
+        blk_state.push_back(state);
+        blk_requestor.push_back(blk.getSrcRequestorId());
+        blk_repl.push_back(tags->getReplacementState(&blk));
+
+        if (gzwrite(compressed_data, blk.data, blkSize) != (int)blkSize) {
+            fatal("Write failed on cache checkpoint file '%s'\n",
+                  filename);
+        }
+    });
+
+    if (gzclose(compressed_data))
+        fatal("Close failed on cache checkpoint file '%s'\n", filename);
+
+    DPRINTF(Checkpoint, "Serialized %d blocks to %s\n", blk_addr.size(),
+            filename);
+
+    unsigned blk_size = blkSize;
+    SERIALIZE_SCALAR(blk_size);
+    SERIALIZE_SCALAR(filename);
+    SERIALIZE_CONTAINER(blk_addr);
+    SERIALIZE_CONTAINER(blk_state);
+    SERIALIZE_CONTAINER(blk_requestor);
+    SERIALIZE_CONTAINER(blk_repl);
+}
+
+void
+BaseCache::unserializeContents(CheckpointIn &cp, const std::string &filename)
+{
+    unsigned blk_size;
+    std::vector<Addr> blk_addr;
+    std::vector<uint8_t> blk_state;
+    std::vector<uint32_t> blk_requestor;
+    std::vector<uint64_t> blk_repl;
+    UNSERIALIZE_SCALAR(blk_size);
+    UNSERIALIZE_CONTAINER(blk_addr);
+    UNSERIALIZE_CONTAINER(blk_state);
+    UNSERIALIZE_CONTAINER(blk_requestor);
+    UNSERIALIZE_CONTAINER(blk_repl);
+
+    const size_t num_blks = blk_addr.size();
+    fatal_if(blk_state.size() != num_blks ||
+             blk_requestor.size() != num_blks ||
+             blk_repl.size() != num_blks,
+             "%s: inconsistent cache checkpoint\n", name());
+
+    const bool any_dirty = std::any_of(blk_state.begin(), blk_state.end(),
+        [](uint8_t state) { return state & CacheBlk::DirtyBit; });
+
+    // Contents can only be reinserted into compatible tags; anything
+    // else is fine as long as there is no dirty data to lose
+    if (blk_size != blkSize || compressor) {
+        fatal_if(any_dirty, "%s: cannot restore dirty cache contents "
+                 "into a cache with a different block size or a "
+                 "compressor\n", name());
+        warn("%s: not restoring cache contents, incompatible cache\n",
+             name());
+        return;
+    }
+
+    std::vector<uint8_t> data(num_blks * blkSize);
+    std::string filepath = cp.getCptDir() + "/" + filename;
+    gzFile compressed_data = gzopen(filepath.c_str(), "rb");
+    if (compressed_data == NULL)
+        fatal("Can't open cache checkpoint file '%s'\n", filename);
+    for (size_t i = 0; i < num_blks; i++) {
+        if (gzread(compressed_data, data.data() + i * blkSize, blkSize) !=
+            (int)blkSize) {
+            fatal("Read failed on cache checkpoint file '%s'\n", filename);
+        }
+    }
+    if (gzclose(compressed_data))
+        fatal("Close failed on cache checkpoint file '%s'\n", filename);
+
+    // Reinsert blocks from the first to the last victim of the tags,
+    // so that if the geometry shrank, the blocks evicted during the
+    // restore are the ones the policy would have evicted first
+    std::vector<size_t> order(num_blks);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return tags->evictsBefore(blk_repl[a], blk_repl[b]);
+    });
+
+    size_t restored = 0;
+    size_t dropped = 0;
+    for (size_t i : order) {
+        const Addr addr = blk_addr[i];
+        const uint8_t state = blk_state[i];
+        const bool is_secure = state & CptSecureFlag;
+        const bool is_dirty = state & CacheBlk::DirtyBit;
+
+        if (tags->findBlock(addr, is_secure))
+            continue;
+
+        // Blocks are inserted through a dummy request, as if filled by
+        // their original requestor
+        RequestorID requestor = blk_requestor[i];
+        if (requestor >= system->maxRequestors())
+            requestor = Request::funcRequestorId;
+        RequestPtr req = std::make_shared<Request>(addr, blkSize,
+            is_secure ? Request::SECURE : 0, requestor);
+        Packet pkt(req, MemCmd::ReadReq);
+
+        const uint64_t partition_id = partitionManager ?
+            partitionManager->readPacketPartitionID(&pkt) : 0;
+        std::vector<CacheBlk*> evict_blks;
+        CacheBlk *victim = tags->findVictim(addr, is_secure, blkSize * 8,
+                                            evict_blks, partition_id);
+
+        // Dirty blocks restored earlier must never be dropped
+        const bool evicts_dirty = std::any_of(evict_blks.begin(),
+            evict_blks.end(), [](CacheBlk *blk) {
+                return blk->isSet(CacheBlk::DirtyBit); });
+        if (!victim || evicts_dirty) {
+            fatal_if(is_dirty, "%s: cache too small to restore all dirty "
+                     "blocks from the checkpoint\n", name());
+            dropped++;
+            continue;
+        }
+
+        for (auto blk : evict_blks) {
+            if (blk->isValid()) {
+                invalidateBlock(blk);
+                dropped++;
+            }
+        }
+
+        tags->insertBlock(&pkt, victim);
+        victim->setCoherenceBits(state & CacheBlk::AllBits);
+        victim->setWhenReady(curTick());
+        std::memcpy(victim->data, data.data() + i * blkSize, blkSize);
+        tags->setReplacementState(victim, blk_repl[i]);
+        restored++;
+    }
+
+    DPRINTF(Checkpoint, "Restored %d blocks from %s, dropped %d\n",
+            restored, filename, dropped);
+    if (dropped) {
+        warn("%s: %d checkpointed blocks did not fit and were dropped\n",
+             name(), dropped);
+    }
 }
 
 
@@ -927,6 +927,9 @@ class BaseCache : public ClockedObject
      */
     const bool sequentialAccess;
 
+    /** Whether checkpoints include the contents of the cache. */
+    const bool checkpointContents;
+
     /** The number of targets for each MSHR. */
     const int numTarget;
 
@@ -982,6 +985,64 @@ class BaseCache : public ClockedObject
     /** The number of misses to trigger an exit event. */
     Counter missCount;
 
+    /**
+     * Whether the cache is in functional warming mode. While warming,
+     * only tag, replacement and data state are maintained; hit/miss
+     * and replacement statistics are not updated and the atomic path
+     * reports no latency.
+     */
+    bool functionalWarming;
+
+    /**
+     * Whether to warm functionally whenever the system is in atomic
+     * mode, e.g. while fast-forwarding before a CPU switch.
+     */
+    const bool autoWarming;
+
+    /**
+     * Enter functional warming if the system is in atomic mode and
+     * leave it otherwise, if automatic warming is enabled.
+     */
+    void updateFunctionalWarming();
+
+    /**
+     * Set once warming has converged. A frozen cache neither touches
+     * the replacement state on hits nor allocates on misses.
+     */
+    bool warmingFrozen;
+
+    /** Number of accesses per convergence window, 0 to disable. */
+    const Counter warmingWindow;
+
+    /** Miss ratio change below which warming has converged. */
+    const double warmingThreshold;
+
+    /** Accesses and misses seen in the current warming window. */
+    Counter warmingAccesses;
+    Counter warmingMisses;
+
+    /** Miss ratio of the previous window, negative if none. */
+    double warmingLastRatio;
+
+    /**
+     * Account an access made while warming and check whether the miss
+     * ratio has settled.
+     *
+     * @param miss Whether the access missed
+     */
+    void warmingAccess(bool miss);
+
+    /**
+     * Handle an atomic access while functionally warming. Hits only
+     * update the tag and replacement state and the data; no latency is
+     * computed and no stats are updated.
+     *
+     * @param pkt The request
+     * @return Whether the access was handled, false if it has to take
+     *         the regular atomic path (e.g., on a miss)
+     */
+    bool warmAtomic(PacketPtr pkt);
+
     /**
      * The address range to which the cache responds on the CPU side.
      * Normally this is all possible memory addresses. */
@@ -1160,6 +1221,8 @@ class BaseCache : public ClockedObject
     ~BaseCache();
 
     void init() override;
+    void startup() override;
+    void drainResume() override;
 
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
@@ -1305,7 +1368,11 @@ class BaseCache : public ClockedObject
     void incMissCount(PacketPtr pkt)
     {
         assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(pkt).misses[pkt->req->requestorId()]++;
+        if (GEM5_UNLIKELY(functionalWarming)) {
+            warmingAccess(true);
+        } else {
+            stats.cmdStats(pkt).misses[pkt->req->requestorId()]++;
+        }
         pkt->req->incAccessDepth();
         if (missCount) {
             --missCount;
@@ -1316,9 +1383,27 @@ class BaseCache : public ClockedObject
     void incHitCount(PacketPtr pkt)
     {
         assert(pkt->req->requestorId() < system->maxRequestors());
+        if (GEM5_UNLIKELY(functionalWarming)) {
+            warmingAccess(false);
+            return;
+        }
         stats.cmdStats(pkt).hits[pkt->req->requestorId()]++;
     }
 
+    /**
+     * Enter or leave functional warming mode. This is meant to be used
+     * while fast-forwarding with an atomic CPU, and must be turned off
+     * before switching to detailed simulation. Leaving the mode also
+     * resets any convergence state. Caches with functional_warming set
+     * do this on their own when the memory mode changes.
+     *
+     * @param enable Whether to warm functionally
+     */
+    void setFunctionalWarming(bool enable);
+
+    /** @return Whether warming has converged and the cache is frozen. */
+    bool functionalWarmingConverged() const { return warmingFrozen; }
+
     /**
      * Checks if the cache is coalescing writes
      *
@@ -1363,10 +1448,31 @@ class BaseCache : public ClockedObject
     /**
      * Serialize the state of the caches
      *
-     * We currently don't support checkpointing cache state, so this panics.
+     * Unless checkpoint_contents is set, the contents are not saved and
+     * the checkpoint is flagged as bad if the cache holds dirty data.
+     * Checkpointed contents are always restored, regardless of that
+     * parameter.
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+
+  private:
+    /**
+     * Save the valid blocks of the cache. Metadata goes into the
+     * checkpoint itself and the block data into a separate compressed
+     * file.
+     */
+    void serializeContents(CheckpointOut &cp) const;
+
+    /**
+     * Restore the blocks saved by serializeContents(). Blocks are
+     * reinserted through the tags, so the geometry may differ from the
+     * checkpointed one as long as the block size matches. Clean blocks
+     * that do not fit are dropped.
+     *
+     * @param filename Name of the file holding the block data
+     */
+    void unserializeContents(CheckpointIn &cp, const std::string &filename);
 };
 
 /**
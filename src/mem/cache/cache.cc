@@ -609,7 +609,9 @@ Cache::handleAtomicReqMiss(PacketPtr pkt, CacheBlk *&blk,
     DPRINTF(Cache, "%s: Sending an atomic %s\n", __func__,
             bus_pkt->print());
 
-    const std::string old_state = blk ? blk->print() : "";
+    // Only build the block description when it is going to be printed
+    const std::string old_state =
+        blk && debug::Cache ? blk->print() : "";
 
     Cycles latency = ticksToCycles(memSidePort.sendAtomic(bus_pkt));
 
@@ -109,6 +109,49 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Get the state of an entry as a single value, so that it can be
+     * checkpointed. Policies that do not support this return 0, and
+     * restored entries keep the state they got when they were reset.
+     *
+     * @param replacement_data Replacement data to be saved.
+     * @return The entry's state.
+     */
+    virtual uint64_t
+    getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+    {
+        return 0;
+    }
+
+    /**
+     * Restore the state of an entry previously obtained with getState().
+     *
+     * @param replacement_data Replacement data to be restored.
+     * @param state The entry's state.
+     */
+    virtual void
+    setState(const std::shared_ptr<ReplacementData>& replacement_data,
+             uint64_t state) const
+    {
+    }
+
+    /**
+     * Compare two states obtained with getState(). Checkpointed entries
+     * are restored from the first to the last victim, so that the entries
+     * dropped when they no longer fit are the ones the policy would have
+     * evicted first.
+     *
+     * @param a The state of an entry.
+     * @param b The state of another entry.
+     * @return Whether the entry in state a is evicted before the one in
+     *         state b. Policies without such an order return false.
+     */
+    virtual bool
+    evictsBefore(uint64_t a, uint64_t b) const
+    {
+        return false;
+    }
 };
 
 } // namespace replacement_policy
@@ -147,5 +147,28 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+uint64_t
+BRRIP::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<BRRIPReplData>(
+        replacement_data)->rrpv;
+}
+
+void
+BRRIP::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+                uint64_t state) const
+{
+    std::shared_ptr<BRRIPReplData> casted_replacement_data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    casted_replacement_data->rrpv.reset();
+    casted_replacement_data->rrpv += state;
+}
+
+bool
+BRRIP::evictsBefore(uint64_t a, uint64_t b) const
+{
+    return a > b;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -157,6 +157,13 @@ class BRRIP : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /** The state of an entry is its RRPV. */
+    uint64_t getState(const std::shared_ptr<ReplacementData>&
+                      replacement_data) const override;
+    void setState(const std::shared_ptr<ReplacementData>& replacement_data,
+                  uint64_t state) const override;
+    bool evictsBefore(uint64_t a, uint64_t b) const override;
 };
 
 } // namespace replacement_policy
@@ -94,5 +94,26 @@ FIFO::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new FIFOReplData());
 }
 
+uint64_t
+FIFO::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<FIFOReplData>(
+        replacement_data)->tickInserted;
+}
+
+void
+FIFO::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+               uint64_t state) const
+{
+    std::static_pointer_cast<FIFOReplData>(
+        replacement_data)->tickInserted = state;
+}
+
+bool
+FIFO::evictsBefore(uint64_t a, uint64_t b) const
+{
+    return a < b;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -109,6 +109,13 @@ class LFU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /** The state of an entry is its reference count. */
+    uint64_t getState(const std::shared_ptr<ReplacementData>&
+                      replacement_data) const override;
+    void setState(const std::shared_ptr<ReplacementData>& replacement_data,
+                  uint64_t state) const override;
+    bool evictsBefore(uint64_t a, uint64_t b) const override;
 };
 
 } // namespace replacement_policy
@@ -96,5 +96,26 @@ LRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LRUReplData());
 }
 
+uint64_t
+LRU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<LRUReplData>(
+        replacement_data)->lastTouchTick;
+}
+
+void
+LRU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+              uint64_t state) const
+{
+    std::static_pointer_cast<LRUReplData>(
+        replacement_data)->lastTouchTick = state;
+}
+
+bool
+LRU::evictsBefore(uint64_t a, uint64_t b) const
+{
+    return a < b;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
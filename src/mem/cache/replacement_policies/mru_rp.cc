@@ -101,5 +101,26 @@ MRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new MRUReplData());
 }
 
+uint64_t
+MRU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<MRUReplData>(
+        replacement_data)->lastTouchTick;
+}
+
+void
+MRU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+              uint64_t state) const
+{
+    std::static_pointer_cast<MRUReplData>(
+        replacement_data)->lastTouchTick = state;
+}
+
+bool
+MRU::evictsBefore(uint64_t a, uint64_t b) const
+{
+    return a > b;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
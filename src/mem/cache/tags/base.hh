@@ -299,6 +299,17 @@ class BaseTags : public ClockedObject
      */
     virtual CacheBlk* accessBlock(const PacketPtr pkt, Cycles &lat) = 0;
 
+    /**
+     * Update the replacement data of a block that is being accessed
+     * without accounting for the access in the tag statistics. This is
+     * used by functional warming, which only needs the contents and the
+     * replacement state of the tags to be kept up to date.
+     *
+     * @param blk The block being accessed.
+     * @param pkt The packet accessing the block.
+     */
+    virtual void touchBlock(CacheBlk *blk, const PacketPtr pkt) = 0;
+
     /**
      * Generate the tag from the given address.
      *
@@ -333,6 +344,44 @@ class BaseTags : public ClockedObject
      */
     virtual Addr regenerateBlkAddr(const CacheBlk* blk) const = 0;
 
+    /**
+     * Get the replacement state of a block, as a single value that can
+     * be checkpointed. Tags that cannot provide it return 0.
+     *
+     * @param blk The block.
+     * @return The block's replacement state.
+     */
+    virtual uint64_t
+    getReplacementState(const CacheBlk *blk) const
+    {
+        return 0;
+    }
+
+    /**
+     * Restore the replacement state of a block previously obtained with
+     * getReplacementState().
+     *
+     * @param blk The block.
+     * @param state The block's replacement state.
+     */
+    virtual void setReplacementState(CacheBlk *blk, uint64_t state) {}
+
+    /**
+     * Compare two replacement states obtained with getReplacementState().
+     * Checkpointed blocks are reinserted from the first to the last
+     * victim in this order.
+     *
+     * @param a The replacement state of a block.
+     * @param b The replacement state of another block.
+     * @return Whether the block in state a is evicted before the one in
+     *         state b. Tags without such an order return false.
+     */
+    virtual bool
+    evictsBefore(uint64_t a, uint64_t b) const
+    {
+        return false;
+    }
+
     /**
      * Visit each block in the tags and apply a visitor
      *
@@ -143,11 +143,7 @@ class BaseSetAssoc : public BaseTags
 
         // If a cache hit
         if (blk != nullptr) {
-            // Update number of references to accessed block
-            blk->increaseRefCount();
-
-            // Update replacement data of accessed block
-            replacementPolicy->touch(blk->replacementData, pkt);
+            touchBlock(blk, pkt);
         }
 
         // The tag lookup latency is the same for a hit or a miss
@@ -156,6 +152,16 @@ class BaseSetAssoc : public BaseTags
         return blk;
     }
 
+    void
+    touchBlock(CacheBlk *blk, const PacketPtr pkt) override
+    {
+        // Update number of references to accessed block
+        blk->increaseRefCount();
+
+        // Update replacement data of accessed block
+        replacementPolicy->touch(blk->replacementData, pkt);
+    }
+
     /**
      * Find replacement victim based on address. The list of evicted blocks
      * only contains the victim.
@@ -246,6 +252,24 @@ class BaseSetAssoc : public BaseTags
         return indexingPolicy->regenerateAddr(blk->getTag(), blk);
     }
 
+    uint64_t
+    getReplacementState(const CacheBlk *blk) const override
+    {
+        return replacementPolicy->getState(blk->replacementData);
+    }
+
+    void
+    setReplacementState(CacheBlk *blk, uint64_t state) override
+    {
+        replacementPolicy->setState(blk->replacementData, state);
+    }
+
+    bool
+    evictsBefore(uint64_t a, uint64_t b) const override
+    {
+        return replacementPolicy->evictsBefore(a, b);
+    }
+
     bool anyBlk(std::function<bool(CacheBlk &)> visitor) override {
         for (CacheBlk& blk : blks) {
             if (visitor(blk)) {
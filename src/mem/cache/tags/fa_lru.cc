@@ -151,7 +151,7 @@ FALRU::accessBlock(const PacketPtr pkt, Cycles &lat,
     if (blk && blk->isValid()) {
         mask = blk->inCachesMask;
 
-        moveToHead(blk);
+        touchBlock(blk, pkt);
     }
 
     if (in_caches_mask) {
@@ -166,6 +166,17 @@ FALRU::accessBlock(const PacketPtr pkt, Cycles &lat,
     return blk;
 }
 
+void
+FALRU::touchBlock(CacheBlk *blk, const PacketPtr pkt)
+{
+    if (blk->isValid()) {
+        // Update number of references to accessed block
+        blk->increaseRefCount();
+
+        moveToHead(static_cast<FALRUBlk*>(blk));
+    }
+}
+
 CacheBlk*
 FALRU::findBlock(Addr addr, bool is_secure) const
 {
@@ -236,6 +247,8 @@ FALRU::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 void
 FALRU::moveToHead(FALRUBlk *blk)
 {
+    blk->lastTouch = ++touches;
+
     // If block is not already head, do the moving
     if (blk != head) {
         cacheTracking.moveBlockToHead(blk);
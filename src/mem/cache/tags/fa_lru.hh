@@ -85,7 +85,10 @@ typedef uint32_t CachesMask;
 class FALRUBlk : public CacheBlk
 {
   public:
-    FALRUBlk() : CacheBlk(), prev(nullptr), next(nullptr), inCachesMask(0) {}
+    FALRUBlk()
+      : CacheBlk(), prev(nullptr), next(nullptr), inCachesMask(0),
+        lastTouch(0)
+    {}
     using CacheBlk::operator=;
 
     /** The previous block in LRU order. */
@@ -96,6 +99,9 @@ class FALRUBlk : public CacheBlk
     /** A bit mask of the caches that fit this block. */
     CachesMask inCachesMask;
 
+    /** When the block was last made the MRU, counted in moves to MRU. */
+    uint64_t lastTouch;
+
     /**
      * Pretty-print inCachesMask and other CacheBlk information.
      *
@@ -123,6 +129,9 @@ class FALRU : public BaseTags
     /** The LRU block. */
     FALRUBlk *tail;
 
+    /** Number of moves to the MRU position, which orders lastTouch. */
+    uint64_t touches = 0;
+
     /** Hash table type mapping addresses to cache block pointers. */
     struct PairHash
     {
@@ -191,6 +200,8 @@ class FALRU : public BaseTags
      */
     CacheBlk* accessBlock(const PacketPtr pkt, Cycles &lat) override;
 
+    void touchBlock(CacheBlk *blk, const PacketPtr pkt) override;
+
     /**
      * Find the block in the cache, do not update the replacement data.
      * @param addr The address to look for.
@@ -257,6 +268,19 @@ class FALRU : public BaseTags
         return blk->getTag();
     }
 
+    /**
+     * The replacement state of a block is its last touch. Restored
+     * blocks are inserted from the LRU to the MRU one, which restores
+     * the order of the list, so there is nothing to set.
+     */
+    uint64_t
+    getReplacementState(const CacheBlk *blk) const override
+    {
+        return static_cast<const FALRUBlk*>(blk)->lastTouch;
+    }
+
+    bool evictsBefore(uint64_t a, uint64_t b) const override { return a < b; }
+
     bool anyBlk(std::function<bool(CacheBlk &)> visitor) override {
         for (int i = 0; i < numBlocks; i++) {
             if (visitor(blks[i])) {
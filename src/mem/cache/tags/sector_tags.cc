@@ -172,16 +172,7 @@ SectorTags::accessBlock(const PacketPtr pkt, Cycles &lat)
 
     // If a cache hit
     if (blk != nullptr) {
-        // Update number of references to accessed block
-        blk->increaseRefCount();
-
-        // Get block's sector
-        SectorSubBlk* sub_blk = static_cast<SectorSubBlk*>(blk);
-        const SectorBlk* sector_blk = sub_blk->getSectorBlock();
-
-        // Update replacement data of accessed block, which is shared with
-        // the whole sector it belongs to
-        replacementPolicy->touch(sector_blk->replacementData, pkt);
+        touchBlock(blk, pkt);
     }
 
     // The tag lookup latency is the same for a hit or a miss
@@ -190,6 +181,21 @@ SectorTags::accessBlock(const PacketPtr pkt, Cycles &lat)
     return blk;
 }
 
+void
+SectorTags::touchBlock(CacheBlk *blk, const PacketPtr pkt)
+{
+    // Update number of references to accessed block
+    blk->increaseRefCount();
+
+    // Get block's sector
+    SectorSubBlk* sub_blk = static_cast<SectorSubBlk*>(blk);
+    const SectorBlk* sector_blk = sub_blk->getSectorBlock();
+
+    // Update replacement data of accessed block, which is shared with
+    // the whole sector it belongs to
+    replacementPolicy->touch(sector_blk->replacementData, pkt);
+}
+
 void
 SectorTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
 {
@@ -364,6 +370,28 @@ SectorTags::regenerateBlkAddr(const CacheBlk* blk) const
     return sec_addr | ((Addr)blk_cast->getSectorOffset() << sectorShift);
 }
 
+uint64_t
+SectorTags::getReplacementState(const CacheBlk *blk) const
+{
+    const SectorSubBlk* sub_blk = static_cast<const SectorSubBlk*>(blk);
+    return replacementPolicy->getState(
+        sub_blk->getSectorBlock()->replacementData);
+}
+
+void
+SectorTags::setReplacementState(CacheBlk *blk, uint64_t state)
+{
+    const SectorSubBlk* sub_blk = static_cast<const SectorSubBlk*>(blk);
+    replacementPolicy->setState(
+        sub_blk->getSectorBlock()->replacementData, state);
+}
+
+bool
+SectorTags::evictsBefore(uint64_t a, uint64_t b) const
+{
+    return replacementPolicy->evictsBefore(a, b);
+}
+
 SectorTags::SectorTagsStats::SectorTagsStats(BaseTagStats &base_group,
     SectorTags& _tags)
   : statistics::Group(&base_group), tags(_tags),
@@ -155,6 +155,8 @@ class SectorTags : public BaseTags
      */
     CacheBlk* accessBlock(const PacketPtr pkt, Cycles &lat) override;
 
+    void touchBlock(CacheBlk *blk, const PacketPtr pkt) override;
+
     /**
      * Insert the new block into the cache and update replacement data.
      *
@@ -206,6 +208,11 @@ class SectorTags : public BaseTags
      */
     Addr regenerateBlkAddr(const CacheBlk* blk) const override;
 
+    /** The replacement state of a block is the one of its sector. */
+    uint64_t getReplacementState(const CacheBlk *blk) const override;
+    void setReplacementState(CacheBlk *blk, uint64_t state) override;
+    bool evictsBefore(uint64_t a, uint64_t b) const override;
+
     /**
      * Find if any of the sub-blocks satisfies a condition.
      *
@@ -217,11 +217,28 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
         }
 
 
+        // a bounded snoop filter cannot track the request if all the
+        // entries of its set wait for responses, and a back-invalidated
+        // line has to be written below before it is accessed again, so
+        // retry once the responses had a chance to come back
+        if (snoopFilter && (!snoopFilter->canAllocate(pkt, *src_port) ||
+                            backInvalidatingLines.count(lineOf(pkt)))) {
+            // express snoops hit in the filter, and never allocate
+            assert(!is_express_snoop);
+            DPRINTF(CoherentXBar, "%s: src %s packet %s SF FULL\n",
+                    __func__, src_port->name(), pkt->print());
+
+            pkt->headerDelay = old_header_delay;
+            retryNextCycle(mem_side_port_id, src_port);
+            return false;
+        }
+
         // the packet is a memory-mapped request and should be
         // broadcasted to our snoopers but the source
         if (snoopFilter) {
             // check with the snoop filter where to forward this packet
             auto sf_res = snoopFilter->lookupRequest(pkt, *src_port);
+            backInvalidate(true);
             // the time required by a packet to be delivered through
             // the xbar has to be charged also with to lookup latency
             // of the snoop filter
@@ -569,6 +586,23 @@ CoherentXBar::recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id)
 bool
 CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
 {
+    // the response to a back-invalidation carries the dirty data of
+    // the line, which has to be written to the memory below
+    if (outstandingBackInvalidation.erase(pkt->req)) {
+        DPRINTF(CoherentXBar, "%s: writing back back-invalidation "
+                "response %s\n", __func__, pkt->print());
+        PacketPtr wb_pkt = new Packet(pkt->req, MemCmd::WritebackDirty);
+        wb_pkt->allocate();
+        wb_pkt->setData(pkt->getConstPtr<uint8_t>());
+        delete pkt;
+
+        calcPacketTiming(wb_pkt, forwardLatency * clockPeriod());
+        PortID mem_side_port_id = findPort(wb_pkt);
+        backInvalidationWritebacks[mem_side_port_id].push_back(wb_pkt);
+        sendBackInvalidationWritebacks(mem_side_port_id);
+        return true;
+    }
+
     // determine the source port based on the id
     ResponsePort* src_port = cpuSidePorts[cpu_side_port_id];
 
@@ -729,8 +763,30 @@ CoherentXBar::recvReqRetry(PortID mem_side_port_id)
 {
     // responses and snoop responses never block on forwarding them,
     // so the retry will always be coming from a port to which we
-    // tried to forward a request
-    reqLayers[mem_side_port_id]->recvRetry();
+    // tried to forward a request, either a writeback of a
+    // back-invalidated line or a request through the layer
+    sendBackInvalidationWritebacks(mem_side_port_id);
+    if (reqLayers[mem_side_port_id]->isWaitingForPeer())
+        reqLayers[mem_side_port_id]->recvRetry();
+}
+
+std::pair<Addr, bool>
+CoherentXBar::lineOf(const PacketPtr pkt) const
+{
+    return {pkt->getBlockAddr(system->cacheLineSize()), pkt->isSecure()};
+}
+
+void
+CoherentXBar::retryNextCycle(PortID mem_side_port_id,
+                             ResponsePort *src_port)
+{
+    reqLayers[mem_side_port_id]->failedTiming(src_port,
+                                            clockEdge(Cycles(1)));
+    schedule(new EventFunctionWrapper([this, mem_side_port_id]{
+                 // unless the destination retried in the meantime
+                 if (reqLayers[mem_side_port_id]->isWaitingForPeer())
+                     reqLayers[mem_side_port_id]->recvRetry();
+             }, name() + ".retryEvent", true), clockEdge(Cycles(1)));
 }
 
 Tick
@@ -772,6 +828,7 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
             // avoid situations where atomic upward snoops sneak in
             // between and change the filter state
             snoopFilter->finishRequest(false, pkt->getAddr(), pkt->isSecure());
+            snoop_response_latency += backInvalidate(false);
 
             if (pkt->isEviction()) {
                 // for block-evicting packets, i.e. writebacks and
@@ -1062,6 +1119,76 @@ CoherentXBar::recvFunctionalSnoop(PacketPtr pkt, PortID mem_side_port_id)
     forwardFunctional(pkt, InvalidPortID);
 }
 
+Tick
+CoherentXBar::backInvalidate(bool is_timing)
+{
+    unsigned line_size = system->cacheLineSize();
+    Tick latency = 0;
+
+    for (const auto& eviction : snoopFilter->takeEvictions()) {
+        Request::Flags flags = eviction.isSecure ? Request::SECURE : 0;
+        RequestPtr req = std::make_shared<Request>(
+            eviction.addr, line_size, flags, Request::wbRequestorId);
+
+        DPRINTF(CoherentXBar, "%s: invalidating %#x in %d holders\n",
+                __func__, eviction.addr, eviction.holders.size());
+
+        // the ReadExReq invalidates all the copies, and the holder of
+        // a dirty one, possibly in its write buffer, responds with it
+        Packet snoop_pkt(req, MemCmd::ReadExReq);
+        snoop_pkt.allocate();
+        for (const auto& p : eviction.holders) {
+            if (is_timing) {
+                p->sendTimingSnoopReq(&snoop_pkt);
+            } else {
+                latency = std::max(latency, p->sendAtomicSnoop(&snoop_pkt));
+                // restore the request for the remaining holders
+                snoop_pkt.cmd = MemCmd::ReadExReq;
+            }
+        }
+
+        if (snoop_pkt.cacheResponding()) {
+            if (is_timing) {
+                // the data is written below once the response arrives,
+                // and the line stays blocked until then
+                outstandingBackInvalidation.insert(req);
+                backInvalidatingLines.emplace(eviction.addr,
+                                              eviction.isSecure);
+            } else {
+                Packet wb_pkt(req, MemCmd::WritebackDirty);
+                wb_pkt.dataStatic(snoop_pkt.getConstPtr<uint8_t>());
+                latency += memSidePorts[findPort(&wb_pkt)]->sendAtomic(
+                    &wb_pkt);
+            }
+        }
+
+        snoops++;
+        snoopFanout.sample(eviction.holders.size());
+    }
+
+    return latency;
+}
+
+void
+CoherentXBar::sendBackInvalidationWritebacks(PortID mem_side_port_id)
+{
+    auto writebacks = backInvalidationWritebacks.find(mem_side_port_id);
+    if (writebacks == backInvalidationWritebacks.end())
+        return;
+
+    while (!writebacks->second.empty()) {
+        PacketPtr pkt = writebacks->second.front();
+        auto line = lineOf(pkt);
+        // wait for the port to retry
+        if (!memSidePorts[mem_side_port_id]->sendTimingReq(pkt))
+            return;
+
+        // any later request to the line follows the data below
+        writebacks->second.pop_front();
+        backInvalidatingLines.erase(line);
+    }
+}
+
 void
 CoherentXBar::forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id)
 {
@@ -46,8 +46,11 @@
 #ifndef __MEM_COHERENT_XBAR_HH__
 #define __MEM_COHERENT_XBAR_HH__
 
+#include <deque>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include "mem/snoop_filter.hh"
 #include "mem/xbar.hh"
@@ -274,6 +277,27 @@ class CoherentXBar : public BaseXBar
      */
     std::unordered_map<PacketId, PacketPtr> outstandingCMO;
 
+    /**
+     * Store the outstanding back-invalidations of the snoop filter
+     * that a cache committed to respond to, so that we can write the
+     * data of their responses to the memory below.
+     */
+    std::unordered_set<RequestPtr> outstandingBackInvalidation;
+
+    /**
+     * Writebacks of back-invalidated lines refused by a memory-side
+     * port, to send again when it retries, per memory-side port.
+     */
+    std::unordered_map<PortID, std::deque<PacketPtr>>
+        backInvalidationWritebacks;
+
+    /**
+     * Lines with back-invalidated data on its way to the memory
+     * below, and whether they are secure. Requests to them have to
+     * wait until the data is ahead of them.
+     */
+    std::set<std::pair<Addr, bool>> backInvalidatingLines;
+
     /**
      * Keep a pointer to the system to be allow to querying memory system
      * properties.
@@ -400,6 +424,45 @@ class CoherentXBar : public BaseXBar
      */
     void forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id);
 
+    /**
+     * Invalidate the lines evicted by the snoop filter in all their
+     * holders. Each line is recalled with a ReadExReq snoop, which
+     * invalidates all copies and makes the holder of a dirty one
+     * respond with its data. The data is then written back to the
+     * memory below.
+     *
+     * In timing mode, the response arrives as a timing snoop response
+     * and the writeback is sent as a timing request, while requests to
+     * the line wait until it went out. The snoops are sent at the time
+     * of the eviction, and neither they nor the writeback occupy the
+     * crossbar layers.
+     *
+     * @param is_timing Send timing rather than atomic snoops
+     * @return Latency of the atomic snoops and writebacks
+     */
+    Tick backInvalidate(bool is_timing);
+
+    /**
+     * Send the writebacks of back-invalidated lines waiting for a
+     * memory-side port, until it refuses one.
+     *
+     * @param mem_side_port_id Memory-side port to send to
+     */
+    void sendBackInvalidationWritebacks(PortID mem_side_port_id);
+
+    /**
+     * Refuse a request that can be accepted in the next cycle, for a
+     * reason other than the destination being busy. The layer sends
+     * the retry itself, as the destination will not.
+     *
+     * @param mem_side_port_id Memory-side port of the request
+     * @param src_port CPU-side port the request came from
+     */
+    void retryNextCycle(PortID mem_side_port_id, ResponsePort *src_port);
+
+    /** Line accessed by a packet, as kept in backInvalidatingLines. */
+    std::pair<Addr, bool> lineOf(const PacketPtr pkt) const;
+
     /**
      * Determine if the crossbar should sink the packet, as opposed to
      * forwarding it, or responding.
@@ -52,8 +52,10 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "base/cprintf.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "mem/packet_access.hh"
@@ -245,6 +247,138 @@ Packet::getAddrRange() const
     return RangeSize(getAddr(), getSize());
 }
 
+namespace
+{
+
+/**
+ * Set once the free lists of the thread are being destroyed, at thread
+ * or program exit. Packets may still be freed afterwards, for example
+ * by the destructors of other static or thread_local objects, and then
+ * go straight back to the system. Being trivially destructible, the
+ * flag itself stays usable until the thread is gone.
+ */
+thread_local bool freeListsDestroyed = false;
+
+/**
+ * Per-thread free list of memory chunks of one size. Chunks freed by
+ * another thread than the one that allocated them simply move to the
+ * free list of that thread. The list is bounded so that memory freed
+ * after a burst of allocations is returned to the system.
+ */
+class ChunkFreeList
+{
+  public:
+    ~ChunkFreeList()
+    {
+        freeListsDestroyed = true;
+        for (void *chunk : chunks)
+            ::operator delete(chunk);
+    }
+
+    void *
+    alloc(std::size_t size)
+    {
+        if (freeListsDestroyed || chunks.empty())
+            return ::operator new(size);
+        void *chunk = chunks.back();
+        chunks.pop_back();
+        return chunk;
+    }
+
+    void
+    free(void *chunk)
+    {
+        if (!freeListsDestroyed && chunks.size() < MaxChunks)
+            chunks.push_back(chunk);
+        else
+            ::operator delete(chunk);
+    }
+
+  private:
+    static constexpr std::size_t MaxChunks = 4096;
+    std::vector<void *> chunks;
+};
+
+thread_local ChunkFreeList packetFreeList;
+
+/**
+ * Payloads are pooled in power-of-two size classes from
+ * MinPayloadSize up to MaxPayloadSize, which covers the usual cache
+ * line sizes. Larger payloads are not pooled.
+ */
+constexpr unsigned MinPayloadSizeLog2 = 3;
+constexpr unsigned MaxPayloadSizeLog2 = 8;
+thread_local ChunkFreeList
+    payloadFreeLists[MaxPayloadSizeLog2 - MinPayloadSizeLog2 + 1];
+
+unsigned
+payloadSizeLog2(unsigned size)
+{
+    return std::max<unsigned>(ceilLog2(std::max(size, 1U)),
+                              MinPayloadSizeLog2);
+}
+
+ChunkFreeList *
+payloadFreeList(unsigned size)
+{
+    unsigned size_log2 = payloadSizeLog2(size);
+    if (size_log2 > MaxPayloadSizeLog2)
+        return nullptr;
+    return &payloadFreeLists[size_log2 - MinPayloadSizeLog2];
+}
+
+std::size_t
+payloadChunkSize(unsigned size)
+{
+    unsigned size_log2 = payloadSizeLog2(size);
+    return size_log2 > MaxPayloadSizeLog2 ? size : (1UL << size_log2);
+}
+
+} // anonymous namespace
+
+void *
+Packet::operator new(std::size_t size)
+{
+    assert(size == sizeof(Packet));
+    return packetFreeList.alloc(size);
+}
+
+void
+Packet::operator delete(void *p, std::size_t size)
+{
+    assert(size == sizeof(Packet));
+    packetFreeList.free(p);
+}
+
+PacketDataPtr
+Packet::allocSharedData(unsigned size)
+{
+    std::size_t chunk_size = sizeof(SharedData) + payloadChunkSize(size);
+    ChunkFreeList *free_list = payloadFreeList(size);
+    void *chunk = free_list ? free_list->alloc(chunk_size) :
+        ::operator new(chunk_size);
+
+    SharedData *shared = new (chunk) SharedData;
+    shared->refCount.store(1, std::memory_order_relaxed);
+    shared->size = size;
+    return reinterpret_cast<PacketDataPtr>(shared + 1);
+}
+
+void
+Packet::releaseSharedData(PacketDataPtr p)
+{
+    SharedData *shared = sharedData(p);
+    if (shared->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    ChunkFreeList *free_list = payloadFreeList(shared->size);
+    shared->~SharedData();
+    if (free_list)
+        free_list->free(shared);
+    else
+        ::operator delete(shared);
+}
+
 bool
 Packet::trySatisfyFunctional(Printable *obj, Addr addr, bool is_secure, int size,
                         uint8_t *_data)
@@ -47,8 +47,10 @@
 #ifndef __MEM_PACKET_HH__
 #define __MEM_PACKET_HH__
 
+#include <atomic>
 #include <bitset>
 #include <cassert>
+#include <cstring>
 #include <initializer_list>
 #include <list>
 
@@ -353,6 +355,10 @@ class Packet : public Printable, public Extensible<Packet>
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The data pointer points to a reference-counted payload that
+        /// may be shared with other packets, and is released when the
+        /// packet is destroyed.
+        SHARED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -386,6 +392,46 @@ class Packet : public Printable, public Extensible<Packet>
     */
     PacketDataPtr data;
 
+    /**
+     * Header preceding the payload of packets with SHARED_DATA. The
+     * payloads come from per-thread pools, and are shared by packets
+     * copied from one another until one of them writes to it.
+     */
+    struct alignas(16) SharedData
+    {
+        std::atomic<uint32_t> refCount;
+        uint32_t size;
+    };
+
+    static SharedData*
+    sharedData(PacketDataPtr p)
+    {
+        return reinterpret_cast<SharedData*>(p) - 1;
+    }
+
+    /** Get a payload of the given size with a single reference. */
+    static PacketDataPtr allocSharedData(unsigned size);
+
+    /** Drop a reference to a payload, and free it if it was the last. */
+    static void releaseSharedData(PacketDataPtr p);
+
+    /**
+     * Make sure that the payload is only referenced by this packet
+     * before it is written to, copying it otherwise.
+     */
+    void
+    makeDataUnique()
+    {
+        if (flags.isSet(SHARED_DATA) &&
+            sharedData(data)->refCount.load(std::memory_order_acquire) > 1) {
+            unsigned data_size = sharedData(data)->size;
+            PacketDataPtr copy = allocSharedData(data_size);
+            std::memcpy(copy, data, data_size);
+            releaseSharedData(data);
+            data = copy;
+        }
+    }
+
     /// The address of the request.  This address could be virtual or
     /// physical, depending on the system configuration.
     Addr addr;
@@ -939,7 +985,9 @@ class Packet : public Printable, public Extensible<Packet>
      * *except* if the original packet's data was dynamic, don't copy
      * that, as we can't guarantee that the new packet's lifetime is
      * less than that of the original packet.  In this case the new
-     * packet should allocate its own data.
+     * packet should allocate its own data. Shared data is reference
+     * counted, so the new packet shares it until either packet
+     * writes to it.
      */
     Packet(const PacketPtr pkt, bool clear_flags, bool alloc_data)
         :  Extensible<Packet>(*pkt),
@@ -980,6 +1028,12 @@ class Packet : public Printable, public Extensible<Packet>
             if (pkt->flags.isSet(STATIC_DATA)) {
                 data = pkt->data;
                 flags.set(STATIC_DATA);
+            } else if (pkt->flags.isSet(SHARED_DATA) &&
+                       sharedData(pkt->data)->size == getSize()) {
+                data = pkt->data;
+                sharedData(data)->refCount.fetch_add(
+                    1, std::memory_order_relaxed);
+                flags.set(SHARED_DATA);
             } else {
                 allocate();
             }
@@ -1054,6 +1108,15 @@ class Packet : public Printable, public Extensible<Packet>
         deleteData();
     }
 
+    /**
+     * Packets are allocated from per-thread free lists, as they are
+     * created and destroyed for almost every memory access. Packets
+     * freed once the free lists of the thread are gone, at exit, go
+     * back to the system.
+     */
+    static void *operator new(std::size_t size);
+    static void operator delete(void *p, std::size_t size);
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1174,7 +1237,7 @@ class Packet : public Printable, public Extensible<Packet>
     void
     dataStatic(T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
         data = (PacketDataPtr)p;
         flags.set(STATIC_DATA);
     }
@@ -1191,7 +1254,7 @@ class Packet : public Printable, public Extensible<Packet>
     void
     dataStaticConst(const T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
         data = const_cast<PacketDataPtr>(p);
         flags.set(STATIC_DATA);
     }
@@ -1212,28 +1275,46 @@ class Packet : public Printable, public Extensible<Packet>
     void
     dataDynamic(T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
         data = (PacketDataPtr)p;
         flags.set(DYNAMIC_DATA);
     }
 
     /**
-     * get a pointer to the data ptr.
+     * get a pointer to the data ptr, to write to it. A payload shared
+     * with other packets is copied first, callers that only read the
+     * data should use getConstPtr instead.
      */
     template <typename T>
     T*
     getPtr()
     {
-        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
         assert(!isMaskedWrite());
+        makeDataUnique();
         return (T*)data;
     }
 
+    /**
+     * get a read-only pointer to the data ptr of a const packet, which
+     * never copies a shared payload.
+     */
+    template <typename T>
+    const T*
+    getPtr() const
+    {
+        return getConstPtr<T>();
+    }
+
+    /**
+     * get a read-only pointer to the data ptr, which never copies a
+     * shared payload.
+     */
     template <typename T>
     const T*
     getConstPtr() const
     {
-        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
         return (const T*)data;
     }
 
@@ -1294,10 +1375,12 @@ class Packet : public Printable, public Extensible<Packet>
     {
         // we should never be copying data onto itself, which means we
         // must idenfity packets with static data, as they carry the
-        // same pointer from source to destination and back
-        assert(p != getPtr<uint8_t>() || flags.isSet(STATIC_DATA));
+        // same pointer from source to destination and back, or
+        // shared data that nobody wrote to in the meantime
+        assert(p != getConstPtr<uint8_t>() ||
+               flags.isSet(STATIC_DATA|SHARED_DATA));
 
-        if (p != getPtr<uint8_t>()) {
+        if (p != getConstPtr<uint8_t>()) {
             // for packet with allocated dynamic data, we copy data from
             // one to the other, e.g. a forwarded response to a response
             std::memcpy(getPtr<uint8_t>(), p, getSize());
@@ -1357,8 +1440,10 @@ class Packet : public Printable, public Extensible<Packet>
     {
         if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
+        else if (flags.isSet(SHARED_DATA))
+            releaseSharedData(data);
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA);
         data = NULL;
     }
 
@@ -1369,9 +1454,9 @@ class Packet : public Printable, public Extensible<Packet>
         // if either this command or the response command has a data
         // payload, actually allocate space
         if (hasData() || hasRespData()) {
-            assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
-            flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
+            flags.set(SHARED_DATA);
+            data = allocSharedData(getSize());
         }
     }
 
@@ -1410,11 +1495,14 @@ class Packet : public Printable, public Extensible<Packet>
             return false;
         }
         // all packets that are carrying a payload should have a valid
-        // data pointer
+        // data pointer, only a functional write modifies it
+        uint8_t *other_data = nullptr;
+        if (other->hasData()) {
+            other_data = isWrite() ? other->getPtr<uint8_t>() :
+                const_cast<uint8_t *>(other->getConstPtr<uint8_t>());
+        }
         return trySatisfyFunctional(other, other->getAddr(), other->isSecure(),
-                                    other->getSize(),
-                                    other->hasData() ?
-                                    other->getPtr<uint8_t>() : NULL);
+                                    other->getSize(), other_data);
     }
 
     /**
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "mem/packet.hh"
+#include "mem/packet_access.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+PacketPtr
+makeWrite(Addr addr, unsigned size)
+{
+    // requests are time stamped, and there is no event queue keeping
+    // track of the current tick of the thread
+    static thread_local Tick tick = 0;
+    Gem5Internal::_curTickPtr = &tick;
+
+    RequestPtr req = std::make_shared<Request>(addr, size, 0, 0);
+    PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
+    pkt->allocate();
+    return pkt;
+}
+
+} // anonymous namespace
+
+/** A copy of a packet shares the payload of the original. */
+TEST(PacketTest, CopySharesPayload)
+{
+    PacketPtr pkt = makeWrite(0x1000, 8);
+    pkt->setLE<uint64_t>(0x0123456789abcdef);
+
+    PacketPtr copy = new Packet(pkt, false, true);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), copy->getConstPtr<uint8_t>());
+    EXPECT_EQ(copy->getLE<uint64_t>(), 0x0123456789abcdef);
+
+    delete copy;
+    delete pkt;
+}
+
+/** Reading the payload through any of the read accessors never copies. */
+TEST(PacketTest, ReadDoesNotCopy)
+{
+    PacketPtr pkt = makeWrite(0x1000, 8);
+    pkt->setLE<uint64_t>(42);
+    PacketPtr copy = new Packet(pkt, false, true);
+
+    const uint8_t *data = pkt->getConstPtr<uint8_t>();
+    const Packet *const_copy = copy;
+    EXPECT_EQ(const_copy->getPtr<uint8_t>(), data);
+    EXPECT_EQ(copy->getConstPtr<uint8_t>(), data);
+    EXPECT_EQ(copy->getLE<uint64_t>(), 42);
+
+    uint64_t value = 0;
+    copy->writeData(reinterpret_cast<uint8_t *>(&value));
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(copy->getConstPtr<uint8_t>(), data);
+
+    delete copy;
+    delete pkt;
+}
+
+/** Writing through getPtr gives the writer its own copy. */
+TEST(PacketTest, CopyOnWriteGetPtr)
+{
+    PacketPtr pkt = makeWrite(0x1000, 4);
+    pkt->setLE<uint32_t>(1);
+    PacketPtr copy = new Packet(pkt, false, true);
+
+    const uint8_t *shared = pkt->getConstPtr<uint8_t>();
+    copy->getPtr<uint8_t>()[0] = 2;
+
+    EXPECT_NE(copy->getConstPtr<uint8_t>(), shared);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), shared);
+    EXPECT_EQ(pkt->getLE<uint32_t>(), 1);
+    EXPECT_EQ(copy->getLE<uint32_t>(), 2);
+
+    // the original is the only user of its payload now, and can
+    // write to it in place
+    pkt->getPtr<uint8_t>()[0] = 3;
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), shared);
+    EXPECT_EQ(pkt->getLE<uint32_t>(), 3);
+
+    delete copy;
+    delete pkt;
+}
+
+/** Writing through setRaw gives the writer its own copy. */
+TEST(PacketTest, CopyOnWriteSetRaw)
+{
+    PacketPtr pkt = makeWrite(0x1000, 4);
+    pkt->setLE<uint32_t>(1);
+    PacketPtr copy = new Packet(pkt, false, true);
+
+    copy->setLE<uint32_t>(2);
+    EXPECT_NE(copy->getConstPtr<uint8_t>(), pkt->getConstPtr<uint8_t>());
+    EXPECT_EQ(pkt->getLE<uint32_t>(), 1);
+    EXPECT_EQ(copy->getLE<uint32_t>(), 2);
+
+    delete copy;
+    delete pkt;
+}
+
+/** Setting the data of a packet from the payload it shares is a no-op. */
+TEST(PacketTest, SetDataFromSharedPayload)
+{
+    PacketPtr pkt = makeWrite(0x1000, 4);
+    pkt->setLE<uint32_t>(7);
+    PacketPtr copy = new Packet(pkt, false, true);
+
+    copy->setData(pkt->getConstPtr<uint8_t>());
+    EXPECT_EQ(copy->getConstPtr<uint8_t>(), pkt->getConstPtr<uint8_t>());
+    EXPECT_EQ(copy->getLE<uint32_t>(), 7);
+
+    delete copy;
+    delete pkt;
+}
+
+/** The payload lives as long as any packet references it. */
+TEST(PacketTest, PayloadRefCount)
+{
+    PacketPtr pkt = makeWrite(0x1000, 64);
+    for (unsigned i = 0; i < 64; i++)
+        pkt->getPtr<uint8_t>()[i] = i;
+    PacketPtr copy1 = new Packet(pkt, false, true);
+    PacketPtr copy2 = new Packet(copy1, false, true);
+
+    delete pkt;
+    delete copy1;
+    for (unsigned i = 0; i < 64; i++)
+        EXPECT_EQ(copy2->getConstPtr<uint8_t>()[i], i);
+
+    delete copy2;
+}
+
+/** Static payloads are still shared by pointer, and never copied. */
+TEST(PacketTest, StaticDataNotCopied)
+{
+    uint32_t buffer = 5;
+    PacketPtr pkt = makeWrite(0x1000, 4);
+    pkt->deleteData();
+    pkt->dataStatic(&buffer);
+    PacketPtr copy = new Packet(pkt, false, true);
+
+    copy->setLE<uint32_t>(6);
+    EXPECT_EQ(copy->getConstPtr<uint32_t>(), &buffer);
+    EXPECT_EQ(buffer, 6);
+
+    delete copy;
+    delete pkt;
+}
+
+/** Freed packets and payloads are reused by the same thread. */
+TEST(PacketTest, FreeListReuse)
+{
+    PacketPtr pkt = makeWrite(0x1000, 64);
+    void *chunk = pkt;
+    const uint8_t *payload = pkt->getConstPtr<uint8_t>();
+    delete pkt;
+
+    pkt = makeWrite(0x2000, 64);
+    EXPECT_EQ(static_cast<void *>(pkt), chunk);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), payload);
+    delete pkt;
+}
+
+/** The free lists are per thread. */
+TEST(PacketTest, FreeListPerThread)
+{
+    PacketPtr pkt = makeWrite(0x1000, 64);
+    void *chunk = pkt;
+    const uint8_t *payload = pkt->getConstPtr<uint8_t>();
+    delete pkt;
+
+    // this thread's free lists hold on to the chunks, so another
+    // thread gets different ones
+    void *other_chunk = nullptr;
+    const uint8_t *other_payload = nullptr;
+    std::thread thread([&]() {
+        PacketPtr other = makeWrite(0x2000, 64);
+        other_chunk = other;
+        other_payload = other->getConstPtr<uint8_t>();
+        delete other;
+    });
+    thread.join();
+    EXPECT_NE(other_chunk, chunk);
+    EXPECT_NE(other_payload, payload);
+
+    // and they are still there for this thread
+    pkt = makeWrite(0x3000, 64);
+    EXPECT_EQ(static_cast<void *>(pkt), chunk);
+    EXPECT_EQ(pkt->getConstPtr<uint8_t>(), payload);
+    delete pkt;
+}
+
+/**
+ * A packet freed by another thread than the one that allocated it goes
+ * to the free list of the freeing thread.
+ */
+TEST(PacketTest, FreeListCrossThread)
+{
+    PacketPtr pkt = makeWrite(0x1000, 8);
+    pkt->setLE<uint64_t>(9);
+    PacketPtr copy = new Packet(pkt, false, true);
+    void *chunk = copy;
+
+    void *reused = nullptr;
+    std::thread thread([&]() {
+        delete copy;
+        PacketPtr other = makeWrite(0x2000, 8);
+        reused = other;
+        delete other;
+    });
+    thread.join();
+    EXPECT_EQ(reused, chunk);
+
+    // the payload is still referenced by the original packet
+    EXPECT_EQ(pkt->getLE<uint64_t>(), 9);
+    delete pkt;
+}
+
+namespace
+{
+
+/**
+ * Frees a packet, and allocates another one, when the thread exits.
+ * Constructed before the first packet of the thread, it is destroyed
+ * after the free lists.
+ */
+struct PacketOwner
+{
+    PacketPtr pkt = nullptr;
+
+    ~PacketOwner()
+    {
+        delete pkt;
+        delete makeWrite(0x2000, 64);
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * Packets allocated or freed after the free lists of the thread are
+ * destroyed go straight to the system, run with ASan to check this.
+ */
+TEST(PacketTest, FreeAfterFreeListsDestroyed)
+{
+    std::thread thread([]() {
+        static thread_local PacketOwner owner;
+        owner.pkt = makeWrite(0x1000, 64);
+        // leave a chunk in the free lists
+        delete makeWrite(0x3000, 64);
+    });
+    thread.join();
+}
@@ -51,7 +51,7 @@ template <typename T>
 inline T
 Packet::getRaw() const
 {
-    assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+    assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
     assert(sizeof(T) <= size);
     return *(T*)data;
 }
@@ -60,8 +60,9 @@ template <typename T>
 inline void
 Packet::setRaw(T v)
 {
-    assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+    assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA|SHARED_DATA));
     assert(sizeof(T) <= size);
+    makeDataUnique();
     *(T*)data = v;
 }
 
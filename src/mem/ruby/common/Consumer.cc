@@ -47,32 +47,47 @@ namespace ruby
 {
 
 Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
-    : m_wakeup_event([this]{ processCurrentEvent(); },
+    : m_pending_inputs(0),
+      m_wakeup_event([this]{ processCurrentEvent(); },
                     "Consumer Event", false, ev_prio),
       em(_em)
-{ }
+{
+    m_wakeup_ticks.reserve(8);
+}
+
+void
+Consumer::insertWakeup(Tick when)
+{
+    auto it = std::lower_bound(m_wakeup_ticks.begin(), m_wakeup_ticks.end(),
+                               when, std::greater<Tick>());
+    if (it == m_wakeup_ticks.end() || *it != when)
+        m_wakeup_ticks.insert(it, when);
+}
 
 void
 Consumer::scheduleEvent(Cycles timeDelta)
 {
-    m_wakeup_ticks.insert(em->clockEdge(timeDelta));
+    insertWakeup(em->clockEdge(timeDelta));
     scheduleNextWakeup();
 }
 
 void
 Consumer::scheduleEventAbsolute(Tick evt_time)
 {
-    m_wakeup_ticks.insert(
-        divCeil(evt_time, em->clockPeriod()) * em->clockPeriod());
+    insertWakeup(divCeil(evt_time, em->clockPeriod()) * em->clockPeriod());
     scheduleNextWakeup();
 }
 
 void
 Consumer::scheduleNextWakeup()
 {
-    // look for the next tick in the future to schedule
-    auto it = m_wakeup_ticks.lower_bound(em->clockEdge());
-    if (it != m_wakeup_ticks.end()) {
+    // look for the next tick in the future to schedule, the earliest
+    // ticks being at the back
+    const Tick now = em->clockEdge();
+    auto it = m_wakeup_ticks.rbegin();
+    while (it != m_wakeup_ticks.rend() && *it < now)
+        ++it;
+    if (it != m_wakeup_ticks.rend()) {
         Tick when = *it;
         assert(when >= em->clockEdge());
         if (m_wakeup_event.scheduled() && (when < m_wakeup_event.when()))
@@ -85,12 +100,12 @@ Consumer::scheduleNextWakeup()
 void
 Consumer::processCurrentEvent()
 {
-    auto curr = m_wakeup_ticks.begin();
-    assert(em->clockEdge() == *curr);
+    assert(!m_wakeup_ticks.empty());
+    assert(em->clockEdge() == m_wakeup_ticks.back());
 
     // remove the current tick from the wakeup list, wake up, and then schedule
     // the next wakeup
-    m_wakeup_ticks.erase(curr);
+    m_wakeup_ticks.pop_back();
     wakeup();
     scheduleNextWakeup();
 }
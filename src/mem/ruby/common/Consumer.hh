@@ -47,8 +47,11 @@
 #ifndef __MEM_RUBY_COMMON_CONSUMER_HH__
 #define __MEM_RUBY_COMMON_CONSUMER_HH__
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iostream>
-#include <set>
+#include <vector>
 
 #include "sim/clocked_object.hh"
 
@@ -75,7 +78,51 @@ class Consumer
     bool
     alreadyScheduled(Tick time)
     {
-        return m_wakeup_ticks.find(time) != m_wakeup_ticks.end();
+        return std::binary_search(m_wakeup_ticks.begin(),
+                                  m_wakeup_ticks.end(), time,
+                                  std::greater<Tick>());
+    }
+
+    /**
+     * Maximum number of inputs whose readiness can be tracked. Inputs
+     * beyond this limit must be polled on every wakeup.
+     */
+    static constexpr int MaxTrackedInputs = 64;
+
+    /**
+     * Flag an input (e.g., a MessageBuffer) as having messages to
+     * service. Inputs call this whenever they receive a message, so
+     * the consumer can skip the ones that are known to be empty.
+     *
+     * @param input Index of the input in the consumer
+     */
+    void
+    markInputPending(int input)
+    {
+        assert(input >= 0 && input < MaxTrackedInputs);
+        m_pending_inputs |= (uint64_t(1) << input);
+    }
+
+    /**
+     * @param input Index of the input, or a negative value for inputs
+     *        that are not tracked
+     * @return Whether the input may have messages to service
+     */
+    bool
+    inputPending(int input) const
+    {
+        return input < 0 || (m_pending_inputs & (uint64_t(1) << input));
+    }
+
+    /**
+     * Clear the pending flag of an input. Consumers must only do this
+     * once the input is completely empty.
+     */
+    void
+    clearInputPending(int input)
+    {
+        if (input >= 0)
+            m_pending_inputs &= ~(uint64_t(1) << input);
     }
 
     ClockedObject *
@@ -88,10 +135,21 @@ class Consumer
     void scheduleEvent(Cycles timeDelta);
 
   private:
-    std::set<Tick> m_wakeup_ticks;
+    /**
+     * Pending wakeup ticks, without duplicates and sorted in decreasing
+     * order so the earliest one is at the back. Consumers only have a
+     * handful of wakeups outstanding at any time, so a small flat array
+     * is much cheaper than a tree.
+     */
+    std::vector<Tick> m_wakeup_ticks;
+
+    /** Bit mask of the inputs that may have messages to service. */
+    uint64_t m_pending_inputs;
+
     EventFunctionWrapper m_wakeup_event;
     ClockedObject *em;
 
+    void insertWakeup(Tick when);
     void scheduleNextWakeup();
     void processCurrentEvent();
 };
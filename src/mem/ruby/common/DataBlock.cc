@@ -53,9 +53,8 @@ DataBlock::DataBlock(const DataBlock &cp)
 {
     uint8_t *block_update;
     size_t block_bytes = RubySystem::getBlockSizeBytes();
-    m_data = new uint8_t[block_bytes];
+    allocStorage();
     memcpy(m_data, cp.m_data, block_bytes);
-    m_alloc = true;
     // If this data block is involved in an atomic operation, the effect
     // of applying the atomic operations on the data block are recorded in
     // m_atomicLog. If so, we must copy over every entry in the change log
@@ -67,10 +66,18 @@ DataBlock::DataBlock(const DataBlock &cp)
 }
 
 void
-DataBlock::alloc()
+DataBlock::allocStorage()
 {
-    m_data = new uint8_t[RubySystem::getBlockSizeBytes()];
+    const int block_bytes = RubySystem::getBlockSizeBytes();
+    m_data = block_bytes <= InlineBlockBytes ?
+        m_inline : new uint8_t[block_bytes];
     m_alloc = true;
+}
+
+void
+DataBlock::alloc()
+{
+    allocStorage();
     clear();
 }
 
@@ -61,6 +61,13 @@ class WriteMask;
 class DataBlock
 {
   public:
+    /**
+     * Blocks up to this size are stored inline in the DataBlock, so
+     * creating or copying one (e.g., as part of a message) does not
+     * touch the heap. Larger blocks fall back to a heap allocation.
+     */
+    static constexpr int InlineBlockBytes = 128;
+
     DataBlock()
     {
         alloc();
@@ -70,7 +77,7 @@ class DataBlock
 
     ~DataBlock()
     {
-        if (m_alloc)
+        if (m_alloc && m_data != m_inline)
             delete [] m_data;
 
         // If data block involved in atomic
@@ -103,9 +110,13 @@ class DataBlock
 
   private:
     void alloc();
+    void allocStorage();
     uint8_t *m_data;
     bool m_alloc;
 
+    /** Inline storage used when the block size allows it. */
+    uint8_t m_inline[InlineBlockBytes];
+
     // Tracks block changes when atomic ops are applied
     std::deque<uint8_t*> m_atomicLog;
 };
@@ -114,7 +125,7 @@ inline void
 DataBlock::assign(uint8_t *data)
 {
     assert(data != NULL);
-    if (m_alloc) {
+    if (m_alloc && m_data != m_inline) {
         delete [] m_data;
     }
     m_data = data;
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_COMMON_FLATHASHMAP_HH__
+#define __MEM_RUBY_COMMON_FLATHASHMAP_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Hash map with a flat, open-addressing index, meant for the hot
+ * address lookups of the Ruby structures (tag indices, TBE tables,
+ * request tables and stall maps).
+ *
+ * The index is a Robin Hood hash table holding a copy of each key and
+ * the position of its element, so a lookup is a short linear probe
+ * over contiguous memory. Deletions use backward shifting, so there
+ * are no tombstones. The elements themselves live in a separate pool
+ * and never move: references to them stay valid until the element is
+ * erased, as with std::unordered_map. This matters for the Ruby
+ * structures, which hand out pointers to entries (e.g., TBEs) while
+ * other entries are being inserted.
+ *
+ * Iteration follows the element pool rather than the hash order, so it
+ * does not depend on the hash function, and erasing elements while
+ * iterating only invalidates the erased element.
+ *
+ * Owners should size the map with their capacity (constructor or
+ * reserve()) so that it never needs to grow.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class FlatHashMap
+{
+  public:
+    typedef Key key_type;
+    typedef Value mapped_type;
+    typedef std::pair<const Key, Value> value_type;
+    typedef std::size_t size_type;
+
+  private:
+    /** Entry of the index; dist is the probe distance plus one. */
+    struct Slot
+    {
+        Key key{};
+        uint32_t node = 0;
+        uint32_t dist = 0;
+    };
+
+    /** Storage for one element of the pool. */
+    struct Node
+    {
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+        bool used = false;
+
+        value_type &
+        value()
+        {
+            return *reinterpret_cast<value_type *>(storage);
+        }
+
+        const value_type &
+        value() const
+        {
+            return *reinterpret_cast<const value_type *>(storage);
+        }
+    };
+
+    /** Maximum load of the index, as a fraction of eighths. */
+    static constexpr size_type MaxLoadEighths = 7;
+
+    std::vector<Slot> slots;
+    size_type mask = 0;
+    unsigned shift = 64;
+    size_type numElements = 0;
+
+    std::deque<Node> nodes;
+    std::vector<uint32_t> freeNodes;
+
+    Hash hasher;
+
+    size_type
+    home(const Key &key) const
+    {
+        // Fibonacci hashing spreads keys with zero low bits, such as
+        // line addresses, over the whole table
+        const uint64_t h = static_cast<uint64_t>(hasher(key));
+        return (h * 0x9E3779B97F4A7C15ULL) >> shift;
+    }
+
+    /** @return The position of the key in the index, or -1. */
+    std::ptrdiff_t
+    findSlot(const Key &key) const
+    {
+        if (numElements == 0)
+            return -1;
+        size_type pos = home(key);
+        for (uint32_t dist = 1; ; ++dist) {
+            const Slot &slot = slots[pos];
+            if (slot.dist < dist)
+                return -1;
+            if (slot.key == key)
+                return pos;
+            pos = (pos + 1) & mask;
+        }
+    }
+
+    void
+    insertSlot(Slot cur)
+    {
+        size_type pos = home(cur.key);
+        cur.dist = 1;
+        while (true) {
+            Slot &slot = slots[pos];
+            if (slot.dist == 0) {
+                slot = cur;
+                return;
+            }
+            if (slot.dist < cur.dist)
+                std::swap(slot, cur);
+            pos = (pos + 1) & mask;
+            ++cur.dist;
+        }
+    }
+
+    void
+    eraseSlot(size_type pos)
+    {
+        size_type next = (pos + 1) & mask;
+        while (slots[next].dist > 1) {
+            slots[pos] = slots[next];
+            --slots[pos].dist;
+            pos = next;
+            next = (next + 1) & mask;
+        }
+        slots[pos].dist = 0;
+    }
+
+    void
+    resizeIndex(size_type min_slots)
+    {
+        size_type size = 8;
+        unsigned bits = 3;
+        while (size < min_slots) {
+            size <<= 1;
+            ++bits;
+        }
+
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.resize(size);
+        mask = size - 1;
+        shift = 64 - bits;
+        for (const auto &slot : old) {
+            if (slot.dist)
+                insertSlot(slot);
+        }
+    }
+
+    uint32_t
+    allocNode()
+    {
+        if (!freeNodes.empty()) {
+            const uint32_t node = freeNodes.back();
+            freeNodes.pop_back();
+            return node;
+        }
+        nodes.emplace_back();
+        return nodes.size() - 1;
+    }
+
+    void
+    releaseNode(uint32_t node)
+    {
+        Node &n = nodes[node];
+        n.value().~value_type();
+        n.used = false;
+        freeNodes.push_back(node);
+    }
+
+    template <class... Args>
+    std::pair<uint32_t, bool>
+    emplaceNode(const Key &key, Args&&... args)
+    {
+        const std::ptrdiff_t pos = findSlot(key);
+        if (pos >= 0)
+            return {slots[pos].node, false};
+
+        if ((numElements + 1) * 8 > slots.size() * MaxLoadEighths)
+            resizeIndex(slots.size() * 2);
+
+        const uint32_t node = allocNode();
+        Node &n = nodes[node];
+        new (n.storage) value_type(std::piecewise_construct,
+                                   std::forward_as_tuple(key),
+                                   std::forward_as_tuple(
+                                       std::forward<Args>(args)...));
+        n.used = true;
+
+        Slot slot;
+        slot.key = key;
+        slot.node = node;
+        insertSlot(slot);
+        ++numElements;
+        return {node, true};
+    }
+
+  public:
+    template <class Map, class V>
+    class Iterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef V value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef V *pointer;
+        typedef V &reference;
+
+        Iterator() = default;
+        Iterator(Map *map, size_type node) : map(map), node(node)
+        {
+            skipFree();
+        }
+
+        /** Allow conversion from iterator to const_iterator. */
+        template <class M, class W>
+        Iterator(const Iterator<M, W> &other)
+            : map(other.map), node(other.node)
+        {}
+
+        reference operator*() const { return map->nodes[node].value(); }
+        pointer operator->() const { return &map->nodes[node].value(); }
+
+        Iterator &
+        operator++()
+        {
+            ++node;
+            skipFree();
+            return *this;
+        }
+
+        Iterator
+        operator++(int)
+        {
+            Iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool
+        operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool
+        operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+
+      private:
+        template <class M, class W>
+        friend class Iterator;
+        friend class FlatHashMap;
+
+        void
+        skipFree()
+        {
+            while (node < map->nodes.size() && !map->nodes[node].used)
+                ++node;
+        }
+
+        Map *map = nullptr;
+        size_type node = 0;
+    };
+
+    typedef Iterator<FlatHashMap, value_type> iterator;
+    typedef Iterator<const FlatHashMap, const value_type> const_iterator;
+
+    /**
+     * @param capacity Number of elements the map can hold without
+     *        growing its index
+     */
+    explicit FlatHashMap(size_type capacity=0) { reserve(capacity); }
+
+    FlatHashMap(const FlatHashMap &other) : FlatHashMap(other.size())
+    {
+        for (const auto &value : other)
+            emplace(value.first, value.second);
+    }
+
+    FlatHashMap &
+    operator=(const FlatHashMap &other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (const auto &value : other)
+                emplace(value.first, value.second);
+        }
+        return *this;
+    }
+
+    ~FlatHashMap() { clear(); }
+
+    /**
+     * Make room for at least the given number of elements, so that
+     * inserting them does not grow the index.
+     */
+    void
+    reserve(size_type capacity)
+    {
+        const size_type min_slots =
+            (capacity * 8 + MaxLoadEighths - 1) / MaxLoadEighths;
+        if (slots.empty() || min_slots > slots.size())
+            resizeIndex(min_slots);
+    }
+
+    size_type size() const { return numElements; }
+    bool empty() const { return numElements == 0; }
+
+    void
+    clear()
+    {
+        for (size_type i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].used)
+                nodes[i].value().~value_type();
+        }
+        nodes.clear();
+        freeNodes.clear();
+        for (auto &slot : slots)
+            slot.dist = 0;
+        numElements = 0;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, nodes.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, nodes.size()); }
+
+    iterator
+    find(const Key &key)
+    {
+        const std::ptrdiff_t pos = findSlot(key);
+        return pos < 0 ? end() : iterator(this, slots[pos].node);
+    }
+
+    const_iterator
+    find(const Key &key) const
+    {
+        const std::ptrdiff_t pos = findSlot(key);
+        return pos < 0 ? end() : const_iterator(this, slots[pos].node);
+    }
+
+    size_type count(const Key &key) const { return findSlot(key) >= 0; }
+
+    Value &
+    operator[](const Key &key)
+    {
+        return nodes[emplaceNode(key).first].value().second;
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool>
+    emplace(const Key &key, Args&&... args)
+    {
+        auto res = emplaceNode(key, std::forward<Args>(args)...);
+        return {iterator(this, res.first), res.second};
+    }
+
+    std::pair<iterator, bool>
+    insert(const value_type &value)
+    {
+        return emplace(value.first, value.second);
+    }
+
+    size_type
+    erase(const Key &key)
+    {
+        const std::ptrdiff_t pos = findSlot(key);
+        if (pos < 0)
+            return 0;
+        const uint32_t node = slots[pos].node;
+        eraseSlot(pos);
+        releaseNode(node);
+        --numElements;
+        return 1;
+    }
+
+    iterator
+    erase(const_iterator it)
+    {
+        assert(it.map == this && nodes[it.node].used);
+        iterator next(this, it.node + 1);
+        erase(nodes[it.node].value().first);
+        return next;
+    }
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_COMMON_FLATHASHMAP_HH__
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mem/ruby/common/FlatHashMap.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+/** Inverse of the Fibonacci hashing multiplier, modulo 2^64. */
+constexpr uint64_t
+fibonacciInverse()
+{
+    const uint64_t mult = 0x9E3779B97F4A7C15ULL;
+    uint64_t inv = mult;
+    for (int i = 0; i < 5; ++i)
+        inv *= 2 - mult * inv;
+    return inv;
+}
+
+/**
+ * Hash that places a key in a chosen slot of an 8-slot index: the top
+ * three bits of the key are its home slot, and the remaining bits tell
+ * keys with the same home apart.
+ */
+struct HomeHash
+{
+    std::size_t
+    operator()(uint64_t key) const
+    {
+        return key * fibonacciInverse();
+    }
+};
+
+uint64_t
+homedAt(uint64_t home, uint64_t id)
+{
+    return (home << 61) | id;
+}
+
+} // anonymous namespace
+
+TEST(FlatHashMapTest, FibonacciInverse)
+{
+    EXPECT_EQ(0x9E3779B97F4A7C15ULL * fibonacciInverse(), 1u);
+}
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    FlatHashMap<uint64_t, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(0x40), map.end());
+
+    auto res = map.emplace(0x40, 1);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(res.first->first, 0x40u);
+    EXPECT_EQ(res.first->second, 1);
+
+    // A second insertion of the same key keeps the old value
+    res = map.insert({0x40, 2});
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(res.first->second, 1);
+
+    map[0x80] = 3;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.count(0x40), 1u);
+    EXPECT_EQ(map.count(0x80), 1u);
+    EXPECT_EQ(map.count(0xc0), 0u);
+    EXPECT_EQ(map.find(0x80)->second, 3);
+
+    EXPECT_EQ(map.erase(0x40), 1u);
+    EXPECT_EQ(map.erase(0x40), 0u);
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.find(0x40), map.end());
+    EXPECT_EQ(map.find(0x80)->second, 3);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(0x80), map.end());
+}
+
+TEST(FlatHashMapTest, BackwardShiftAcrossWrap)
+{
+    // Seven elements fit in the smallest index, which has eight slots
+    FlatHashMap<uint64_t, int, HomeHash> map(7);
+
+    // Three keys homed at the last slot take slots 7, 0 and 1, and a key
+    // homed at slot 0 is displaced to slot 2
+    const uint64_t a = homedAt(7, 1);
+    const uint64_t b = homedAt(7, 2);
+    const uint64_t c = homedAt(7, 3);
+    const uint64_t d = homedAt(0, 1);
+    map[a] = 1;
+    map[b] = 2;
+    map[c] = 3;
+    map[d] = 4;
+
+    // Erasing the first key shifts the others back over the wrap point
+    EXPECT_EQ(map.erase(a), 1u);
+    EXPECT_EQ(map.find(a), map.end());
+    EXPECT_EQ(map.find(b)->second, 2);
+    EXPECT_EQ(map.find(c)->second, 3);
+    EXPECT_EQ(map.find(d)->second, 4);
+
+    // Erasing a key that wrapped keeps the chain intact
+    EXPECT_EQ(map.erase(b), 1u);
+    EXPECT_EQ(map.find(c)->second, 3);
+    EXPECT_EQ(map.find(d)->second, 4);
+
+    // Lookups of missing keys homed on either side of the wrap stop at
+    // the end of the chain
+    EXPECT_EQ(map.find(homedAt(7, 4)), map.end());
+    EXPECT_EQ(map.find(homedAt(0, 2)), map.end());
+
+    // Refilling the freed slots still finds everything
+    map[a] = 5;
+    map[homedAt(1, 1)] = 6;
+    EXPECT_EQ(map.size(), 4u);
+    EXPECT_EQ(map.find(a)->second, 5);
+    EXPECT_EQ(map.find(c)->second, 3);
+    EXPECT_EQ(map.find(d)->second, 4);
+    EXPECT_EQ(map.find(homedAt(1, 1))->second, 6);
+
+    EXPECT_EQ(map.erase(c), 1u);
+    EXPECT_EQ(map.erase(d), 1u);
+    EXPECT_EQ(map.find(a)->second, 5);
+    EXPECT_EQ(map.find(homedAt(1, 1))->second, 6);
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating)
+{
+    FlatHashMap<uint64_t, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[i * 64] = i;
+
+    // Erase the odd values through the iterator; the iterator returned
+    // by erase must point to the element following the erased one
+    int visited = 0;
+    for (auto it = map.begin(); it != map.end(); ) {
+        ++visited;
+        if (it->second % 2)
+            it = map.erase(it);
+        else
+            ++it;
+    }
+    EXPECT_EQ(visited, 100);
+    EXPECT_EQ(map.size(), 50u);
+
+    // Erase the remaining elements by key while iterating; only the
+    // erased element is invalidated
+    visited = 0;
+    for (auto it = map.begin(); it != map.end(); ) {
+        EXPECT_EQ(it->second % 2, 0);
+        const uint64_t key = (it++)->first;
+        EXPECT_EQ(map.erase(key), 1u);
+        ++visited;
+    }
+    EXPECT_EQ(visited, 50);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatHashMapTest, ReserveAndGrow)
+{
+    FlatHashMap<uint64_t, int> map;
+    map.reserve(10);
+
+    std::vector<int *> refs;
+    for (int i = 0; i < 10; ++i)
+        refs.push_back(&(map[i * 64] = i));
+
+    // Growing past the 7/8 load factor rehashes the index but does not
+    // move the elements
+    for (int i = 10; i < 1000; ++i)
+        refs.push_back(&(map[i * 64] = i));
+    EXPECT_EQ(map.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        auto it = map.find(i * 64);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(&it->second, refs[i]);
+        EXPECT_EQ(it->second, i);
+    }
+
+    // Reserving more than the current size keeps everything reachable
+    map.reserve(5000);
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(&map.find(i * 64)->second, refs[i]);
+
+    // Reserving less than the current size is a no-op
+    map.reserve(1);
+    EXPECT_EQ(map.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.find(i * 64)->second, i);
+}
+
+TEST(FlatHashMapTest, CopyAndAssign)
+{
+    FlatHashMap<uint64_t, std::string> map;
+    for (int i = 0; i < 50; ++i)
+        map[i] = std::to_string(i);
+    map.erase(10);
+
+    FlatHashMap<uint64_t, std::string> copy(map);
+    EXPECT_EQ(copy.size(), 49u);
+    EXPECT_EQ(copy.find(10), copy.end());
+    for (const auto &value : map)
+        EXPECT_EQ(copy.find(value.first)->second, value.second);
+
+    // The copy is independent of the original
+    copy[20] = "twenty";
+    copy.erase(30);
+    EXPECT_EQ(map.find(20)->second, "20");
+    EXPECT_EQ(map.find(30)->second, "30");
+
+    // Assignment replaces the old contents
+    FlatHashMap<uint64_t, std::string> other;
+    other[100] = "100";
+    other = copy;
+    EXPECT_EQ(other.size(), 48u);
+    EXPECT_EQ(other.find(100), other.end());
+    EXPECT_EQ(other.find(20)->second, "twenty");
+    EXPECT_EQ(other.find(30), other.end());
+
+    // Self-assignment keeps the contents
+    auto &alias = other;
+    other = alias;
+    EXPECT_EQ(other.size(), 48u);
+    EXPECT_EQ(other.find(20)->second, "twenty");
+}
+
+TEST(FlatHashMapTest, RandomAgainstUnorderedMap)
+{
+    std::mt19937_64 rng(1);
+    // A small key space forces frequent hits, erasures and reinsertions
+    std::uniform_int_distribution<uint64_t> key_dist(0, 511);
+    std::uniform_int_distribution<int> op_dist(0, 3);
+
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> ref;
+
+    for (int i = 0; i < 100000; ++i) {
+        // Line addresses, as used by the Ruby structures
+        const uint64_t key = key_dist(rng) << 6;
+        switch (op_dist(rng)) {
+          case 0:
+          case 1:
+            map[key] = i;
+            ref[key] = i;
+            break;
+          case 2:
+            ASSERT_EQ(map.erase(key), ref.erase(key));
+            break;
+          case 3: {
+            auto it = map.find(key);
+            auto ref_it = ref.find(key);
+            ASSERT_EQ(it == map.end(), ref_it == ref.end());
+            if (ref_it != ref.end()) {
+                ASSERT_EQ(it->second, ref_it->second);
+            }
+            break;
+          }
+        }
+        ASSERT_EQ(map.size(), ref.size());
+    }
+
+    std::size_t visited = 0;
+    for (const auto &value : map) {
+        auto ref_it = ref.find(value.first);
+        ASSERT_NE(ref_it, ref.end());
+        EXPECT_EQ(value.second, ref_it->second);
+        ++visited;
+    }
+    EXPECT_EQ(visited, ref.size());
+}
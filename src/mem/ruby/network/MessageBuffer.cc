@@ -86,7 +86,9 @@ MessageBuffer::MessageBuffer(const Params &p)
              "Average occupancy of buffer capacity")
 {
     m_msg_counter = 0;
+    m_remote_receive_time = MaxTick;
     m_consumer = NULL;
+    m_consumer_input = -1;
     m_size_last_time_size_checked = 0;
     m_size_at_cycle_start = 0;
     m_stalled_at_cycle_start = 0;
@@ -94,6 +96,9 @@ MessageBuffer::MessageBuffer(const Params &p)
     m_priority_rank = 0;
 
     m_stall_msg_map.clear();
+    // a finite buffer never stalls more lines than it holds messages
+    if (m_max_size > 0)
+        m_stall_msg_map.reserve(m_max_size);
     m_input_link_id = 0;
     m_vnet_id = 0;
 
@@ -207,9 +212,10 @@ Tick
 random_time()
 {
     Tick time = 1;
-    time += random_mt.random(0, 3);  // [0...3]
-    if (random_mt.random(0, 7) == 0) {  // 1 in 8 chance
-        time += 100 + random_mt.random(1, 15); // 100 + [1...15]
+    Random &random = RubySystem::getRandom();
+    time += random.random(0, 3);  // [0...3]
+    if (random.random(0, 7) == 0) {  // 1 in 8 chance
+        time += 100 + random.random(1, 15); // 100 + [1...15]
     }
     return time;
 }
@@ -218,6 +224,14 @@ void
 MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
                        bool bypassStrictFIFO)
 {
+    // producer and consumer run on different threads in parallel Ruby
+    assert(m_consumer != NULL);
+    if (inParallelMode &&
+        m_consumer->getObject()->eventQueue() != curEventQueue()) {
+        enqueueRemote(message, current_time, delta, bypassStrictFIFO);
+        return;
+    }
+
     // record current time incase we have a pop that also adjusts my size
     if (m_time_last_time_enqueue < current_time) {
         m_msgs_this_cycle = 0;  // first msg this cycle
@@ -295,11 +309,75 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
             arrival_time, *(message.get()));
 
     // Schedule the wakeup
-    assert(m_consumer != NULL);
-    m_consumer->scheduleEventAbsolute(arrival_time);
+    notifyConsumer(arrival_time);
     m_consumer->storeEventInfo(m_vnet_id);
 }
 
+void
+MessageBuffer::enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                             bool bypassStrictFIFO)
+{
+    // the consumer's queue may run up to a quantum ahead of the producer,
+    // so the latency of the crossing must cover it
+    fatal_if(delta < simQuantum, "%s: message delay (%d) across event "
+             "queues is smaller than the simulation quantum (%d).\n",
+             name(), delta, simQuantum);
+    // the occupancy of the buffer cannot be checked from another thread
+    fatal_if(m_max_size != 0, "%s: buffers connecting different event "
+             "queues must have an infinite size.\n", name());
+    // a randomized arrival time could precede the hand-over
+    fatal_if(m_randomization == MessageRandomization::enabled ||
+             (m_randomization == MessageRandomization::ruby_system &&
+              RubySystem::getRandomization()),
+             "%s: buffers connecting different event queues can't "
+             "randomize message delays.\n", name());
+
+    Tick arrival_time = current_time + delta;
+    DPRINTF(RubyQueue, "Remote enqueue arrival_time: %lld, Message: %s\n",
+            arrival_time, *message);
+
+    // messages are received in batches: a new receive event is only
+    // needed if none is pending or if this message arrives before it
+    bool schedule_receive = false;
+    {
+        std::lock_guard<std::mutex> lock(m_remote_mutex);
+        m_remote_msgs.push_back({message, current_time, delta,
+                                 bypassStrictFIFO});
+        if (arrival_time < m_remote_receive_time) {
+            m_remote_receive_time = arrival_time;
+            schedule_receive = true;
+        }
+    }
+
+    // the event is inserted through the asynchronous queue of the consumer
+    if (schedule_receive) {
+        m_consumer->getObject()->eventQueue()->schedule(
+            new EventFunctionWrapper([this]{ receiveRemote(); },
+                                     name() + ".remoteEnqueue", true),
+            arrival_time);
+    }
+}
+
+void
+MessageBuffer::receiveRemote()
+{
+    std::vector<RemoteMsg> msgs;
+    {
+        std::lock_guard<std::mutex> lock(m_remote_mutex);
+        msgs.swap(m_remote_msgs);
+        m_remote_receive_time = MaxTick;
+    }
+
+    // all the messages handed over so far are received by the first
+    // event, possibly before they arrive. A receive event that was
+    // superseded by an earlier one may therefore find nothing to do.
+    // They go through the regular enqueue path, now on the consumer's
+    // thread, with the time they were sent at, so the ordering checks
+    // and stats see them as local messages.
+    for (auto &msg : msgs)
+        enqueue(msg.message, msg.sendTime, msg.delta, msg.bypassStrictFIFO);
+}
+
 Tick
 MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 {
@@ -395,7 +473,7 @@ MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
         push_heap(m_prio_heap.begin(), m_prio_heap.end(),
                   std::greater<MsgPtr>());
 
-        m_consumer->scheduleEventAbsolute(schdTick);
+        notifyConsumer(schdTick);
 
         DPRINTF(RubyQueue, "Requeue arrival_time: %lld, Message: %s\n",
             schdTick, *(m.get()));
@@ -433,11 +511,17 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle.
     //
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end(); ++map_iter) {
-        m_stall_map_size -= map_iter->second.size();
+    std::vector<Addr> stalled_addrs;
+    stalled_addrs.reserve(m_stall_msg_map.size());
+    for (const auto &stalled : m_stall_msg_map)
+        stalled_addrs.push_back(stalled.first);
+    std::sort(stalled_addrs.begin(), stalled_addrs.end());
+
+    for (Addr addr : stalled_addrs) {
+        auto &msg_list = m_stall_msg_map[addr];
+        m_stall_map_size -= msg_list.size();
         assert(m_stall_map_size >= 0);
-        reanalyzeList(map_iter->second, current_time);
+        reanalyzeList(msg_list, current_time);
     }
     m_stall_msg_map.clear();
 }
@@ -558,6 +642,21 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
             num_functional_accesses++;
     }
 
+    // Check the messages handed over by producers on other event
+    // queues that haven't been received yet
+    {
+        std::lock_guard<std::mutex> lock(m_remote_mutex);
+        for (auto &remote : m_remote_msgs) {
+            Message *msg = remote.message.get();
+            if (is_read && !mask && msg->functionalRead(pkt))
+                return 1;
+            else if (is_read && mask && msg->functionalRead(pkt, *mask))
+                num_functional_accesses++;
+            else if (!is_read && msg->functionalWrite(pkt))
+                num_functional_accesses++;
+        }
+    }
+
     // Check the stall queue and write any messages that may
     // correspond to the address in the packet.
     for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
@@ -50,8 +50,9 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <list>
+#include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "base/trace.hh"
@@ -60,6 +61,7 @@
 #include "mem/port.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/common/FlatHashMap.hh"
 #include "mem/ruby/network/dummy_port.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "params/MessageBuffer.hh"
@@ -102,7 +104,15 @@ class MessageBuffer : public SimObject
     bool areNSlotsAvailable(unsigned int n, Tick curTime);
     int getPriority() { return m_priority_rank; }
     void setPriority(int rank) { m_priority_rank = rank; }
-    void setConsumer(Consumer* consumer)
+    /**
+     * Connect the buffer to the consumer woken up by its messages.
+     *
+     * @param consumer The consumer
+     * @param input Index of the buffer among the inputs of the consumer
+     *        whose readiness the consumer tracks, or -1 if it does not
+     *        track it (see Consumer::markInputPending)
+     */
+    void setConsumer(Consumer* consumer, int input = -1)
     {
         DPRINTF(RubyQueue, "Setting consumer: %s\n", *consumer);
         if (m_consumer != NULL) {
@@ -111,6 +121,7 @@ class MessageBuffer : public SimObject
                   *consumer, *this, *m_consumer);
         }
         m_consumer = consumer;
+        m_consumer_input = input;
     }
 
     Consumer* getConsumer() { return m_consumer; }
@@ -196,19 +207,59 @@ class MessageBuffer : public SimObject
   private:
     void reanalyzeList(std::list<MsgPtr> &, Tick);
 
+    /**
+     * Enqueue a message on behalf of a producer that runs on another
+     * event queue than the consumer. The message is handed over through
+     * a locked list and is enqueued in an event on the consumer's
+     * queue, so the delay must cover the simulation quantum. One event
+     * receives all the messages handed over before it runs.
+     */
+    void enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                       bool bypassStrictFIFO);
+
+    /** Move the messages handed over by remote producers to the heap. */
+    void receiveRemote();
+
+    /** Wake up the consumer at the given time to handle a new message. */
+    void
+    notifyConsumer(Tick when)
+    {
+        if (m_consumer_input >= 0)
+            m_consumer->markInputPending(m_consumer_input);
+        m_consumer->scheduleEventAbsolute(when);
+    }
+
     uint32_t functionalAccess(Packet *pkt, bool is_read, WriteMask *mask);
 
   private:
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
+    //! Index of this buffer in the inputs tracked by the consumer, or -1
+    int m_consumer_input;
     std::vector<MsgPtr> m_prio_heap;
 
+    //! A message handed over by a producer on another event queue
+    struct RemoteMsg
+    {
+        MsgPtr message;
+        Tick sendTime;
+        Tick delta;
+        bool bypassStrictFIFO;
+    };
+
+    //! Messages from producers on other event queues, see enqueueRemote
+    std::mutex m_remote_mutex;
+    std::vector<RemoteMsg> m_remote_msgs;
+    //! Time of the earliest pending receive event, MaxTick if none
+    Tick m_remote_receive_time;
+
     std::function<void()> m_dequeue_callback;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    // the stalled messages are kept in a flat hash map for fast lookups;
+    // code that walks all of them and whose outcome depends on the order
+    // (reanalyzeAllMessages) visits the lines in address order
+    typedef FlatHashMap<Addr, std::list<MsgPtr> > StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
@@ -230,7 +281,7 @@ class MessageBuffer : public SimObject
      * are deferred for enqueueing. Messages in this map are waiting to be
      * enqueued into the message buffer.
      */
-    typedef std::unordered_map<Addr, std::vector<MsgPtr>> DeferredMsgMapType;
+    typedef FlatHashMap<Addr, std::vector<MsgPtr>> DeferredMsgMapType;
     DeferredMsgMapType m_deferred_msg_map;
 
     /**
@@ -45,10 +45,11 @@ namespace garnet
 // Carries m_vc (inherits from flit.hh)
 // and m_is_free_signal (whether VC is free or not)
 
-Credit::Credit(int vc, bool is_free_signal, Tick curTime)
+Credit::Credit(int vc, bool is_free_signal, Tick curTime, int num_credits)
     : flit(0, 0, vc, 0, RouteInfo(), 0, nullptr, 0, 0, curTime)
 {
     m_is_free_signal = is_free_signal;
+    m_num_credits = num_credits;
     m_type = CREDIT_;
 }
 
@@ -85,6 +86,8 @@ Credit::print(std::ostream& out) const
     out << "Type=" << m_type << " ";
     out << "VC=" << m_vc << " ";
     out << "FreeVC=" << m_is_free_signal << " ";
+    if (m_num_credits > 1)
+        out << "Credits=" << m_num_credits << " ";
     out << "Set Time=" << m_time << " ";
     out << "]";
 }
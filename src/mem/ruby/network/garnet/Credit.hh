@@ -48,14 +48,16 @@ namespace garnet
 {
 
 // Credit Signal for buffers inside VC
-// Carries m_vc (inherits from flit.hh)
-// and m_is_free_signal (whether VC is free or not)
+// Carries m_vc (inherits from flit.hh),
+// m_is_free_signal (whether VC is free or not)
+// and m_num_credits (buffer slots freed, more than one for the
+// aggregated flits of the fast mode)
 
 class Credit : public flit
 {
   public:
     Credit() {};
-    Credit(int vc, bool is_free_signal, Tick curTime);
+    Credit(int vc, bool is_free_signal, Tick curTime, int num_credits = 1);
 
     // Functions used by SerDes
     flit* serialize(int ser_id, int parts, uint32_t bWidth);
@@ -65,9 +67,11 @@ class Credit : public flit
     ~Credit() {};
 
     bool is_free_signal() { return m_is_free_signal; }
+    int get_num_credits() { return m_num_credits; }
 
   private:
     bool m_is_free_signal;
+    int m_num_credits;
 };
 
 } // namespace garnet
@@ -86,7 +86,8 @@ CrossbarSwitch::wakeup()
             // in the next cycle
             m_router->getOutputUnit(outport)->insert_flit(t_flit);
             switch_buffer.getTopFlit();
-            m_crossbar_activity++;
+            // an aggregated flit stands for all the flits of its packet
+            m_crossbar_activity += t_flit->get_agg_flits();
         }
     }
 }
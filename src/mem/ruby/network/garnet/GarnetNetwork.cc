@@ -76,6 +76,12 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     if (m_enable_fault_model)
         fault_model = p.fault_model;
 
+    m_fast_mode = p.fast_mode;
+    m_fast_mode_threshold = p.fast_mode_threshold;
+
+    m_regional_congestion = p.regional_congestion;
+    m_express_link_distance = p.express_link_distance;
+
     m_vnet_type.resize(m_virtual_networks);
 
     for (int i = 0 ; i < m_virtual_networks ; i++) {
@@ -121,6 +127,19 @@ GarnetNetwork::init()
     assert(m_topology_ptr != NULL);
     m_topology_ptr->createLinks(this);
 
+    // The SerDes units split and merge flits based on their position in
+    // the packet, which aggregated flits do not follow
+    if (m_fast_mode) {
+        for (auto *bridge : m_networkbridges) {
+            if (bridge->serDesEnabled()) {
+                warn("%s: fast mode is not supported with SerDes units, "
+                     "disabling it.\n", name());
+                m_fast_mode = false;
+                break;
+            }
+        }
+    }
+
     // Initialize topology specific parameters
     if (getNumRows() > 0) {
         // Only for Mesh topology
@@ -401,6 +420,12 @@ GarnetNetwork::regStats()
             statistics::oneline)
         ;
 
+    m_packets_aggregated
+        .init(m_virtual_networks)
+        .name(name() + ".packets_aggregated")
+        .flags(statistics::total | statistics::nozero | statistics::oneline)
+        ;
+
     m_packet_network_latency
         .init(m_virtual_networks)
         .name(name() + ".packet_network_latency")
@@ -416,6 +441,7 @@ GarnetNetwork::regStats()
     for (int i = 0; i < m_virtual_networks; i++) {
         m_packets_received.subname(i, csprintf("vnet-%i", i));
         m_packets_injected.subname(i, csprintf("vnet-%i", i));
+        m_packets_aggregated.subname(i, csprintf("vnet-%i", i));
         m_packet_network_latency.subname(i, csprintf("vnet-%i", i));
         m_packet_queueing_latency.subname(i, csprintf("vnet-%i", i));
     }
@@ -84,6 +84,16 @@ class GarnetNetwork : public Network
     bool isFaultModelEnabled() const { return m_enable_fault_model; }
     FaultModel* fault_model;
 
+    // Fast mode: multi-flit packets travel as aggregated flits while
+    // their injection VCs and path are not congested
+    bool isFastMode() const { return m_fast_mode; }
+    double getFastModeThreshold() const { return m_fast_mode_threshold; }
+
+    // Adaptive routing: also weigh the congestion at the next router
+    bool isRegionalCongestion() const { return m_regional_congestion; }
+    // Hops spanned by express links in a mesh (0 if there are none)
+    int getExpressLinkDistance() const { return m_express_link_distance; }
+
 
     // Internal configuration
     bool isVNetOrdered(int vnet) const { return m_ordered[vnet]; }
@@ -93,6 +103,12 @@ class GarnetNetwork : public Network
         return m_vnet_type[vnet];
     }
     int getNumRouters();
+    Router *
+    getRouter(int id)
+    {
+        assert(id < m_routers.size());
+        return m_routers[id];
+    }
     int get_router_id(int ni, int vnet);
 
 
@@ -133,8 +149,23 @@ class GarnetNetwork : public Network
         m_packet_queueing_latency[vnet] += latency;
     }
 
-    void increment_injected_flits(int vnet) { m_flits_injected[vnet]++; }
-    void increment_received_flits(int vnet) { m_flits_received[vnet]++; }
+    void
+    increment_aggregated_packets(int vnet)
+    {
+        m_packets_aggregated[vnet]++;
+    }
+
+    void
+    increment_injected_flits(int vnet, int num_flits = 1)
+    {
+        m_flits_injected[vnet] += num_flits;
+    }
+
+    void
+    increment_received_flits(int vnet, int num_flits = 1)
+    {
+        m_flits_received[vnet] += num_flits;
+    }
 
     void
     increment_flit_network_latency(Tick latency, int vnet)
@@ -167,10 +198,15 @@ class GarnetNetwork : public Network
     uint32_t m_buffers_per_data_vc;
     int m_routing_algorithm;
     bool m_enable_fault_model;
+    bool m_fast_mode;
+    double m_fast_mode_threshold;
+    bool m_regional_congestion;
+    int m_express_link_distance;
 
     // Statistical variables
     statistics::Vector m_packets_received;
     statistics::Vector m_packets_injected;
+    statistics::Vector m_packets_aggregated;
     statistics::Vector m_packet_network_latency;
     statistics::Vector m_packet_queueing_latency;
 
@@ -46,12 +46,36 @@ class GarnetNetwork(RubyNetwork):
     vcs_per_vnet = Param.UInt32(4, "virtual channels per virtual network")
     buffers_per_data_vc = Param.UInt32(4, "buffers per data virtual channel")
     buffers_per_ctrl_vc = Param.UInt32(1, "buffers per ctrl virtual channel")
-    routing_algorithm = Param.Int(0, "0: Weight-based Table, 1: XY, 2: Custom")
+    routing_algorithm = Param.Int(
+        0,
+        "0: Weight-based Table, 1: XY, 2: Custom, "
+        "3: Adaptive West-first, 4: Adaptive Odd-even",
+    )
+    regional_congestion = Param.Bool(
+        False,
+        "adaptive routing also considers the congestion at the "
+        "downstream router instead of only the local output ports",
+    )
+    express_link_distance = Param.UInt32(
+        0, "hops spanned by express links in a mesh (0: no express links)"
+    )
     enable_fault_model = Param.Bool(False, "enable network fault model")
     fault_model = Param.FaultModel(NULL, "network fault model")
     garnet_deadlock_threshold = Param.UInt32(
         50000, "network-level deadlock threshold"
     )
+    fast_mode = Param.Bool(
+        False,
+        "send multi-flit packets as aggregated flits, each standing for "
+        "as many flits as a VC has buffers and occupying each link for "
+        "their duration",
+    )
+    fast_mode_threshold = Param.Float(
+        0.5,
+        "fraction of busy VCs of a vnet, at the injection port or at a "
+        "router on the path, above which an NI falls back to per-flit "
+        "packets in fast mode",
+    )
 
 
 class GarnetNetworkInterface(ClockedObject):
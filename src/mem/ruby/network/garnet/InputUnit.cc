@@ -113,8 +113,9 @@ InputUnit::wakeup()
         int vnet = vc/m_vc_per_vnet;
         // number of writes same as reads
         // any flit that is written will be read only once
-        m_num_buffer_writes[vnet]++;
-        m_num_buffer_reads[vnet]++;
+        // an aggregated flit stands for all the flits of its packet
+        m_num_buffer_writes[vnet] += t_flit->get_agg_flits();
+        m_num_buffer_reads[vnet] += t_flit->get_agg_flits();
 
         Cycles pipe_stages = m_router->get_pipe_stages();
         if (pipe_stages == 1) {
@@ -142,11 +143,13 @@ InputUnit::wakeup()
 // Send a credit back to upstream router for this VC.
 // Called by SwitchAllocator when the flit in this VC wins the Switch.
 void
-InputUnit::increment_credit(int in_vc, bool free_signal, Tick curTime)
+InputUnit::increment_credit(int in_vc, bool free_signal, Tick curTime,
+                            int num_credits)
 {
-    DPRINTF(RubyNetwork, "Router[%d]: Sending a credit vc:%d free:%d to %s\n",
-    m_router->get_id(), in_vc, free_signal, m_credit_link->name());
-    Credit *t_credit = new Credit(in_vc, free_signal, curTime);
+    DPRINTF(RubyNetwork, "Router[%d]: Sending %d credits vc:%d free:%d to "
+            "%s\n", m_router->get_id(), num_credits, in_vc, free_signal,
+            m_credit_link->name());
+    Credit *t_credit = new Credit(in_vc, free_signal, curTime, num_credits);
     creditQueue.insert(t_credit);
     m_credit_link->scheduleEventAbsolute(m_router->clockEdge(Cycles(1)));
 }
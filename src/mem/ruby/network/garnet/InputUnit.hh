@@ -105,7 +105,8 @@ class InputUnit : public Consumer
         return virtualChannels[invc].get_enqueue_time();
     }
 
-    void increment_credit(int in_vc, bool free_signal, Tick curTime);
+    void increment_credit(int in_vc, bool free_signal, Tick curTime,
+                          int num_credits = 1);
 
     inline flit*
     peekTopFlit(int vc)
@@ -63,6 +63,7 @@ class NetworkBridge: public CreditLink
     ~NetworkBridge();
 
     void initBridge(NetworkBridge *coBrid, bool cdc_en, bool serdes_en);
+    bool serDesEnabled() const { return enSerDes; }
 
     void wakeup();
     void neutralize(int vc, int eCredit);
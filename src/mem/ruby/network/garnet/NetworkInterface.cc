@@ -32,13 +32,16 @@
 
 #include "mem/ruby/network/garnet/NetworkInterface.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
 #include "base/cast.hh"
+#include "base/intmath.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/network/garnet/Credit.hh"
+#include "mem/ruby/network/garnet/Router.hh"
 #include "mem/ruby/network/garnet/flitBuffer.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 
@@ -155,26 +158,42 @@ NetworkInterface::incrementStats(flit *t_flit)
 {
     int vnet = t_flit->get_vnet();
 
+    // An aggregated flit stands for num_flits flits of its packet, which
+    // would have arrived one cycle after the other. Account for each of
+    // them as if it had been received on its own.
+    int num_flits = t_flit->get_agg_flits();
+    Tick last_arrival =
+        t_flit->get_dequeue_time() + cyclesToTicks(Cycles(num_flits - 1));
+
     // Latency
-    m_net_ptr->increment_received_flits(vnet);
+    m_net_ptr->increment_received_flits(vnet, num_flits);
     Tick network_delay =
         t_flit->get_dequeue_time() -
         t_flit->get_enqueue_time() - cyclesToTicks(Cycles(1));
     Tick src_queueing_delay = t_flit->get_src_delay();
-    Tick dest_queueing_delay = (curTick() - t_flit->get_dequeue_time());
-    Tick queueing_delay = src_queueing_delay + dest_queueing_delay;
+    // Only the last flit can wait for the protocol buffer
+    Tick dest_queueing_delay =
+        curTick() > last_arrival ? curTick() - last_arrival : 0;
 
-    m_net_ptr->increment_flit_network_latency(network_delay, vnet);
-    m_net_ptr->increment_flit_queueing_latency(queueing_delay, vnet);
+    m_net_ptr->increment_flit_network_latency(network_delay * num_flits +
+        cyclesToTicks(Cycles(num_flits * (num_flits - 1) / 2)), vnet);
+    m_net_ptr->increment_flit_queueing_latency(
+        src_queueing_delay * num_flits + dest_queueing_delay, vnet);
 
     if (t_flit->get_type() == TAIL_ || t_flit->get_type() == HEAD_TAIL_) {
+        // The packet is received with its last flit
+        Tick tail_network_delay =
+            network_delay + cyclesToTicks(Cycles(num_flits - 1));
         m_net_ptr->increment_received_packets(vnet);
-        m_net_ptr->increment_packet_network_latency(network_delay, vnet);
-        m_net_ptr->increment_packet_queueing_latency(queueing_delay, vnet);
+        m_net_ptr->increment_packet_network_latency(tail_network_delay,
+                                                    vnet);
+        m_net_ptr->increment_packet_queueing_latency(
+            src_queueing_delay + dest_queueing_delay, vnet);
     }
 
     // Hops
-    m_net_ptr->increment_total_hops(t_flit->get_route().hops_traversed);
+    m_net_ptr->increment_total_hops(
+        t_flit->get_route().hops_traversed * num_flits);
 }
 
 /*
@@ -242,14 +261,16 @@ NetworkInterface::wakeup()
                 t_flit->get_type() == HEAD_TAIL_) {
                 if (!iPort->messageEnqueuedThisCycle &&
                     outNode_ptr[vnet]->areNSlotsAvailable(1, curTime)) {
-                    // Space is available. Enqueue to protocol buffer.
+                    // Space is available. Enqueue to protocol buffer,
+                    // after the tail of an aggregated packet.
                     outNode_ptr[vnet]->enqueue(t_flit->get_msg_ptr(), curTime,
-                                               cyclesToTicks(Cycles(1)));
+                        cyclesToTicks(Cycles(t_flit->get_agg_flits())));
 
                     // Simply send a credit back since we are not buffering
                     // this flit in the NI
                     Credit *cFlit = new Credit(t_flit->get_vc(),
-                                               true, curTick());
+                                               true, curTick(),
+                                               t_flit->get_agg_flits());
                     iPort->sendCredit(cFlit);
                     // Update stats and delete flit pointer
                     incrementStats(t_flit);
@@ -268,7 +289,8 @@ NetworkInterface::wakeup()
             } else {
                 // Non-tail flit. Send back a credit but not VC free signal.
                 Credit *cFlit = new Credit(t_flit->get_vc(), false,
-                                               curTick());
+                                               curTick(),
+                                               t_flit->get_agg_flits());
                 // Simply send a credit back since we are not buffering
                 // this flit in the NI
                 iPort->sendCredit(cFlit);
@@ -286,7 +308,8 @@ NetworkInterface::wakeup()
         CreditLink *inCreditLink = oPort->inCreditLink();
         if (inCreditLink->isReady(curTick())) {
             Credit *t_credit = (Credit*) inCreditLink->consumeLink();
-            outVcState[t_credit->get_vc()].increment_credit();
+            outVcState[t_credit->get_vc()].increment_credit(
+                t_credit->get_num_credits());
             if (t_credit->is_free_signal()) {
                 outVcState[t_credit->get_vc()].setState(IDLE_,
                     curTick());
@@ -332,12 +355,14 @@ NetworkInterface::checkStallQueue()
                 if (outNode_ptr[vnet]->areNSlotsAvailable(1,
                     curTime)) {
                     outNode_ptr[vnet]->enqueue(stallFlit->get_msg_ptr(),
-                        curTime, cyclesToTicks(Cycles(1)));
+                        curTime,
+                        cyclesToTicks(Cycles(stallFlit->get_agg_flits())));
 
                     // Send back a credit with free signal now that the
                     // VC is no longer stalled.
                     Credit *cFlit = new Credit(stallFlit->get_vc(), true,
-                                                   curTick());
+                                                   curTick(),
+                                                   stallFlit->get_agg_flits());
                     iPort->sendCredit(cFlit);
 
                     // Update Stats
@@ -437,14 +462,30 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
         m_net_ptr->increment_injected_packets(vnet);
         m_net_ptr->update_traffic_distribution(route);
         int packet_id = m_net_ptr->getNextPacketID();
-        for (int i = 0; i < num_flits; i++) {
-            m_net_ptr->increment_injected_flits(vnet);
+
+        // In fast mode, a packet travels as aggregated flits that stand
+        // for as many flits as a VC has buffers, and hold each link for
+        // as many cycles, unless its path is congested and arbitration
+        // matters
+        int agg_flits = 1;
+        if (num_flits > 1 && m_net_ptr->isFastMode() &&
+            !fastModeCongested(route)) {
+            agg_flits = outVcState[vc].get_max_credit_count();
+        }
+        int packet_flits = divCeil(num_flits, agg_flits);
+        if (packet_flits < num_flits)
+            m_net_ptr->increment_aggregated_packets(vnet);
+
+        m_net_ptr->increment_injected_flits(vnet, num_flits);
+        for (int i = 0; i < packet_flits; i++) {
             flit *fl = new flit(packet_id,
-                i, vc, vnet, route, num_flits, new_msg_ptr,
+                i, vc, vnet, route, packet_flits, new_msg_ptr,
                 m_net_ptr->MessageSizeType_to_int(
                 net_msg_ptr->getMessageSize()),
                 oPort->bitWidth(), curTick());
 
+            fl->set_agg_flits(std::min(agg_flits,
+                                       num_flits - i * agg_flits));
             fl->set_src_delay(curTick() - msg_ptr->getTime());
             niOutVcs[vc].insert(fl);
         }
@@ -455,6 +496,51 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
     return true ;
 }
 
+// Whether too many VCs of the vnet are busy for fast mode, at the
+// injection port or at a router on the path of the packet
+bool
+NetworkInterface::fastModeCongested(const RouteInfo &route)
+{
+    int vnet = route.vnet;
+    double threshold = m_net_ptr->getFastModeThreshold();
+
+    int busy_vcs = 0;
+    for (int i = 0; i < m_vc_per_vnet; i++) {
+        if (!outVcState[(vnet*m_vc_per_vnet) + i].isInState(IDLE_,
+                                                           curTick())) {
+            busy_vcs++;
+        }
+    }
+    if (busy_vcs > threshold * m_vc_per_vnet)
+        return true;
+
+    if (m_net_ptr->getRoutingAlgorithm() == XY_) {
+        // The path is known: X first, then Y
+        int num_cols = m_net_ptr->getNumCols();
+        int x = route.src_router % num_cols;
+        int y = route.src_router / num_cols;
+        int dest_x = route.dest_router % num_cols;
+        int dest_y = route.dest_router / num_cols;
+        while (true) {
+            Router *router = m_net_ptr->getRouter(y * num_cols + x);
+            if (router->is_congested(vnet, threshold))
+                return true;
+            if (x != dest_x)
+                x += (dest_x > x) ? 1 : -1;
+            else if (y != dest_y)
+                y += (dest_y > y) ? 1 : -1;
+            else
+                return false;
+        }
+    }
+
+    // Otherwise, the routers through which it enters and leaves
+    return m_net_ptr->getRouter(route.src_router)->is_congested(vnet,
+                                                               threshold) ||
+        m_net_ptr->getRouter(route.dest_router)->is_congested(vnet,
+                                                             threshold);
+}
+
 // Looking for a free output vc
 int
 NetworkInterface::calculateVC(int vnet)
@@ -483,6 +569,10 @@ NetworkInterface::calculateVC(int vnet)
 void
 NetworkInterface::scheduleOutputPort(OutputPort *oPort)
 {
+   // the port is still sending an aggregated flit
+   if (curTick() < oPort->busyUntil())
+       return;
+
    int vc = oPort->vcRoundRobin();
 
    for (int i = 0; i < niOutVcs.size(); i++) {
@@ -493,8 +583,11 @@ NetworkInterface::scheduleOutputPort(OutputPort *oPort)
        int t_vnet = get_vnet(vc);
        if (oPort->isVnetSupported(t_vnet)) {
            // model buffer backpressure
+           // an aggregated flit needs a buffer for every flit it
+           // stands for
            if (niOutVcs[vc].isReady(curTick()) &&
-               outVcState[vc].has_credit()) {
+               outVcState[vc].has_credit(
+                   niOutVcs[vc].peekTopFlit()->get_agg_flits())) {
 
                bool is_candidate_vc = true;
                int vc_base = t_vnet * m_vc_per_vnet;
@@ -518,14 +611,17 @@ NetworkInterface::scheduleOutputPort(OutputPort *oPort)
                // Update the round robin arbiter
                oPort->vcRoundRobin(vc);
 
-               outVcState[vc].decrement_credit();
-
                // Just removing the top flit
                flit *t_flit = niOutVcs[vc].getTopFlit();
+               outVcState[vc].decrement_credit(t_flit->get_agg_flits());
                t_flit->set_time(clockEdge(Cycles(1)));
 
                // Scheduling the flit
                scheduleFlit(t_flit);
+               if (t_flit->get_agg_flits() > 1) {
+                   oPort->busyUntil(
+                       clockEdge(Cycles(t_flit->get_agg_flits())));
+               }
 
                if (t_flit->get_type() == TAIL_ ||
                   t_flit->get_type() == HEAD_TAIL_) {
@@ -174,6 +174,17 @@ class NetworkInterface : public ClockedObject, public Consumer
               _vcRoundRobin = vc;
           }
 
+          // Tick until which the port is serializing an aggregated flit
+          Tick busyUntil()
+          {
+              return _busyUntil;
+          }
+
+          void busyUntil(Tick when)
+          {
+              _busyUntil = when;
+          }
+
 
       private:
           std::vector<int> _vnets;
@@ -183,6 +194,7 @@ class NetworkInterface : public ClockedObject, public Consumer
           CreditLink *_inCreditLink;
 
           int _vcRoundRobin; // For round robin scheduling
+          Tick _busyUntil = 0;
 
           int _routerID;
           uint32_t _bitWidth;
@@ -296,6 +308,7 @@ class NetworkInterface : public ClockedObject, public Consumer
     void checkStallQueue();
     bool flitisizeMessage(MsgPtr msg_ptr, int vnet);
     int calculateVC(int vnet);
+    bool fastModeCongested(const RouteInfo &route);
 
 
     void scheduleOutputPort(OutputPort *oPort);
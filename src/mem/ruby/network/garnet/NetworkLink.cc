@@ -100,8 +100,9 @@ NetworkLink::wakeup()
         t_flit->set_time(clockEdge(m_latency));
         linkBuffer.insert(t_flit);
         link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
-        m_link_utilized++;
-        m_vc_load[t_flit->get_vc()]++;
+        // an aggregated flit keeps the link busy for all its flits
+        m_link_utilized += t_flit->get_agg_flits();
+        m_vc_load[t_flit->get_vc()] += t_flit->get_agg_flits();
     }
 
     if (!link_srcQueue->isEmpty()) {
@@ -64,16 +64,16 @@ OutVcState::OutVcState(int id, GarnetNetwork *network_ptr,
 }
 
 void
-OutVcState::increment_credit()
+OutVcState::increment_credit(int num_credits)
 {
-    m_credit_count++;
+    m_credit_count += num_credits;
     assert(m_credit_count <= m_max_credit_count);
 }
 
 void
-OutVcState::decrement_credit()
+OutVcState::decrement_credit(int num_credits)
 {
-    m_credit_count--;
+    m_credit_count -= num_credits;
     assert(m_credit_count >= 0);
 }
 
@@ -49,9 +49,14 @@ class OutVcState
     OutVcState(int id, GarnetNetwork *network_ptr, uint32_t consumerVcs);
 
     int get_credit_count()          { return m_credit_count; }
-    inline bool has_credit()       { return (m_credit_count > 0); }
-    void increment_credit();
-    void decrement_credit();
+    int get_max_credit_count()      { return m_max_credit_count; }
+    inline bool
+    has_credit(int num_credits = 1)
+    {
+        return (m_credit_count >= num_credits);
+    }
+    void increment_credit(int num_credits = 1);
+    void decrement_credit(int num_credits = 1);
 
     inline bool
     isInState(VC_state_type state, Tick request_time)
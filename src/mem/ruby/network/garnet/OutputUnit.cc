@@ -59,7 +59,7 @@ OutputUnit::OutputUnit(int id, PortDirection direction, Router *router,
 }
 
 void
-OutputUnit::decrement_credit(int out_vc)
+OutputUnit::decrement_credit(int out_vc, int num_credits)
 {
     DPRINTF(RubyNetwork, "Router %d OutputUnit %s decrementing credit:%d for "
             "outvc %d at time: %lld for %s\n", m_router->get_id(),
@@ -67,11 +67,11 @@ OutputUnit::decrement_credit(int out_vc)
             outVcState[out_vc].get_credit_count(),
             out_vc, m_router->curCycle(), m_credit_link->name());
 
-    outVcState[out_vc].decrement_credit();
+    outVcState[out_vc].decrement_credit(num_credits);
 }
 
 void
-OutputUnit::increment_credit(int out_vc)
+OutputUnit::increment_credit(int out_vc, int num_credits)
 {
     DPRINTF(RubyNetwork, "Router %d OutputUnit %s incrementing credit:%d for "
             "outvc %d at time: %lld from:%s\n", m_router->get_id(),
@@ -79,17 +79,17 @@ OutputUnit::increment_credit(int out_vc)
             outVcState[out_vc].get_credit_count(),
             out_vc, m_router->curCycle(), m_credit_link->name());
 
-    outVcState[out_vc].increment_credit();
+    outVcState[out_vc].increment_credit(num_credits);
 }
 
 // Check if the output VC (i.e., input VC at next router)
 // has free credits (i..e, buffer slots).
 // This is tracked by OutVcState
 bool
-OutputUnit::has_credit(int out_vc)
+OutputUnit::has_credit(int out_vc, int num_credits)
 {
     assert(outVcState[out_vc].isInState(ACTIVE_, curTick()));
-    return outVcState[out_vc].has_credit();
+    return outVcState[out_vc].has_credit(num_credits);
 }
 
 
@@ -106,6 +106,37 @@ OutputUnit::has_free_vc(int vnet)
     return false;
 }
 
+// Number of output VCs of the vnet held by a packet
+int
+OutputUnit::get_busy_vcs(int vnet)
+{
+    int busy_vcs = 0;
+    int vc_base = vnet*m_vc_per_vnet;
+    for (int vc = vc_base; vc < vc_base + m_vc_per_vnet; vc++) {
+        if (!is_vc_idle(vc, curTick()))
+            busy_vcs++;
+    }
+
+    return busy_vcs;
+}
+
+// Congestion estimate of the output port used by adaptive routing:
+// the buffers still free at the downstream router for this vnet, plus
+// one for every VC that can be allocated right away.
+int
+OutputUnit::get_free_credits(int vnet)
+{
+    int free_credits = 0;
+    int vc_base = vnet*m_vc_per_vnet;
+    for (int vc = vc_base; vc < vc_base + m_vc_per_vnet; vc++) {
+        free_credits += outVcState[vc].get_credit_count();
+        if (is_vc_idle(vc, curTick()))
+            free_credits++;
+    }
+
+    return free_credits;
+}
+
 // Assign a free output VC to the winner of Switch Allocation
 int
 OutputUnit::select_free_vc(int vnet)
@@ -134,7 +165,7 @@ OutputUnit::wakeup()
 {
     if (m_credit_link->isReady(curTick())) {
         Credit *t_credit = (Credit*) m_credit_link->consumeLink();
-        increment_credit(t_credit->get_vc());
+        increment_credit(t_credit->get_vc(), t_credit->get_num_credits());
 
         if (t_credit->is_free_signal())
             set_vc_state(IDLE_, t_credit->get_vc(), curTick());
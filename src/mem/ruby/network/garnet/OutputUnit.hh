@@ -64,10 +64,12 @@ class OutputUnit : public Consumer
     void wakeup();
     flitBuffer* getOutQueue();
     void print(std::ostream& out) const {};
-    void decrement_credit(int out_vc);
-    void increment_credit(int out_vc);
-    bool has_credit(int out_vc);
+    void decrement_credit(int out_vc, int num_credits = 1);
+    void increment_credit(int out_vc, int num_credits = 1);
+    bool has_credit(int out_vc, int num_credits = 1);
     bool has_free_vc(int vnet);
+    int get_busy_vcs(int vnet);
+    int get_free_credits(int vnet);
     int select_free_vc(int vnet);
 
     inline PortDirection get_direction() { return m_direction; }
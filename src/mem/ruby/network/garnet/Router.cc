@@ -170,6 +170,21 @@ Router::grant_switch(int inport, flit *t_flit)
     crossbarSwitch.update_sw_winner(inport, t_flit);
 }
 
+// Whether more than the threshold fraction of the output VCs of the vnet
+// are held by packets, over all the output ports of the router
+bool
+Router::is_congested(int vnet, double threshold)
+{
+    int busy_vcs = 0;
+    int num_vcs = 0;
+    for (auto &output_unit : m_output_unit) {
+        busy_vcs += output_unit->get_busy_vcs(vnet);
+        num_vcs += output_unit->getVcsPerVnet();
+    }
+
+    return busy_vcs > threshold * num_vcs;
+}
+
 void
 Router::schedule_wakeup(Cycles time)
 {
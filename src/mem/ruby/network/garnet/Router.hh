@@ -117,8 +117,10 @@ class Router : public BasicRouter, public Consumer
     PortDirection getInportDirection(int inport);
 
     int route_compute(RouteInfo route, int inport, PortDirection direction);
+    RoutingUnit &getRoutingUnit() { return routingUnit; }
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
+    bool is_congested(int vnet, double threshold);
 
     std::string getPortDirectionName(PortDirection direction);
     void printFaultVector(std::ostream& out);
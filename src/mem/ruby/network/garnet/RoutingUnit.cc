@@ -34,6 +34,7 @@
 #include "base/compiler.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/garnet/InputUnit.hh"
+#include "mem/ruby/network/garnet/OutputUnit.hh"
 #include "mem/ruby/network/garnet/Router.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 
@@ -193,6 +194,10 @@ RoutingUnit::outportCompute(RouteInfo route, int inport,
         // any custom algorithm
         case CUSTOM_: outport =
             outportComputeCustom(route, inport, inport_dirn); break;
+        case WEST_FIRST_: outport =
+            outportComputeWestFirst(route, inport, inport_dirn); break;
+        case ODD_EVEN_: outport =
+            outportComputeOddEven(route, inport, inport_dirn); break;
         default: outport =
             lookupRoutingTable(route.vnet, route.net_dest); break;
     }
@@ -260,6 +265,191 @@ RoutingUnit::outportComputeXY(RouteInfo route,
     return m_outports_dirn2idx[outport_dirn];
 }
 
+int
+RoutingUnit::outportIndex(PortDirection outport_dirn) const
+{
+    auto it = m_outports_dirn2idx.find(outport_dirn);
+    return (it == m_outports_dirn2idx.end()) ? -1 : it->second;
+}
+
+// Add the outport in direction dirn to the adaptive routing candidates.
+// Express links (named e.g. "EastExpress") span express_link_distance
+// routers in the same dimension, so they are also productive once the
+// packet has at least that many hops left in the dimension.
+// step is the difference of router ids between neighbors in dirn.
+void
+RoutingUnit::addMeshCandidate(std::vector<MeshCandidate> &candidates,
+                              PortDirection dirn, int hops, int step,
+                              bool allow_express)
+{
+    int my_id = m_router->get_id();
+    int express_dist = m_router->get_net_ptr()->getExpressLinkDistance();
+    PortDirection express_dirn = dirn + "Express";
+
+    if (allow_express && express_dist > 0 && hops >= express_dist &&
+        outportIndex(express_dirn) != -1) {
+        candidates.push_back({express_dirn, my_id + step * express_dist});
+    }
+
+    assert(outportIndex(dirn) != -1);
+    candidates.push_back({dirn, my_id + step});
+}
+
+// Pick the least congested candidate, measured by the credits left at
+// the downstream input port. With regional congestion, the credits of
+// the downstream router's outport in the same direction are added so
+// that a hot spot one hop away is also avoided.
+// Ordered vnets always take the first candidate to keep messages in
+// order.
+int
+RoutingUnit::selectAdaptiveOutport(
+    const std::vector<MeshCandidate> &candidates, RouteInfo route)
+{
+    assert(!candidates.empty());
+    GarnetNetwork *net_ptr = m_router->get_net_ptr();
+
+    if (net_ptr->isVNetOrdered(route.vnet))
+        return m_outports_dirn2idx[candidates.front().dirn];
+
+    int best_outport = -1;
+    int best_credits = -1;
+    for (const auto &candidate : candidates) {
+        int outport = m_outports_dirn2idx[candidate.dirn];
+        int credits =
+            m_router->getOutputUnit(outport)->get_free_credits(route.vnet);
+
+        if (net_ptr->isRegionalCongestion() &&
+            candidate.neighbor != route.dest_router) {
+            Router *neighbor = net_ptr->getRouter(candidate.neighbor);
+            int next_outport =
+                neighbor->getRoutingUnit().outportIndex(candidate.dirn);
+            if (next_outport != -1) {
+                credits += neighbor->getOutputUnit(next_outport)->
+                    get_free_credits(route.vnet);
+            }
+        }
+
+        if (credits > best_credits) {
+            best_credits = credits;
+            best_outport = outport;
+        }
+    }
+
+    DPRINTF(RubyNetwork, "Router %d: adaptive route to router %d via "
+            "outport %d (%d credits)\n", m_router->get_id(),
+            route.dest_router, best_outport, best_credits);
+
+    return best_outport;
+}
+
+// West-first adaptive routing in a Mesh
+// Packets heading west go west first; all other packets adaptively
+// choose among their productive directions. Turns into the west are
+// never taken, which keeps the network deadlock free.
+int
+RoutingUnit::outportComputeWestFirst(RouteInfo route,
+                                     int inport,
+                                     PortDirection inport_dirn)
+{
+    [[maybe_unused]] int num_rows = m_router->get_net_ptr()->getNumRows();
+    int num_cols = m_router->get_net_ptr()->getNumCols();
+    assert(num_rows > 0 && num_cols > 0);
+
+    int my_id = m_router->get_id();
+    int my_x = my_id % num_cols;
+    int my_y = my_id / num_cols;
+
+    int dest_id = route.dest_router;
+    int dest_x = dest_id % num_cols;
+    int dest_y = dest_id / num_cols;
+
+    int x_hops = abs(dest_x - my_x);
+    int y_hops = abs(dest_y - my_y);
+
+    // already checked that in outportCompute() function
+    assert(!(x_hops == 0 && y_hops == 0));
+
+    std::vector<MeshCandidate> candidates;
+
+    if (dest_x < my_x) {
+        assert(inport_dirn == "Local" || inport_dirn == "East" ||
+               inport_dirn == "EastExpress");
+        addMeshCandidate(candidates, "West", x_hops, -1, true);
+    } else {
+        if (x_hops > 0)
+            addMeshCandidate(candidates, "East", x_hops, 1, true);
+        if (dest_y > my_y)
+            addMeshCandidate(candidates, "North", y_hops, num_cols, true);
+        else if (dest_y < my_y)
+            addMeshCandidate(candidates, "South", y_hops, -num_cols, true);
+    }
+
+    return selectAdaptiveOutport(candidates, route);
+}
+
+// Odd-even adaptive routing in a Mesh (Chiu, IEEE TPDS 2000)
+// East-to-north/south turns are not taken in even columns and
+// north/south-to-west turns are not taken in odd columns, which keeps
+// the network deadlock free while leaving more adaptivity than
+// west-first. An express link towards the east may only end in the
+// destination column if a turn is still allowed there.
+int
+RoutingUnit::outportComputeOddEven(RouteInfo route,
+                                   int inport,
+                                   PortDirection inport_dirn)
+{
+    [[maybe_unused]] int num_rows = m_router->get_net_ptr()->getNumRows();
+    int num_cols = m_router->get_net_ptr()->getNumCols();
+    assert(num_rows > 0 && num_cols > 0);
+
+    int my_id = m_router->get_id();
+    int my_x = my_id % num_cols;
+    int my_y = my_id / num_cols;
+
+    int src_x = route.src_router % num_cols;
+
+    int dest_id = route.dest_router;
+    int dest_x = dest_id % num_cols;
+    int dest_y = dest_id / num_cols;
+
+    int x_offset = dest_x - my_x;
+    int y_offset = dest_y - my_y;
+    int x_hops = abs(x_offset);
+    int y_hops = abs(y_offset);
+
+    // already checked that in outportCompute() function
+    assert(!(x_hops == 0 && y_hops == 0));
+
+    PortDirection y_dirn = (y_offset > 0) ? "North" : "South";
+    int y_step = (y_offset > 0) ? num_cols : -num_cols;
+    int express_dist = m_router->get_net_ptr()->getExpressLinkDistance();
+
+    std::vector<MeshCandidate> candidates;
+
+    if (x_offset == 0) {
+        addMeshCandidate(candidates, y_dirn, y_hops, y_step, true);
+    } else if (x_offset > 0) {
+        if (y_offset == 0) {
+            addMeshCandidate(candidates, "East", x_hops, 1, true);
+        } else {
+            if (my_x % 2 == 1 || my_x == src_x)
+                addMeshCandidate(candidates, y_dirn, y_hops, y_step, true);
+            if (dest_x % 2 == 1 || x_offset != 1) {
+                bool allow_express = x_hops > express_dist ||
+                                     dest_x % 2 == 1;
+                addMeshCandidate(candidates, "East", x_hops, 1,
+                                 allow_express);
+            }
+        }
+    } else {
+        addMeshCandidate(candidates, "West", x_hops, -1, true);
+        if (my_x % 2 == 0 && y_offset != 0)
+            addMeshCandidate(candidates, y_dirn, y_hops, y_step, true);
+    }
+
+    return selectAdaptiveOutport(candidates, route);
+}
+
 // Template for implementing custom routing algorithm
 // using port directions. (Example adaptive)
 int
@@ -73,6 +73,17 @@ class RoutingUnit
                          int inport,
                          PortDirection inport_dirn);
 
+    // Adaptive routing for Mesh (with optional express links)
+    int outportComputeWestFirst(RouteInfo route,
+                                int inport,
+                                PortDirection inport_dirn);
+    int outportComputeOddEven(RouteInfo route,
+                              int inport,
+                              PortDirection inport_dirn);
+
+    // Outport index for a direction, or -1 if there is no such port
+    int outportIndex(PortDirection outport_dirn) const;
+
     // Custom Routing Algorithm using Port Directions
     int outportComputeCustom(RouteInfo route,
                              int inport,
@@ -84,6 +95,20 @@ class RoutingUnit
 
 
   private:
+    // A productive outport considered by adaptive routing
+    struct MeshCandidate
+    {
+        PortDirection dirn;
+        // id of the router at the other end of the link
+        int neighbor;
+    };
+
+    void addMeshCandidate(std::vector<MeshCandidate> &candidates,
+                          PortDirection dirn, int hops, int step,
+                          bool allow_express);
+    int selectAdaptiveOutport(const std::vector<MeshCandidate> &candidates,
+                              RouteInfo route);
+
     Router *m_router;
 
     // Routing Table
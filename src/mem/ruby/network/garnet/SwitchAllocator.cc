@@ -66,6 +66,7 @@ SwitchAllocator::init()
     m_round_robin_invc.resize(m_num_inports);
     m_port_requests.resize(m_num_inports);
     m_vc_winners.resize(m_num_inports);
+    m_outport_busy_until.assign(m_num_outports, 0);
 
     for (int i = 0; i < m_num_inports; i++) {
         m_round_robin_invc[i] = 0;
@@ -130,7 +131,10 @@ SwitchAllocator::arbitrate_inports()
                     send_allowed(inport, invc, outport, outvc);
 
                 if (make_request) {
-                    m_input_arbiter_activity++;
+                    // an aggregated flit stands for all the flits of
+                    // its packet
+                    m_input_arbiter_activity +=
+                        input_unit->peekTopFlit(invc)->get_agg_flits();
                     m_port_requests[inport] = outport;
                     m_vc_winners[inport] = invc;
 
@@ -213,13 +217,22 @@ SwitchAllocator::arbitrate_outports()
                 // (This was updated in VC by vc_allocate, but not in flit)
                 t_flit->set_vc(outvc);
 
-                // decrement credit in outvc
-                output_unit->decrement_credit(outvc);
+                // decrement credit in outvc, one for every flit an
+                // aggregated flit stands for
+                output_unit->decrement_credit(outvc,
+                                              t_flit->get_agg_flits());
+
+                // an aggregated flit holds the output port for as many
+                // cycles as the packet has flits
+                if (t_flit->get_agg_flits() > 1) {
+                    m_outport_busy_until[outport] = m_router->clockEdge(
+                        Cycles(t_flit->get_agg_flits()));
+                }
 
                 // flit ready for Switch Traversal
                 t_flit->advance_stage(ST_, curTick());
                 m_router->grant_switch(inport, t_flit);
-                m_output_arbiter_activity++;
+                m_output_arbiter_activity += t_flit->get_agg_flits();
 
                 if ((t_flit->get_type() == TAIL_) ||
                     t_flit->get_type() == HEAD_TAIL_) {
@@ -232,11 +245,13 @@ SwitchAllocator::arbitrate_outports()
 
                     // Send a credit back
                     // along with the information that this VC is now idle
-                    input_unit->increment_credit(invc, true, curTick());
+                    input_unit->increment_credit(invc, true, curTick(),
+                                                 t_flit->get_agg_flits());
                 } else {
                     // Send a credit back
                     // but do not indicate that the VC is idle
-                    input_unit->increment_credit(invc, false, curTick());
+                    input_unit->increment_credit(invc, false, curTick(),
+                                                 t_flit->get_agg_flits());
                 }
 
                 // remove this request
@@ -272,12 +287,14 @@ SwitchAllocator::arbitrate_outports()
  *     output port (for HEAD/HEAD_TAIL),
  *  or
  * (2) if there is at least one credit (i.e., buffer slot)
- *     within the VC for BODY/TAIL flits of multi-flit packets.
+ *     within the VC for BODY/TAIL flits of multi-flit packets,
+ *     or one for every flit an aggregated flit stands for.
  * and
  * (3) pt-to-pt ordering is not violated in ordered vnets, i.e.,
  *     there should be no other flit in this input port
  *     within an ordered vnet
  *     that arrived before this flit and is requesting the same output port.
+ * (4) the output port is not serializing an aggregated flit (fast mode).
  */
 
 bool
@@ -291,6 +308,9 @@ SwitchAllocator::send_allowed(int inport, int invc, int outport, int outvc)
     bool has_outvc = (outvc != -1);
     bool has_credit = false;
 
+    if (curTick() < m_outport_busy_until[outport])
+        return false;
+
     auto output_unit = m_router->getOutputUnit(outport);
     if (!has_outvc) {
 
@@ -301,12 +321,15 @@ SwitchAllocator::send_allowed(int inport, int invc, int outport, int outvc)
 
             has_outvc = true;
 
-            // each VC has at least one buffer,
+            // each VC has at least one buffer, and an aggregated flit
+            // never stands for more flits than a VC has buffers,
             // so no need for additional credit check
             has_credit = true;
         }
     } else {
-        has_credit = output_unit->has_credit(outvc);
+        auto input_unit = m_router->getInputUnit(inport);
+        has_credit = output_unit->has_credit(outvc,
+            input_unit->peekTopFlit(invc)->get_agg_flits());
     }
 
     // cannot send if no outvc or no credit.
@@ -90,6 +90,8 @@ class SwitchAllocator : public Consumer
     std::vector<int> m_round_robin_inport;
     std::vector<int> m_port_requests;
     std::vector<int> m_vc_winners;
+    // Tick until which an output port is serializing an aggregated flit
+    std::vector<Tick> m_outport_busy_until;
 };
 
 } // namespace garnet
@@ -122,6 +122,8 @@ flit::print(std::ostream& out) const
     out << "Dest Router=" << m_route.dest_router << " ";
     out << "Set Time=" << m_time << " ";
     out << "Width=" << m_width<< " ";
+    if (m_agg_flits > 1)
+        out << "Aggregated=" << m_agg_flits << " ";
     out << "]";
 }
 
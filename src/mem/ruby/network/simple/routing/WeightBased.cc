@@ -44,6 +44,7 @@
 
 #include "base/random.hh"
 #include "mem/ruby/network/simple/Switch.hh"
+#include "mem/ruby/system/RubySystem.hh"
 
 namespace gem5
 {
@@ -94,8 +95,8 @@ WeightBased::route(const Message &msg,
                 }
                 // improve load distribution by randomizing order of links
                 // with the same queue length
-                link->m_order =
-                    (out_queue_length << 8) | random_mt.random(0, 0xff);
+                link->m_order = (out_queue_length << 8) |
+                    RubySystem::getRandom().random(0, 0xff);
             }
         }
         sortLinks();
@@ -382,7 +382,7 @@ AbstractController::recvTimingResp(PacketPtr pkt)
         return false;
     }
 
-    std::shared_ptr<MemoryMsg> msg = std::make_shared<MemoryMsg>(clockEdge());
+    std::shared_ptr<MemoryMsg> msg = makePooledMessage<MemoryMsg>(clockEdge());
     (*msg).m_addr = pkt->getAddr();
     (*msg).m_Sender = m_machineID;
 
@@ -395,7 +395,7 @@ AbstractController::recvTimingResp(PacketPtr pkt)
         (*msg).m_MessageSize = MessageSizeType_Response_Data;
 
         // Copy data from the packet
-        (*msg).m_DataBlk.setData(pkt->getPtr<uint8_t>(), 0,
+        (*msg).m_DataBlk.setData(pkt->getConstPtr<uint8_t>(), 0,
                                  RubySystem::getBlockSizeBytes());
     } else if (pkt->isWrite()) {
         (*msg).m_Type = MemoryRequestType_MEMORY_WB;
@@ -49,6 +49,7 @@
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/common/WriteMask.hh"
 #include "mem/ruby/protocol/MessageSizeType.hh"
+#include "mem/ruby/slicc_interface/MessagePool.hh"
 
 namespace gem5
 {
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
+#define __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Allocator that recycles the storage of messages. Messages are
+ * created with std::allocate_shared, so the object and its reference
+ * count live in a single allocation, and when the last reference to a
+ * message goes away (typically once it has been dequeued from its
+ * MessageBuffer and consumed), the storage is pushed on a free list
+ * instead of being returned to the heap. The next message of the same
+ * type reuses it.
+ *
+ * There is one pool per allocated type and host thread, and each slot
+ * remembers the pool it was allocated from. In parallel Ruby, messages
+ * allocated on one thread are often released on another one; their
+ * storage then goes back to the owning pool through a lock-free stack
+ * that the owner takes over as a whole when its own list runs dry, so
+ * the storage keeps circulating between the same threads. Each pool
+ * keeps at most MaxFreeSlots entries, and anything released beyond that
+ * goes back to the heap, so a burst of messages doesn't pin its peak
+ * memory for the rest of the simulation.
+ */
+template <class T>
+class MessagePoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    /** Most unused slots kept per type and host thread. */
+    static constexpr std::size_t MaxFreeSlots = 1024;
+
+    MessagePoolAllocator() = default;
+
+    template <class U>
+    MessagePoolAllocator(const MessagePoolAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        if (n != 1)
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+
+        Pool &pool = localPool();
+        if (!pool.head)
+            pool.takeRemote();
+        Slot *slot = pool.head;
+        if (slot) {
+            pool.head = slot->next;
+            pool.size--;
+        } else {
+            slot = new Slot;
+            slot->owner = &pool;
+        }
+        return reinterpret_cast<T *>(slot->storage);
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (n != 1) {
+            ::operator delete(p);
+            return;
+        }
+
+        Slot *slot = reinterpret_cast<Slot *>(
+            reinterpret_cast<unsigned char *>(p) - offsetof(Slot, storage));
+        Pool &pool = localPool();
+        if (slot->owner != &pool)
+            slot->owner->pushRemote(slot);
+        else
+            pool.push(slot);
+    }
+
+    /**
+     * @return The number of unused slots kept by the calling thread,
+     *         not counting those released by other threads and not
+     *         taken over yet.
+     */
+    static std::size_t freeSlots() { return localPool().size; }
+
+    /**
+     * Return the unused slots of the calling thread, including those
+     * released by other threads, to the heap.
+     */
+    static void
+    releaseFreeSlots()
+    {
+        Pool &pool = localPool();
+        pool.takeRemote();
+        while (Slot *slot = pool.head) {
+            pool.head = slot->next;
+            delete slot;
+        }
+        pool.size = 0;
+    }
+
+    template <class U>
+    bool operator==(const MessagePoolAllocator<U> &) const { return true; }
+    template <class U>
+    bool operator!=(const MessagePoolAllocator<U> &) const { return false; }
+
+  private:
+    struct Pool;
+
+    /** Storage for one object, linked in a free list when unused. */
+    struct Slot
+    {
+        Pool *owner;
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Pool
+    {
+        /** Free list, only accessed by the owning thread. */
+        Slot *head = nullptr;
+        std::size_t size = 0;
+
+        /** Slots released by other threads. */
+        std::atomic<Slot *> remote{nullptr};
+
+        void
+        push(Slot *slot)
+        {
+            if (size >= MaxFreeSlots) {
+                delete slot;
+                return;
+            }
+            slot->next = head;
+            head = slot;
+            size++;
+        }
+
+        void
+        pushRemote(Slot *slot)
+        {
+            Slot *old = remote.load(std::memory_order_relaxed);
+            do {
+                slot->next = old;
+            } while (!remote.compare_exchange_weak(old, slot,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed));
+        }
+
+        /** Move the slots released by other threads to the free list. */
+        void
+        takeRemote()
+        {
+            Slot *slot = remote.exchange(nullptr, std::memory_order_acquire);
+            while (slot) {
+                Slot *next = slot->next;
+                push(slot);
+                slot = next;
+            }
+        }
+    };
+
+    /**
+     * The pool of the calling thread. It is deliberately never freed, so
+     * other threads can still return slots to it once its thread has
+     * exited, and messages that outlive the thread (e.g., during static
+     * destruction) can still be released safely.
+     */
+    static Pool &
+    localPool()
+    {
+        static thread_local Pool *pool = new Pool;
+        return *pool;
+    }
+};
+
+/**
+ * Create a message whose storage comes from its type's pool.
+ *
+ * @param args Arguments forwarded to the message constructor.
+ * @return A shared pointer to the new message.
+ */
+template <class T, class... Args>
+std::shared_ptr<T>
+makePooledMessage(Args&&... args)
+{
+    return std::allocate_shared<T>(MessagePoolAllocator<T>(),
+                                   std::forward<Args>(args)...);
+}
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mem/ruby/slicc_interface/MessagePool.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+struct TestMessage
+{
+    explicit TestMessage(int v) : value(v) {}
+    int value;
+    char payload[48];
+};
+
+typedef MessagePoolAllocator<TestMessage> Allocator;
+
+} // anonymous namespace
+
+/** Released storage is reused by the next allocation. */
+TEST(MessagePoolTest, ReusesStorage)
+{
+    Allocator::releaseFreeSlots();
+    Allocator allocator;
+
+    TestMessage *slot = allocator.allocate(1);
+    allocator.deallocate(slot, 1);
+    EXPECT_EQ(1u, Allocator::freeSlots());
+
+    EXPECT_EQ(slot, allocator.allocate(1));
+    EXPECT_EQ(0u, Allocator::freeSlots());
+    allocator.deallocate(slot, 1);
+}
+
+/** The free list never grows past its bound. */
+TEST(MessagePoolTest, FreeListIsBounded)
+{
+    Allocator::releaseFreeSlots();
+    Allocator allocator;
+
+    std::vector<TestMessage *> slots;
+    for (std::size_t i = 0; i < 3 * Allocator::MaxFreeSlots; i++)
+        slots.push_back(allocator.allocate(1));
+    EXPECT_EQ(0u, Allocator::freeSlots());
+
+    for (auto slot : slots)
+        allocator.deallocate(slot, 1);
+    EXPECT_EQ(Allocator::MaxFreeSlots, Allocator::freeSlots());
+}
+
+/** Pooled messages are constructed in place and their storage reused. */
+TEST(MessagePoolTest, PooledMessages)
+{
+    std::vector<std::shared_ptr<TestMessage>> msgs;
+    for (int i = 0; i < 16; i++)
+        msgs.push_back(makePooledMessage<TestMessage>(i));
+    for (std::size_t i = 0; i < msgs.size(); i++)
+        EXPECT_EQ((int)i, msgs[i]->value);
+
+    const void *storage = msgs.back().get();
+    msgs.pop_back();
+    auto msg = makePooledMessage<TestMessage>(42);
+    EXPECT_EQ(storage, msg.get());
+    EXPECT_EQ(42, msg->value);
+}
+
+/** Storage released by another thread goes back to the owning pool. */
+TEST(MessagePoolTest, RemoteReleaseReturnsToOwner)
+{
+    Allocator::releaseFreeSlots();
+    Allocator allocator;
+
+    std::vector<TestMessage *> slots;
+    for (int i = 0; i < 8; i++)
+        slots.push_back(allocator.allocate(1));
+
+    std::thread([&] {
+        Allocator remote_allocator;
+        for (auto slot : slots)
+            remote_allocator.deallocate(slot, 1);
+        // The slots were not kept by the releasing thread
+        EXPECT_EQ(0u, Allocator::freeSlots());
+    }).join();
+
+    // The owner takes them over once its own list is empty
+    EXPECT_EQ(0u, Allocator::freeSlots());
+    std::vector<TestMessage *> reused;
+    for (std::size_t i = 0; i < slots.size(); i++)
+        reused.push_back(allocator.allocate(1));
+    std::sort(slots.begin(), slots.end());
+    std::sort(reused.begin(), reused.end());
+    EXPECT_EQ(slots, reused);
+
+    for (auto slot : reused)
+        allocator.deallocate(slot, 1);
+}
+
+/** Storage passed between threads in both directions keeps recycling. */
+TEST(MessagePoolTest, ConcurrentRemoteRelease)
+{
+    constexpr int NumSlots = 100000;
+    std::vector<std::atomic<TestMessage *>> to_other(NumSlots);
+    std::vector<std::atomic<TestMessage *>> to_main(NumSlots);
+    std::atomic<bool> main_done(false);
+
+    // Each thread allocates slots for the other one and releases the
+    // slots of the other thread while that one is still allocating
+    auto exchange = [](std::vector<std::atomic<TestMessage *>> &out,
+                       std::vector<std::atomic<TestMessage *>> &in,
+                       int sign) {
+        Allocator allocator;
+        for (int i = 0; i < NumSlots; i++) {
+            TestMessage *msg = allocator.allocate(1);
+            msg->value = sign * i;
+            out[i] = msg;
+            while (!(msg = in[i].exchange(nullptr)))
+                std::this_thread::yield();
+            EXPECT_EQ(-sign * i, msg->value);
+            allocator.deallocate(msg, 1);
+        }
+    };
+
+    std::thread other([&] {
+        exchange(to_main, to_other, -1);
+
+        // The pool of an exited thread is never freed, so hand its slots
+        // back to the heap once the main thread released them all
+        while (!main_done)
+            std::this_thread::yield();
+        Allocator::releaseFreeSlots();
+    });
+    exchange(to_other, to_main, 1);
+    main_done = true;
+    other.join();
+
+    EXPECT_LE(Allocator::freeSlots(), Allocator::MaxFreeSlots);
+    Allocator::releaseFreeSlots();
+}
@@ -101,6 +101,8 @@ CacheMemory::init()
 
     m_cache.resize(m_cache_num_sets,
                     std::vector<AbstractCacheEntry*>(m_cache_assoc, nullptr));
+    // Size the tag index for a full cache so it never grows
+    m_tag_index.reserve(m_cache_num_sets * m_cache_assoc);
     replacement_data.resize(m_cache_num_sets,
                                std::vector<ReplData>(m_cache_assoc, nullptr));
     // instantiate all the replacement_data here
@@ -41,10 +41,9 @@
 #ifndef __MEM_RUBY_STRUCTURES_PERFECTCACHEMEMORY_HH__
 #define __MEM_RUBY_STRUCTURES_PERFECTCACHEMEMORY_HH__
 
-#include <unordered_map>
-
 #include "base/compiler.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/FlatHashMap.hh"
 #include "mem/ruby/protocol/AccessPermission.hh"
 
 namespace gem5
@@ -107,7 +106,7 @@ class PerfectCacheMemory
     PerfectCacheMemory& operator=(const PerfectCacheMemory& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, PerfectCacheLineState<ENTRY> > m_map;
+    FlatHashMap<Addr, PerfectCacheLineState<ENTRY> > m_map;
 };
 
 template<class ENTRY>
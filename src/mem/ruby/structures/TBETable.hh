@@ -42,9 +42,9 @@
 #define __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 
 #include <iostream>
-#include <unordered_map>
 
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/FlatHashMap.hh"
 
 namespace gem5
 {
@@ -57,7 +57,7 @@ class TBETable
 {
   public:
     TBETable(int number_of_TBEs)
-        : m_number_of_TBEs(number_of_TBEs)
+        : m_map(number_of_TBEs), m_number_of_TBEs(number_of_TBEs)
     {
     }
 
@@ -82,7 +82,7 @@ class TBETable
     TBETable& operator=(const TBETable& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    FlatHashMap<Addr, ENTRY> m_map;
 
   private:
     int m_number_of_TBEs;
@@ -136,8 +136,10 @@ template<class ENTRY>
 inline ENTRY*
 TBETable<ENTRY>::lookup(Addr address)
 {
-  if (m_map.find(address) != m_map.end()) return &(m_map.find(address)->second);
-  return NULL;
+    auto it = m_map.find(address);
+    if (it != m_map.end())
+        return &(it->second);
+    return NULL;
 }
 
 
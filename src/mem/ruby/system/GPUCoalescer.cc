@@ -584,7 +584,7 @@ GPUCoalescer::hitCallback(CoalescedRequest* crequest,
         if (RubySystem::getCooldownEnabled())
             continue;
 
-        if (pkt->getPtr<uint8_t>()) {
+        if (pkt->getConstPtr<uint8_t>()) {
             switch(type) {
                 // Store and AtomicNoReturns follow the same path, as the
                 // data response is not needed.
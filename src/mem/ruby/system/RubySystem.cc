@@ -76,6 +76,25 @@ bool RubySystem::m_warmup_enabled = false;
 unsigned RubySystem::m_systems_to_warmup = 0;
 bool RubySystem::m_cooldown_enabled = false;
 
+Random &
+RubySystem::getRandom()
+{
+    if (!inParallelMode)
+        return random_mt;
+
+    // the generators are never freed, like the threads they belong to
+    static thread_local Random *random = nullptr;
+    if (!random) {
+        uint32_t index = 0;
+        while (index < numMainEventQueues &&
+               mainEventQueue[index] != curEventQueue()) {
+            index++;
+        }
+        random = new Random(index);
+    }
+    return *random;
+}
+
 RubySystem::RubySystem(const Params &p)
     : ClockedObject(p), m_access_backing_store(p.access_backing_store),
       m_cache_recorder(NULL)
@@ -504,10 +523,36 @@ RubySystem::resetStats()
     ClockedObject::resetStats();
 }
 
+RubySystem::ScopedFunctionalSync::ScopedFunctionalSync()
+    : callerQueue(inParallelMode ? curEventQueue() : nullptr)
+{
+    if (!callerQueue)
+        return;
+
+    // Release the caller's queue and then take all of them in the same
+    // order, so two threads doing functional accesses can't deadlock.
+    // Threads waiting on a barrier have released their queue.
+    callerQueue->unlock();
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->lock();
+}
+
+RubySystem::ScopedFunctionalSync::~ScopedFunctionalSync()
+{
+    if (!callerQueue)
+        return;
+
+    for (uint32_t i = numMainEventQueues; i > 0; --i)
+        mainEventQueue[i - 1]->unlock();
+    callerQueue->lock();
+}
+
 #ifndef PARTIAL_FUNC_READS
 bool
 RubySystem::functionalRead(PacketPtr pkt)
 {
+    ScopedFunctionalSync sync;
+
     Addr address(pkt->getAddr());
     Addr line_address = makeLineAddress(address);
 
@@ -624,6 +669,8 @@ RubySystem::functionalRead(PacketPtr pkt)
 bool
 RubySystem::functionalRead(PacketPtr pkt)
 {
+    ScopedFunctionalSync sync;
+
     Addr address(pkt->getAddr());
     Addr line_address = makeLineAddress(address);
 
@@ -725,6 +772,8 @@ RubySystem::functionalRead(PacketPtr pkt)
 bool
 RubySystem::functionalWrite(PacketPtr pkt)
 {
+    ScopedFunctionalSync sync;
+
     Addr addr(pkt->getAddr());
     Addr line_addr = makeLineAddress(addr);
     AccessPermission access_perm = AccessPermission_NotPresent;
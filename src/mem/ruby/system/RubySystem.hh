@@ -39,6 +39,7 @@
 
 #include "base/callback.hh"
 #include "base/output.hh"
+#include "base/random.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/profiler/Profiler.hh"
 #include "mem/ruby/slicc_interface/AbstractController.hh"
@@ -75,6 +76,14 @@ class RubySystem : public ClockedObject
     static bool getWarmupEnabled() { return m_warmup_enabled; }
     static bool getCooldownEnabled() { return m_cooldown_enabled; }
 
+    /**
+     * Random number generator for the random choices Ruby makes while
+     * simulating (message delays, adaptive routing). In parallel Ruby,
+     * each event queue thread draws from its own generator, seeded with
+     * the index of its queue, as threads can't share random_mt.
+     */
+    static Random &getRandom();
+
     memory::SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
@@ -132,6 +141,24 @@ class RubySystem : public ClockedObject
                                      uint64_t uncompressed_trace_size);
 
     void processRubyEvent();
+
+    /**
+     * Stop all event queues between two events for the duration of a
+     * functional access in parallel Ruby. The controllers and buffers
+     * a functional access walks belong to all the queues, so it has to
+     * take place at a global synchronization point.
+     */
+    class ScopedFunctionalSync
+    {
+      public:
+        ScopedFunctionalSync();
+        ~ScopedFunctionalSync();
+
+      private:
+        //! Queue of the calling thread, nullptr if not in parallel mode
+        EventQueue *callerQueue;
+    };
+
   private:
     // configuration parameters
     static bool m_randomization;
@@ -80,6 +80,7 @@ Sequencer::Sequencer(const Params &p)
     m_coreId = p.coreid; // for tracking the two CorePair sequencers
     assert(m_max_outstanding_requests > 0);
     assert(m_deadlock_threshold > 0);
+    m_RequestTable.reserve(m_max_outstanding_requests);
 
     m_unaddressedTransactionCnt = 0;
 
@@ -887,7 +888,7 @@ Sequencer::invL1()
         Addr addr = m_dataCache_ptr->getAddressAtIdx(i);
         // Evict Read-only data
         RubyRequestType request_type = RubyRequestType_REPLACEMENT;
-        std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+        std::shared_ptr<RubyRequest> msg = makePooledMessage<RubyRequest>(
             clockEdge(), addr, 0, 0,
             request_type, RubyAccessMode_Supervisor,
             nullptr);
@@ -1060,10 +1061,10 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     // requests do not
     std::shared_ptr<RubyRequest> msg;
     if (pkt->req->isMemMgmt()) {
-        msg = std::make_shared<RubyRequest>(clockEdge(),
-                                            pc, secondary_type,
-                                            RubyAccessMode_Supervisor, pkt,
-                                            proc_id, core_id);
+        msg = makePooledMessage<RubyRequest>(clockEdge(),
+                                              pc, secondary_type,
+                                              RubyAccessMode_Supervisor, pkt,
+                                              proc_id, core_id);
 
         DPRINTFR(ProtocolTrace, "%15s %3s %10s%20s %6s>%-6s %s\n",
                 curTick(), m_version, "Seq", "Begin", "", "",
@@ -1087,10 +1088,12 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
                     msg->m_tlbiTransactionUid);
         }
     } else {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
-                                            pkt->getSize(), pc, secondary_type,
-                                            RubyAccessMode_Supervisor, pkt,
-                                            PrefetchBit_No, proc_id, core_id);
+        msg = makePooledMessage<RubyRequest>(clockEdge(), pkt->getAddr(),
+                                              pkt->getSize(), pc,
+                                              secondary_type,
+                                              RubyAccessMode_Supervisor, pkt,
+                                              PrefetchBit_No, proc_id,
+                                              core_id);
 
         if (pkt->isAtomicOp() &&
             ((secondary_type == RubyRequestType_ATOMIC_RETURN) ||
@@ -1128,7 +1131,7 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
 
 template <class KEY, class VALUE>
 std::ostream &
-operator<<(std::ostream &out, const std::unordered_map<KEY, VALUE> &map)
+operator<<(std::ostream &out, const FlatHashMap<KEY, VALUE> &map)
 {
     for (const auto &table_entry : map) {
         out << "[ " << table_entry.first << " =";
@@ -150,7 +150,7 @@ VIPERCoalescer::issueRequest(CoalescedRequest* crequest)
                                                         tmpPkt->getAtomicOp());
             atomicOps.push_back(tmpAtomicOp);
         } else if (tmpPkt->isWrite()) {
-            dataBlock.setData(tmpPkt->getPtr<uint8_t>(),
+            dataBlock.setData(tmpPkt->getConstPtr<uint8_t>(),
                               tmpOffset, tmpSize);
         }
         for (int j = 0; j < tmpSize; j++) {
@@ -159,14 +159,14 @@ VIPERCoalescer::issueRequest(CoalescedRequest* crequest)
     }
     std::shared_ptr<RubyRequest> msg;
     if (pkt->isAtomicOp()) {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
+        msg = makePooledMessage<RubyRequest>(clockEdge(), pkt->getAddr(),
                               pkt->getSize(), pc, crequest->getRubyType(),
                               RubyAccessMode_Supervisor, pkt,
                               PrefetchBit_No, proc_id, 100,
                               blockSize, accessMask,
                               dataBlock, atomicOps, crequest->getSeqNum());
     } else {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
+        msg = makePooledMessage<RubyRequest>(clockEdge(), pkt->getAddr(),
                               pkt->getSize(), pc, crequest->getRubyType(),
                               RubyAccessMode_Supervisor, pkt,
                               PrefetchBit_No, proc_id, 100,
@@ -295,7 +295,7 @@ VIPERCoalescer::invTCP()
         Addr addr = m_dataCache_ptr->getAddressAtIdx(i);
         // Evict Read-only data
         RubyRequestType request_type = RubyRequestType_REPLACEMENT;
-        std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+        std::shared_ptr<RubyRequest> msg = makePooledMessage<RubyRequest>(
             clockEdge(), addr, 0, 0,
             request_type, RubyAccessMode_Supervisor,
             nullptr);
@@ -342,7 +342,7 @@ VIPERCoalescer::invTCC(PacketPtr pkt)
     Addr addr = pkt->req->getPaddr();
     RubyRequestType request_type = RubyRequestType_InvL2;
 
-    std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+    std::shared_ptr<RubyRequest> msg = makePooledMessage<RubyRequest>(
         clockEdge(), addr, 0, 0,
         request_type, RubyAccessMode_Supervisor,
         nullptr);
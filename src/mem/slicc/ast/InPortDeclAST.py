@@ -78,6 +78,7 @@ class InPortDeclAST(DeclAST):
 
         type = self.queue_type.type
         self.pairs["buffer_expr"] = self.var_expr
+        self.pairs["buffer_type"] = queue_type
         in_port = Var(
             self.symtab,
             self.ident,
@@ -54,11 +54,20 @@ from slicc.symbols import SymbolTable
 
 class SLICC(Grammar):
     def __init__(
-        self, filename, base_dir, verbose=False, traceback=False, **kwargs
+        self,
+        filename,
+        base_dir,
+        verbose=False,
+        traceback=False,
+        transition_table=False,
+        **kwargs,
     ):
         self.protocol = None
         self.traceback = traceback
         self.verbose = verbose
+        # Dispatch transitions through a [state][event] table of handlers
+        # instead of a switch statement
+        self.transition_table = transition_table
         self.symtab = SymbolTable(self)
         self.base_dir = base_dir
 
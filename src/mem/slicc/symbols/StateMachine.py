@@ -254,6 +254,27 @@ class StateMachine(Symbol):
                 in_msg_bufs[buf_name].append(port)
         return port_to_buf_map, in_msg_bufs, msg_bufs
 
+    # Maximum number of input buffers whose readiness a controller can
+    # track, see Consumer::markInputPending
+    max_tracked_inputs = 64
+
+    def getTrackedInputs(self, ident):
+        """Return the index under which each in_port message buffer
+        reports pending messages to the controller. Ports reading from
+        other structures (e.g., timer tables) are polled on every wakeup
+        and are not included."""
+        port_to_buf_map, in_msg_bufs, msg_bufs = self.getBufferMaps(ident)
+        tracked = {}
+        for port in self.in_ports:
+            buf_type = port.pairs["buffer_type"]
+            idx = port_to_buf_map[port]
+            if (
+                buf_type.ident == "MessageBuffer"
+                and idx < self.max_tracked_inputs
+            ):
+                tracked[port] = idx
+        return tracked
+
     def writeCodeFiles(self, path, includes):
         self.printControllerPython(path)
         self.printControllerHH(path)
@@ -438,6 +459,61 @@ TransitionResult doTransitionWorker(${ident}_Event event,
         code(
             """
                                     Addr addr);
+"""
+        )
+
+        if self.symtab.slicc.transition_table:
+            params = self.getTransitionHandlerParams()
+            cases = self.getTransitionCases(table=True)
+            code(
+                """
+
+// Handlers of the distinct transitions, dispatched by doTransitionWorker
+// through a [state][event] table of indices into s_transitionHandlers.
+// The next state and the resources of a transition are described by its
+// entry; doTransitionWorker sets the next state and checks the resources
+// before calling the handler, in the order of the switch backend.
+typedef TransitionResult (${c_ident}::*TransitionHandler)(
+    $params);
+struct TransitionCheck
+{
+    // Index of the resource, see transitionResourceAvailable()
+    int resource;
+    int slots;
+};
+// Next states of the transitions that do not name one
+static constexpr int TransitionKeepState = -1;
+static constexpr int TransitionGetNextState = -2;
+struct TransitionEntry
+{
+    TransitionHandler handler;
+    // Range of the transition's checks in s_transitionChecks
+    int firstCheck;
+    int lastCheck;
+    int nextState;
+};
+static const TransitionEntry s_transitionHandlers[];
+static const int
+    s_transitionTable[${ident}_State_NUM][${ident}_Event_NUM];
+"""
+            )
+            if self.getTransitionResources(cases):
+                code(
+                    """
+static const TransitionCheck s_transitionChecks[];
+bool transitionResourceAvailable(int resource, int slots, Addr addr);
+"""
+                )
+            for i in range(len(cases)):
+                code(
+                    """
+TransitionResult transitionHandler$i(
+    $params);
+"""
+                )
+
+        code(
+            """
 
 ${ident}_Event m_curTransitionEvent;
 ${ident}_State m_curTransitionNextState;
@@ -782,9 +858,14 @@ $c_ident::init()
             code("${{prefetcher.code}}.setController(this);")
 
         code()
+        tracked_inputs = self.getTrackedInputs(ident)
         for port in self.in_ports:
             # Set the queue consumers
-            code("${{port.code}}.setConsumer(this);")
+            if port in tracked_inputs:
+                idx = tracked_inputs[port]
+                code("${{port.code}}.setConsumer(this, $idx);")
+            else:
+                code("${{port.code}}.setConsumer(this);")
 
         # Initialize the transition profiling
         code()
@@ -1309,6 +1390,10 @@ $c_ident::${{action.ident}}(Addr addr)
 
 """
                 )
+
+        if self.symtab.slicc.transition_table:
+            self.printTransitionHandlers(code)
+
         for func in self.functions:
             code(func.generateCode())
 
@@ -1447,6 +1532,7 @@ $c_ident::functionalReadBuffers(PacketPtr& pkt, WriteMask &mask)
             code('#include "${{include_path}}"')
 
         port_to_buf_map, in_msg_bufs, msg_bufs = self.getBufferMaps(ident)
+        tracked_inputs = self.getTrackedInputs(ident)
 
         code(
             """
@@ -1492,6 +1578,10 @@ ${ident}_Controller::wakeup()
                 code('m_cur_in_port = ${{port.pairs["rank"]}};')
             else:
                 code("m_cur_in_port = 0;")
+            # Skip the buffers known to be empty
+            if port in tracked_inputs:
+                code("if (inputPending(${{tracked_inputs[port]}})) {")
+                code.indent()
             if port in port_to_buf_map:
                 code("try {")
                 code.indent()
@@ -1506,6 +1596,9 @@ ${ident}_Controller::wakeup()
             }
 """
                 )
+            if port in tracked_inputs:
+                code.dedent()
+                code("}")
             code.dedent()
             code("")
 
@@ -1533,6 +1626,21 @@ ${ident}_Controller::wakeup()
         }
 """
                 )
+
+        # Stop polling the buffers that were drained. They flag themselves
+        # as pending again as soon as they receive a new message.
+        cleared = set()
+        for port, idx in tracked_inputs.items():
+            if idx in cleared:
+                continue
+            cleared.add(idx)
+            buf_name = msg_bufs[idx]
+            code(
+                """
+        if (${{buf_name}}->isEmpty()) {
+            clearInputPending($idx);
+        }"""
+            )
         code(
             """
         break;
@@ -1546,6 +1654,279 @@ ${ident}_Controller::wakeup()
 
         code.write(path, f"{self.ident}_Wakeup.cc")
 
+    def getTransitionHandlerParams(self):
+        """Return the parameter list of the transition handlers"""
+
+        params = [f"{self.ident}_State& next_state"]
+        if self.TBEType != None:
+            params.append(f"{self.TBEType.c_ident}*& m_tbe_ptr")
+        if self.EntryType != None:
+            params.append(f"{self.EntryType.c_ident}*& m_cache_entry_ptr")
+        params.append("Addr addr")
+        return ",\n    ".join(params)
+
+    def getTransitionResources(self, cases):
+        """Return the resources checked by the transition table, in the
+        order of their indices. A resource is either ("buffer", code) for
+        a message buffer or ("request", ident) for a request type."""
+
+        resources = set()
+        for _, _, checks in cases:
+            resources.update(res for res, _ in checks)
+        return sorted(resources)
+
+    def printTransitionHandlers(self, code):
+        """Output the transition handlers and their dispatch tables. They
+        are emitted next to the actions so that the compiler can inline
+        the action sequence of each transition."""
+
+        ident = self.ident
+        c_ident = f"{self.ident}_Controller"
+        params = self.getTransitionHandlerParams()
+        cases = self.getTransitionCases(table=True)
+        resources = self.getTransitionResources(cases)
+
+        code(
+            """
+// Transition handlers
+"""
+        )
+        handlers = {}
+        entries = []
+        check_entries = []
+        for i, ((case, next_state, checks), transitions) in enumerate(
+            cases.items()
+        ):
+            for trans in transitions:
+                handlers[(trans.state.ident, trans.event.ident)] = i
+            code(
+                """
+TransitionResult
+$c_ident::transitionHandler$i(
+    $params)
+{
+"""
+            )
+            code.indent()
+            code("$case")
+            code.dedent()
+            code("}")
+            code()
+
+            first_check = len(check_entries)
+            for res, slots in checks:
+                check_entries.append((resources.index(res), slots, res[1]))
+            if next_state is None:
+                next_state = "TransitionKeepState"
+            elif next_state == "*":
+                next_state = "TransitionGetNextState"
+            else:
+                next_state = f"{ident}_State_{next_state}"
+            entries.append((first_check, len(check_entries), next_state))
+
+        if resources:
+            code(
+                """
+
+bool
+$c_ident::transitionResourceAvailable(int resource, int slots, Addr addr)
+{
+    switch (resource) {
+"""
+            )
+            for i, (kind, res) in enumerate(resources):
+                if kind == "buffer":
+                    code(
+                        """
+      case $i:
+        return $res.areNSlotsAvailable(slots, clockEdge());
+"""
+                    )
+                else:
+                    code(
+                        """
+      case $i:
+        return checkResourceAvailable(${ident}_RequestType_$res, addr);
+"""
+                    )
+            code(
+                """
+      default:
+        panic("Invalid transition resource %d\\n", resource);
+    }
+}
+
+const $c_ident::TransitionCheck
+$c_ident::s_transitionChecks[] = {
+"""
+            )
+            code.indent()
+            for i, slots, res in check_entries:
+                code("{$i, $slots}, // $res")
+            code.dedent()
+            code("};")
+
+        code(
+            """
+
+const $c_ident::TransitionEntry
+$c_ident::s_transitionHandlers[] = {
+"""
+        )
+        code.indent()
+        for i, (first_check, last_check, next_state) in enumerate(entries):
+            code(
+                "{&$c_ident::transitionHandler$i, "
+                "$first_check, $last_check, $next_state},"
+            )
+        code.dedent()
+        code("};")
+
+        num_states = len(self.states)
+        num_events = len(self.events)
+        code(
+            """
+
+static_assert(${ident}_State_NUM == $num_states);
+static_assert(${ident}_Event_NUM == $num_events);
+
+const int
+$c_ident::s_transitionTable[${ident}_State_NUM][${ident}_Event_NUM] = {
+"""
+        )
+        code.indent()
+        for state in self.states.values():
+            code("{ // ${{state.ident}}")
+            code.indent()
+            for event in self.events.values():
+                i = handlers.get((state.ident, event.ident), -1)
+                code("$i, // ${{event.ident}}")
+            code.dedent()
+            code("},")
+        code.dedent()
+        code("};")
+
+    def getTransitionCases(self, table=False):
+        """Return the code of each distinct transition, along with the
+        list of transitions that share it. For the transition table, the
+        next state and the resource checks are not part of the code; each
+        case is instead keyed by its code, its next state (None if the
+        state does not change, "*" if getNextState() picks it) and the
+        (resource, slots) checks it needs, in the order the switch
+        backend performs them."""
+
+        ident = self.ident
+
+        # This map will allow suppress generating duplicate code
+        cases = OrderedDict()
+
+        for trans in self.transitions:
+            case = self.symtab.codeFormatter()
+            next_state = None
+            # Only set next_state if it changes
+            if trans.state != trans.nextState:
+                if trans.nextState.isWildcard():
+                    # When * is encountered as an end state of a transition,
+                    # the next state is determined by calling the
+                    # machine-specific getNextState function. The next state
+                    # is determined before any actions of the transition
+                    # execute, and therefore the next state calculation cannot
+                    # depend on any of the transitionactions.
+                    next_state = "*"
+                    if not table:
+                        case(
+                            "next_state = getNextState(addr); "
+                            "m_curTransitionNextState = next_state;"
+                        )
+                else:
+                    ns_ident = trans.nextState.ident
+                    next_state = ns_ident
+                    if not table:
+                        case(
+                            "next_state = ${ident}_State_${ns_ident}; "
+                            "m_curTransitionNextState = next_state;"
+                        )
+
+            actions = trans.actions
+
+            # Check for resources
+            case_sorter = []
+            for key, val in trans.resources.items():
+                check = f"""
+if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
+    return TransitionResult_ResourceStall;
+"""
+                case_sorter.append((check, (("buffer", key.code), str(val))))
+
+            # Check all of the request_types for resource constraints
+            for request_type in trans.request_types:
+                check = """
+if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
+    return TransitionResult_ResourceStall;
+}}
+""".format(
+                    self.ident,
+                    request_type.ident,
+                )
+                case_sorter.append(
+                    (check, (("request", request_type.ident), "1"))
+                )
+
+            # Emit the code sequences in a sorted order.  This makes the
+            # output deterministic (without this the output order can vary
+            # since Map's keys() on a vector of pointers is not deterministic
+            case_sorter.sort()
+            # The transition table performs the same checks, in the same
+            # order, before calling the handler
+            checks = tuple(check for _, check in case_sorter)
+            if not table:
+                for c, _ in case_sorter:
+                    case("$c")
+
+            # Record access types for this transition
+            for request_type in trans.request_types:
+                case(
+                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
+                )
+
+            # Figure out if we stall
+            stall = False
+            for action in actions:
+                if action.ident == "z_stall":
+                    stall = True
+                    break
+
+            if stall:
+                case("return TransitionResult_ProtocolStall;")
+            else:
+                if self.TBEType != None and self.EntryType != None:
+                    for action in actions:
+                        case(
+                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
+                        )
+                elif self.TBEType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_tbe_ptr, addr);")
+                elif self.EntryType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
+                else:
+                    for action in actions:
+                        case("${{action.ident}}(addr);")
+                case("return TransitionResult_Valid;")
+
+            case = str(case)
+            if table:
+                case = (case, next_state, checks)
+
+            # Look to see if this transition code is unique.
+            if case not in cases:
+                cases[case] = []
+
+            cases[case].append(trans)
+
+        return cases
+
     def printCSwitch(self, path):
         """Output switch statement for transition table"""
 
@@ -1725,112 +2106,79 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
 {
     m_curTransitionEvent = event;
     m_curTransitionNextState = next_state;
-    switch(HASH_FUN(state, event)) {
 """
         )
 
-        # This map will allow suppress generating duplicate code
-        cases = OrderedDict()
-
-        for trans in self.transitions:
-            case_string = "{}_State_{}, {}_Event_{}".format(
-                self.ident,
-                trans.state.ident,
-                self.ident,
-                trans.event.ident,
+        if self.symtab.slicc.transition_table:
+            args = ["next_state"]
+            if self.TBEType != None:
+                args.append("m_tbe_ptr")
+            if self.EntryType != None:
+                args.append("m_cache_entry_ptr")
+            args.append("addr")
+            args = ", ".join(args)
+            cases = self.getTransitionCases(table=True)
+            code(
+                """
+    const int index = s_transitionTable[state][event];
+    if (index < 0) {
+        panic("Invalid transition\\n"
+              "%s time: %d addr: %#x event: %s state: %s\\n",
+              name(), curCycle(), addr, event, state);
+    }
+    const TransitionEntry &entry = s_transitionHandlers[index];
+"""
             )
-
-            case = self.symtab.codeFormatter()
-            # Only set next_state if it changes
-            if trans.state != trans.nextState:
-                if trans.nextState.isWildcard():
-                    # When * is encountered as an end state of a transition,
-                    # the next state is determined by calling the
-                    # machine-specific getNextState function. The next state
-                    # is determined before any actions of the transition
-                    # execute, and therefore the next state calculation cannot
-                    # depend on any of the transitionactions.
-                    case(
-                        "next_state = getNextState(addr); "
-                        "m_curTransitionNextState = next_state;"
-                    )
-                else:
-                    ns_ident = trans.nextState.ident
-                    case(
-                        "next_state = ${ident}_State_${ns_ident}; "
-                        "m_curTransitionNextState = next_state;"
-                    )
-
-            actions = trans.actions
-            request_types = trans.request_types
-
-            # Check for resources
-            case_sorter = []
-            res = trans.resources
-            for key, val in res.items():
-                val = f"""
-if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
-    return TransitionResult_ResourceStall;
+            if any(ns == "*" for _, ns, _ in cases):
+                code(
+                    """
+    if (entry.nextState == TransitionGetNextState) {
+        next_state = getNextState(addr);
+        m_curTransitionNextState = next_state;
+    } else if (entry.nextState != TransitionKeepState) {
+        next_state = ${ident}_State(entry.nextState);
+        m_curTransitionNextState = next_state;
+    }
 """
-                case_sorter.append(val)
-
-            # Check all of the request_types for resource constraints
-            for request_type in request_types:
-                val = """
-if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
-    return TransitionResult_ResourceStall;
-}}
-""".format(
-                    self.ident,
-                    request_type.ident,
-                )
-                case_sorter.append(val)
-
-            # Emit the code sequences in a sorted order.  This makes the
-            # output deterministic (without this the output order can vary
-            # since Map's keys() on a vector of pointers is not deterministic
-            for c in sorted(case_sorter):
-                case("$c")
-
-            # Record access types for this transition
-            for request_type in request_types:
-                case(
-                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
                 )
-
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
-                case("return TransitionResult_ProtocolStall;")
             else:
-                if self.TBEType != None and self.EntryType != None:
-                    for action in actions:
-                        case(
-                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
-                        )
-                elif self.TBEType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_tbe_ptr, addr);")
-                elif self.EntryType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
-                else:
-                    for action in actions:
-                        case("${{action.ident}}(addr);")
-                case("return TransitionResult_Valid;")
+                code(
+                    """
+    if (entry.nextState != TransitionKeepState) {
+        next_state = ${ident}_State(entry.nextState);
+        m_curTransitionNextState = next_state;
+    }
+"""
+                )
+            if self.getTransitionResources(cases):
+                code(
+                    """
+    for (int i = entry.firstCheck; i < entry.lastCheck; ++i) {
+        const TransitionCheck &check = s_transitionChecks[i];
+        if (!transitionResourceAvailable(check.resource, check.slots, addr))
+            return TransitionResult_ResourceStall;
+    }
+"""
+                )
+            code(
+                """
+    return (this->*entry.handler)($args);
+}
 
-            case = str(case)
+} // namespace ruby
+} // namespace gem5
+"""
+            )
+            code.write(path, f"{self.ident}_Transitions.cc")
+            return
 
-            # Look to see if this transition code is unique.
-            if case not in cases:
-                cases[case] = []
+        code(
+            """
+    switch(HASH_FUN(state, event)) {
+"""
+        )
 
-            cases[case].append(case_string)
+        cases = self.getTransitionCases()
 
         # Walk through all of the unique code blocks and spit out the
         # corresponding case statement elements
@@ -1838,7 +2186,10 @@ if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
             # Iterative over all the multiple transitions that share
             # the same code
             for trans in transitions:
-                code("  case HASH_FUN($trans):")
+                code(
+                    "  case HASH_FUN(${ident}_State_${{trans.state.ident}}, "
+                    "${ident}_Event_${{trans.event.ident}}):"
+                )
             code("    $case\n")
 
         code(
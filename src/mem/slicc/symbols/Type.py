@@ -326,7 +326,7 @@ $klass ${{self.c_ident}}$parent
 MsgPtr
 clone() const
 {
-     return std::shared_ptr<Message>(new ${{self.c_ident}}(*this));
+     return makePooledMessage<${{self.c_ident}}>(*this);
 }
 """
             )
@@ -42,6 +42,9 @@
 
 #include "mem/snoop_filter.hh"
 
+#include <algorithm>
+
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
@@ -52,15 +55,167 @@ namespace gem5
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
+SnoopFilter::SnoopFilter(const SnoopFilterParams &p)
+    : SimObject(p), linesize(p.system->cacheLineSize()),
+      granularity(p.region_size ? p.region_size : linesize),
+      lookupLatency(p.lookup_latency),
+      maxEntryCount(p.max_capacity / granularity), assoc(p.assoc),
+      useCount(0), stats(this)
+{
+    fatal_if(!isPowerOf2(granularity) || granularity < linesize,
+             "%s: region size %d must be a power of two and no smaller "
+             "than a cache line\n", name(), granularity);
+    // regions only bound the capacity, which an unbounded filter
+    // does not have
+    fatal_if(granularity != linesize && !assoc,
+             "%s: tracking regions requires a bounded snoop filter\n",
+             name());
+
+    if (assoc) {
+        fatal_if(maxEntryCount < assoc || maxEntryCount % assoc,
+                 "%s: capacity of %d entries is not a multiple of the "
+                 "associativity %d\n", name(), maxEntryCount, assoc);
+        sets.resize(maxEntryCount / assoc);
+    }
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::findItem(Addr line_addr, bool touch)
+{
+    if (!assoc) {
+        auto sf_it = cachedLocations.find(line_addr);
+        return sf_it != cachedLocations.end() ? &sf_it->second : nullptr;
+    }
+
+    auto region_it = regions.find(regionAddr(line_addr));
+    if (region_it == regions.end())
+        return nullptr;
+    Region& region = region_it->second;
+    SnoopItem& sf_item = region.lines[lineIndex(line_addr)];
+    if ((sf_item.requested | sf_item.holder).none())
+        return nullptr;
+    if (touch)
+        region.lastUsed = ++useCount;
+    return &sf_item;
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::allocateItem(Addr line_addr)
+{
+    if (!assoc)
+        return &cachedLocations[line_addr];
+
+    Addr region_addr = regionAddr(line_addr);
+    auto region_it = regions.find(region_addr);
+    if (region_it == regions.end()) {
+        auto& set = regionSet(region_addr);
+        if (set.size() >= assoc) {
+            // Pick the least recently used entry that can go
+            auto victim = set.end();
+            for (auto it = set.begin(); it != set.end(); ++it) {
+                if (isEvictable(**it) && (victim == set.end() ||
+                                          (*it)->lastUsed <
+                                          (*victim)->lastUsed))
+                    victim = it;
+            }
+            // The caller should have checked with canAllocate
+            panic_if(victim == set.end(), "%s: no SF entry to evict "
+                     "for %#x\n", name(), line_addr);
+
+            Addr victim_addr = (*victim)->addr;
+            DPRINTF(SnoopFilter, "%s:   Evicting SF entry %#x\n",
+                    __func__, victim_addr);
+            stats.evictions++;
+            // back-invalidate the holders of each line of the entry
+            const auto& lines = (*victim)->lines;
+            for (unsigned i = 0; i < lines.size(); i++) {
+                if (lines[i].holder.none())
+                    continue;
+                Addr addr = victim_addr + i * linesize;
+                evictions.push_back({addr & ~Addr(LineSecure),
+                                     bool(addr & LineSecure),
+                                     maskToPortList(lines[i].holder)});
+            }
+            *victim = set.back();
+            set.pop_back();
+            regions.erase(victim_addr);
+        }
+        region_it = regions.emplace(region_addr,
+            Region{region_addr,
+                   std::vector<SnoopItem>(granularity / linesize), 0,
+                   0}).first;
+        set.push_back(&region_it->second);
+    }
+
+    Region& region = region_it->second;
+    region.lastUsed = ++useCount;
+    return &region.lines[lineIndex(line_addr)];
+}
+
 void
-SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
+SnoopFilter::eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item)
 {
-    SnoopItem& sf_item = sf_it->second;
-    if ((sf_item.requested | sf_item.holder).none()) {
-        cachedLocations.erase(sf_it);
-        DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
-                __func__);
+    if ((sf_item->requested | sf_item->holder).any())
+        return;
+
+    DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n", __func__);
+    if (!assoc) {
+        cachedLocations.erase(line_addr);
+        return;
+    }
+
+    // free the entry once none of its lines is tracked
+    Addr region_addr = regionAddr(line_addr);
+    auto region_it = regions.find(region_addr);
+    assert(region_it != regions.end());
+    Region& region = region_it->second;
+    for (const auto& item : region.lines) {
+        if ((item.requested | item.holder).any())
+            return;
+    }
+    assert(region.pending == 0);
+    auto& set = regionSet(region_addr);
+    auto it = std::find(set.begin(), set.end(), &region);
+    assert(it != set.end());
+    *it = set.back();
+    set.pop_back();
+    regions.erase(region_it);
+}
+
+void
+SnoopFilter::setRequested(Addr line_addr, SnoopItem &sf_item,
+                          SnoopMask requested)
+{
+    if (assoc && sf_item.requested.none() != requested.none()) {
+        Region& region = regions.at(regionAddr(line_addr));
+        if (requested.any()) {
+            region.pending++;
+        } else {
+            assert(region.pending);
+            region.pending--;
+        }
     }
+    sf_item.requested = requested;
+}
+
+bool
+SnoopFilter::canAllocate(const Packet* cpkt,
+                         const ResponsePort& cpu_side_port) const
+{
+    // only a bounded filter is limited, and only if the request
+    // allocates a new item, see lookupRequest
+    if (!assoc || cpkt->req->isUncacheable() ||
+        !cpu_side_port.isSnooping() || !cpkt->fromCache())
+        return true;
+
+    Addr region_addr = regionAddr(lineAddr(cpkt));
+    if (regions.count(region_addr))
+        return true;
+
+    const auto& set = regionSet(region_addr);
+    return set.size() < assoc ||
+        std::any_of(set.begin(), set.end(),
+                    [this](const Region* r) { return isEvictable(*r); });
 }
 
 std::pair<SnoopFilter::SnoopList, Cycles>
@@ -78,8 +233,9 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         line_addr |= LineSecure;
     }
     SnoopMask req_port = portToMask(cpu_side_port);
-    reqLookupResult.it = cachedLocations.find(line_addr);
-    bool is_hit = (reqLookupResult.it != cachedLocations.end());
+    reqLookupResult.addr = line_addr;
+    reqLookupResult.item = findItem(line_addr, true);
+    bool is_hit = (reqLookupResult.item != nullptr);
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
@@ -89,10 +245,9 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     // If no hit in snoop filter create a new element and update iterator
     if (!is_hit) {
-        reqLookupResult.it =
-            cachedLocations.emplace(line_addr, SnoopItem()).first;
+        reqLookupResult.item = allocateItem(line_addr);
     }
-    SnoopItem& sf_item = reqLookupResult.it->second;
+    SnoopItem& sf_item = *reqLookupResult.item;
     SnoopMask interested = sf_item.holder | sf_item.requested;
 
     // Store unmodified value of snoop filter item in temp storage in
@@ -124,7 +279,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                      sf_item.requested, sf_item.holder);
 
             // Mark in-flight requests to distinguish later on
-            sf_item.requested |= req_port;
+            setRequested(line_addr, sf_item, sf_item.requested | req_port);
             DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                     __func__,  sf_item.requested, sf_item.holder);
         } else {
@@ -159,10 +314,10 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 void
 SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 {
-    if (reqLookupResult.it != cachedLocations.end()) {
+    if (reqLookupResult.item) {
         // since we rely on the caller, do a basic check to ensure
         // that finishRequest is being called following lookupRequest
-        assert(reqLookupResult.it->first == \
+        assert(reqLookupResult.addr == \
                 (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : \
                  (addr & ~(Addr(linesize - 1)))));
         if (will_retry) {
@@ -170,13 +325,16 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
             // Undo any changes made in lookupRequest to the snoop filter
             // entry if the request will come again. retryItem holds
             // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
+            setRequested(reqLookupResult.addr, *reqLookupResult.item,
+                         retry_item.requested);
+            reqLookupResult.item->holder = retry_item.holder;
 
             DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
                     __func__,  retry_item.requested, retry_item.holder);
         }
 
-        eraseIfNullEntry(reqLookupResult.it);
+        eraseIfNullEntry(reqLookupResult.addr, reqLookupResult.item);
+        reqLookupResult.item = nullptr;
     }
 }
 
@@ -191,11 +349,13 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = (sf_it != cachedLocations.end());
+    SnoopItem *sf_it = findItem(line_addr, true);
+    bool is_hit = (sf_it != nullptr);
 
-    panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
-             "snoop filter exceeded capacity of %d cache blocks\n",
+    // a bounded filter is at capacity when all its entries are in use
+    panic_if(!is_hit && (assoc ? numEntries() > maxEntryCount :
+                         numEntries() >= maxEntryCount),
+             "snoop filter exceeded capacity of %d entries\n",
              maxEntryCount);
 
     // If the snoop filter has no entry, simply return a NULL
@@ -204,7 +364,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (!is_hit)
         return snoopDown(lookupLatency);
 
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = *sf_it;
 
     SnoopMask interested = (sf_item.holder | sf_item.requested);
 
@@ -234,7 +394,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
         sf_item.holder = 0;
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     }
 
     return snoopSelected(maskToPortList(interested), lookupLatency);
@@ -264,7 +424,11 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem& sf_item = cachedLocations[line_addr];
+    SnoopItem *sf_it = findItem(line_addr);
+    // The destination should have had a request in
+    panic_if(!sf_it, "SF has no entry for %#x with the original request\n",
+             line_addr);
+    SnoopItem& sf_item = *sf_it;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -291,7 +455,7 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     assert(!cpkt->isWriteback());
     // @todo Deal with invalidating responses
     sf_item.holder |=  req_mask;
-    sf_item.requested &= ~req_mask;
+    setRequested(line_addr, sf_item, sf_item.requested & ~req_mask);
     assert((sf_item.requested | sf_item.holder).any());
     DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
             __func__, sf_item.requested, sf_item.holder);
@@ -311,8 +475,8 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = sf_it != cachedLocations.end();
+    SnoopItem *sf_it = findItem(line_addr);
+    bool is_hit = sf_it != nullptr;
 
     // Nothing to do if it is not a hit
     if (!is_hit)
@@ -322,7 +486,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     // Modified state, and we know that there are no other copies, or
     // they will all be invalidated imminently
     if (!cpkt->hasSharers()) {
-        SnoopItem& sf_item = sf_it->second;
+        SnoopItem& sf_item = *sf_it;
 
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
@@ -330,7 +494,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
 
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     }
 }
 
@@ -353,12 +517,12 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    if (sf_it == cachedLocations.end())
+    SnoopItem *sf_it = findItem(line_addr);
+    if (!sf_it)
         return;
 
     SnoopMask response_mask = portToMask(cpu_side_port);
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = *sf_it;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -368,7 +532,7 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
              "SF value %x.%x missing request bit\n",
              sf_item.requested, sf_item.holder);
 
-    sf_item.requested &= ~response_mask;
+    setRequested(line_addr, sf_item, sf_item.requested & ~response_mask);
     // Update the residency of the cache line.
 
     if (cpkt->req->isCacheMaintenance()) {
@@ -377,7 +541,7 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
         if (cpkt->isInvalidate()) {
             sf_item.holder &= ~response_mask;
         }
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     } else {
         // Any other response implies that a cache above will have the
         // block.
@@ -405,7 +569,10 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Number of entries evicted from a bounded snoop filter, "
+               "back-invalidating the holders of their lines.")
 {}
 
 void
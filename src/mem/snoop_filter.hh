@@ -46,6 +46,7 @@
 #include <bitset>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mem/packet.hh"
 #include "mem/port.hh"
@@ -85,6 +86,15 @@ namespace gem5
  *     upper cache dropped a line, making the snoop filter pessimistic for now
  * (4) ordering: there is no single point of order in the system.  Instead,
  *     requesting MSHRs track order between local requests and remote snoops
+ *
+ * By default the filter tracks any number of lines. It can instead be
+ * bounded to a set-associative structure of max_capacity, in which case
+ * allocating into a full set evicts an entry and the crossbar
+ * back-invalidates the holders of its lines. A bounded filter can also
+ * allocate its entries for coarse-grain regions, so that one tag covers
+ * several lines. The entry of a region holds the sharers of each of its
+ * lines, and is evicted, with all its lines back-invalidated, as a
+ * whole.
  */
 class SnoopFilter : public SimObject
 {
@@ -95,13 +105,21 @@ class SnoopFilter : public SimObject
 
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
-    SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
-        linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
-        maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
-        stats(this)
+    /**
+     * A line evicted from a capacity-bounded snoop filter. Its holders
+     * have to be back-invalidated, as the snoop filter no longer
+     * steers snoops to them.
+     */
+    struct Eviction
     {
-    }
+        /** Address of the cache line. */
+        Addr addr;
+        bool isSecure;
+        /** Ports that may hold the line. */
+        SnoopList holders;
+    };
+
+    SnoopFilter (const SnoopFilterParams &p);
 
     /**
      * Init a new snoop filter and tell it about all the cpu_sideports
@@ -142,6 +160,20 @@ class SnoopFilter : public SimObject
     std::pair<SnoopList, Cycles> lookupRequest(const Packet* cpkt,
                                         const ResponsePort& cpu_side_port);
 
+    /**
+     * Check if a request can be looked up without exceeding the
+     * capacity of a bounded filter. This is not the case if the
+     * request needs a new entry, and all the entries of its set track
+     * lines with outstanding requests. The request then has to retry
+     * once one of them completed.
+     *
+     * @param cpkt          Pointer to the request packet.
+     * @param cpu_side_port Response port where the request came from.
+     * @return True if lookupRequest can track the request.
+     */
+    bool canAllocate(const Packet* cpkt,
+                     const ResponsePort& cpu_side_port) const;
+
     /**
      * For an un-successful request, revert the change to the snoop
      * filter. Also take care of erasing any null entries. This method
@@ -200,6 +232,20 @@ class SnoopFilter : public SimObject
      */
     void updateResponse(const Packet *cpkt, const ResponsePort& cpu_side_port);
 
+    /**
+     * Take the lines evicted by the previous calls to lookupRequest.
+     * The caller is responsible for back-invalidating their holders.
+     *
+     * @return Evicted lines, oldest first.
+     */
+    std::vector<Eviction>
+    takeEvictions()
+    {
+        std::vector<Eviction> res;
+        res.swap(evictions);
+        return res;
+    }
+
     virtual void regStats();
 
   protected:
@@ -259,13 +305,118 @@ class SnoopFilter : public SimObject
   private:
 
     /**
-     * Removes snoop filter items which have no requestors and no holders.
+     * An entry of a capacity-bounded filter, covering a cache line or
+     * a region of lines, and tracking the sharers of each of them.
+     */
+    struct Region
+    {
+        /** Address of the region, tagged with LineSecure. */
+        Addr addr;
+        /** Sharers of each line of the region. */
+        std::vector<SnoopItem> lines;
+        /** Number of lines with an outstanding request. */
+        unsigned pending;
+        /** Recency of the region, for replacement. */
+        uint64_t lastUsed;
+    };
+
+    /**
+     * Address of the item tracking the line accessed by a packet.
+     * Secure lines are tagged with LineSecure.
+     */
+    Addr
+    lineAddr(const Packet *cpkt) const
+    {
+        Addr line_addr = cpkt->getAddr() & ~(linesize - 1);
+        return cpkt->isSecure() ? (line_addr | LineSecure) : line_addr;
+    }
+
+    /** Address of the region a (tagged) line address belongs to. */
+    Addr
+    regionAddr(Addr line_addr) const
+    {
+        return line_addr & ~((granularity - 1) & ~Addr(LineSecure));
+    }
+
+    /** Index of a (tagged) line in the items of its region. */
+    unsigned
+    lineIndex(Addr line_addr) const
+    {
+        return (line_addr & (granularity - 1) & ~Addr(LineSecure)) /
+            linesize;
+    }
+
+    /** Set of a bounded filter a (tagged) region address maps to. */
+    std::vector<Region*>&
+    regionSet(Addr region_addr)
+    {
+        return sets[(region_addr / granularity) % sets.size()];
+    }
+
+    const std::vector<Region*>&
+    regionSet(Addr region_addr) const
+    {
+        return sets[(region_addr / granularity) % sets.size()];
+    }
+
+    /**
+     * Find the item tracking a line.
+     *
+     * @param line_addr Line address, tagged with LineSecure.
+     * @param touch     Mark the entry covering the line as recently
+     *                  used, if the filter is bounded.
+     * @return The item, or nullptr if the line has no sharer and no
+     *         outstanding request.
+     */
+    SnoopItem *findItem(Addr line_addr, bool touch = false);
+
+    /**
+     * Allocate a new item for a line. If the filter is bounded and the
+     * line is not covered by an entry, allocate one, evicting the
+     * least recently used entry of the set if needed.
+     */
+    SnoopItem *allocateItem(Addr line_addr);
+
+    /**
+     * Removes snoop filter items which have no requestors and no
+     * holders, and the entry of a bounded filter once all its lines
+     * are.
+     */
+    void eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item);
+
+    /**
+     * Set the outstanding requests to a line, keeping track of the
+     * lines of the entries of a bounded filter that have some.
+     */
+    void setRequested(Addr line_addr, SnoopItem &sf_item,
+                      SnoopMask requested);
+
+    /**
+     * Check if an entry of a bounded filter can be evicted, which is
+     * the case if none of its lines has an outstanding request.
      */
-    void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
+    bool isEvictable(const Region& region) const
+    {
+        return region.pending == 0;
+    }
+
+    /** Number of entries in use, for capacity checking. */
+    size_t
+    numEntries() const
+    {
+        return assoc ? regions.size() : cachedLocations.size();
+    }
 
-    /** Simple hash set of cached addresses. */
+    /** Simple hash set of cached addresses, if the filter is unbounded. */
     SnoopFilterCache cachedLocations;
 
+    /**
+     * Entries of a bounded filter, indexed by their region address.
+     * They track their lines themselves, and cachedLocations is
+     * unused.
+     */
+    std::unordered_map<Addr, Region> regions;
+
     /**
      * A request lookup must be followed by a call to finishRequest to inform
      * the operation's success. If a retry is needed, however, all changes
@@ -274,27 +425,18 @@ class SnoopFilter : public SimObject
      */
     struct ReqLookupResult
     {
-        /** Iterator used to store the result from lookupRequest. */
-        SnoopFilterCache::iterator it;
+        /** Item used to store the result from lookupRequest. */
+        SnoopItem *item = nullptr;
+
+        /** Tagged address of the line of the item. */
+        Addr addr = 0;
 
         /**
          * Variable to temporarily store value of snoopfilter entry
          * in case finishRequest needs to undo changes made in lookupRequest
          * (because of crossbar retry)
          */
-        SnoopItem retryItem;
-
-        /**
-         * The constructor must be informed of the internal cache's end
-         * iterator, so do not allow the compiler to implictly define it.
-         *
-         * @param end_it Iterator to the end of the internal cache.
-         */
-        ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0}
-        {
-        }
-        ReqLookupResult() = delete;
+        SnoopItem retryItem{0, 0};
     } reqLookupResult;
 
     /** List of all attached snooping CPU-side ports. */
@@ -303,10 +445,25 @@ class SnoopFilter : public SimObject
     std::vector<PortID> localResponsePortIds;
     /** Cache line size. */
     const Addr linesize;
+    /** Bytes covered per entry, a cache line unless using regions. */
+    const Addr granularity;
     /** Latency for doing a lookup in the filter */
     const Cycles lookupLatency;
-    /** Max capacity in terms of cache blocks tracked, for sanity checking */
+    /**
+     * Max capacity in terms of cache blocks tracked, for sanity
+     * checking, or the actual capacity in entries if the filter is
+     * bounded
+     */
     const unsigned maxEntryCount;
+    /** Associativity of a bounded filter, 0 if it is unbounded. */
+    const unsigned assoc;
+
+    /** Entries resident in each set of a bounded filter. */
+    std::vector<std::vector<Region*>> sets;
+    /** Counter providing the recency of the entries. */
+    uint64_t useCount;
+    /** Evicted lines waiting to be back-invalidated. */
+    std::vector<Eviction> evictions;
 
     /**
      * Use the lower bits of the address to keep track of the line status
@@ -329,6 +486,8 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar evictions;
     } stats;
 };
 
@@ -164,6 +164,12 @@ class BaseXBar : public ClockedObject
          */
         void recvRetry();
 
+        /**
+         * Check if the layer waits for a retry from its destination
+         * port, after the port refused a packet.
+         */
+        bool isWaitingForPeer() const { return waitingForPeer != nullptr; }
+
       protected:
 
         /**
@@ -151,10 +151,15 @@ class LooppointSimulation:
         and restore Simpoint data.
     """
 
-    def __init__(self, start: LooppointRegionPC, end: LooppointRegionPC):
+    def __init__(
+        self,
+        start: LooppointRegionPC,
+        end: Optional[LooppointRegionPC] = None,
+    ):
         """
         :param start: The starting LooppointRegionPC.
-        :param end: The ending LoopppointRegionPC.
+        :param end: The ending LoopppointRegionPC. ``None`` if the region
+                    runs to the end of the workload.
         """
         self._start = start
         self._end = end
@@ -163,17 +168,18 @@ class LooppointSimulation:
         """Returns the starting LooppointRegionPC data structure."""
         return self._start
 
-    def get_end(self) -> LooppointRegionPC:
-        """Returns the ending LooppointRegionPC data structure."""
+    def get_end(self) -> Optional[LooppointRegionPC]:
+        """Returns the ending LooppointRegionPC data structure, or ``None``
+        if the region runs to the end of the workload."""
         return self._end
 
     def get_pc_count_pairs(self) -> List[PcCountPair]:
         """Returns the PC count pairs for the start and end
         LoopointRegionPCs."""
-        return [
-            self.get_start().get_pc_count_pair(),
-            self.get_end().get_pc_count_pair(),
-        ]
+        pairs = [self.get_start().get_pc_count_pair()]
+        if self.get_end() is not None:
+            pairs.append(self.get_end().get_pc_count_pair())
+        return pairs
 
     def update_relatives_counts(
         self, manager: PcCountTrackerManager, include_start: bool = False
@@ -185,15 +191,16 @@ class LooppointSimulation:
             # start of the simulation region
             self.get_start().update_relative_count(manager=manager)
 
-        self.get_end().update_relative_count(manager=manager)
+        if self.get_end() is not None:
+            self.get_end().update_relative_count(manager=manager)
 
     def to_json(self) -> Dict:
         """Returns this class in a JSON structure which can then be serialized
         and later be restored from."""
-        return {
-            "start": self.get_start().to_json(),
-            "end": self.get_end().to_json(),
-        }
+        to_return = {"start": self.get_start().to_json()}
+        if self.get_end() is not None:
+            to_return["end"] = self.get_end().to_json()
+        return to_return
 
 
 class LooppointRegion:
@@ -287,7 +294,7 @@ class Looppoint:
         if region_id not in self._regions:
             raise Exception(f"Region ID '{region_id}' cannot be found.")
 
-        to_remove = [rid for rid in self._regions if rid is not region_id]
+        to_remove = [rid for rid in self._regions if rid != region_id]
         for rid in to_remove:
             del self._regions[rid]
 
@@ -519,20 +526,19 @@ class LooppointJsonLoader(Looppoint):
                     relative=start_relative,
                 )
 
-                end_pc = int(json_contents[rid]["simulation"]["end"]["pc"])
-                end_globl = int(
-                    json_contents[rid]["simulation"]["end"]["global"]
-                )
-                end_relative = (
-                    int(json_contents[rid]["simulation"]["end"]["relative"])
-                    if "relative" in json_contents[rid]["simulation"]["end"]
-                    else None
-                )
-                end = LooppointRegionPC(
-                    pc=end_pc,
-                    globl=end_globl,
-                    relative=end_relative,
-                )
+                # The last region of a workload may have no end.
+                end = None
+                if "end" in json_contents[rid]["simulation"]:
+                    end_json = json_contents[rid]["simulation"]["end"]
+                    end = LooppointRegionPC(
+                        pc=int(end_json["pc"]),
+                        globl=int(end_json["global"]),
+                        relative=(
+                            int(end_json["relative"])
+                            if "relative" in end_json
+                            else None
+                        ),
+                    )
                 simulation = LooppointSimulation(start=start, end=end)
                 multiplier = float(json_contents[rid]["multiplier"])
                 warmup = None
@@ -554,3 +560,77 @@ class LooppointJsonLoader(Looppoint):
         super().__init__(regions=regions)
         if region_id:
             self.set_target_region_id(region_id=region_id)
+
+
+class LooppointMarkersLoader(Looppoint):
+    """This class will create a LoopPoint data structure from the region
+    markers written by a LoopPointProfilerManager and the SimPoint clustering
+    of its basic block vectors."""
+
+    def __init__(
+        self,
+        markers_file: Union[str, Path],
+        simpoints_file: Union[str, Path],
+        weights_file: Union[str, Path],
+        region_id: Optional[Union[str, int]] = None,
+    ) -> None:
+        """
+        :param markers_file: The region markers file written by the
+                             LoopPointProfilerManager.
+        :param simpoints_file: The SimPoint file of the chosen regions, with
+                               one "<region> <cluster>" pair per line.
+        :param weights_file: The SimPoint weights file, with one
+                             "<weight> <cluster>" pair per line.
+        :params region_id: If set, will only load the specified region data.
+                           Otherwise, all region info is loaded. Is used when
+                           restoring to a particular region.
+        """
+
+        markers = {}
+        with open(markers_file) as file:
+            for line in file:
+                if line.startswith("#") or not line.strip():
+                    continue
+                fields = line.split()
+                start = LooppointRegionPC(
+                    pc=int(fields[1], 16), globl=int(fields[2])
+                )
+                # The last region runs to the end of the workload and has
+                # no end marker.
+                end = None
+                if fields[3] != "-":
+                    end = LooppointRegionPC(
+                        pc=int(fields[3], 16), globl=int(fields[4])
+                    )
+                markers[int(fields[0])] = (start, end, int(fields[5]))
+        total_insts = sum(insts for _, _, insts in markers.values())
+
+        weights = {}
+        with open(weights_file) as file:
+            for line in file:
+                if line.strip():
+                    weight, cluster = line.split()
+                    weights[int(cluster)] = float(weight)
+
+        regions = {}
+        with open(simpoints_file) as file:
+            for line in file:
+                if not line.strip():
+                    continue
+                rid, cluster = (int(field) for field in line.split())
+                if rid not in markers:
+                    raise Exception(
+                        f"SimPoint region '{rid}' is not in the markers file."
+                    )
+                start, end, insts = markers[rid]
+                # The region stands for the instructions of its whole
+                # cluster.
+                multiplier = weights[cluster] * total_insts / insts
+                regions[rid] = LooppointRegion(
+                    simulation=LooppointSimulation(start=start, end=end),
+                    multiplier=multiplier,
+                )
+
+        super().__init__(regions=regions)
+        if region_id is not None:
+            self.set_target_region_id(region_id=region_id)
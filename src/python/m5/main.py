@@ -315,6 +315,16 @@ def parse_options():
         split=":",
         help="Ignore EXPR sim objects",
     )
+    option(
+        "--event-profile",
+        metavar="PERIOD",
+        type="int",
+        default=0,
+        help="Profile the host time spent servicing events, timing one in "
+        "PERIOD events on average. The profile is written to "
+        "event_profile.txt and event_profile.folded (for flamegraph.pl) "
+        "in the output directory on exit [Default: disabled]",
+    )
     option(
         "--remote-gdb-port",
         type="int",
@@ -575,6 +585,9 @@ def main():
     if not options.allow_remote_connections:
         m5.listenersLoopbackOnly()
 
+    if options.event_profile:
+        event.enableProfiling(options.event_profile)
+
     for when in options.debug_break:
         debug.schedBreak(int(when))
 
@@ -190,6 +190,29 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
 
+@_url_factory(["bin"])
+def _binaryFactory(fn, desc=True):
+    """Output stats in a compact, columnar binary format.
+
+    Every stat value is assigned a column the first time it is
+    dumped. Column names and descriptions are only stored once, and
+    each dump only stores the values that changed since the previous
+    dump. This makes the format well suited for periodic stat dumps
+    over long simulations. File names ending in .gz are compressed.
+
+    Use util/statsbin.py to read the resulting files.
+
+    Parameters:
+      * desc (bool): Output stat descriptions (default: True)
+
+    Example:
+      bin://stats.bin?desc=False
+
+    """
+
+    return _m5.stats.initBinary(fn, desc)
+
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -353,34 +376,83 @@ def prepare():
         stat.prepare()
 
     # New stats
-    _visit_stats(lambda g, s: s.prepare())
+    root = Root.getInstance()
+    if root:
+        _m5.stats.prepareGroup(root.getCCObject(), "", _dump_filter)
 
 
 def _dump_to_visitor(visitor, roots=None):
-    # New stats
-    def dump_group(group):
-        for stat in group.getStats():
-            stat.visit(visitor)
-        for n, g in group.getStatGroups().items():
-            visitor.beginGroup(n)
-            dump_group(g)
-            visitor.endGroup()
-
     if roots:
         # New stats from selected subroots.
         for root in roots:
             for p in root.path_list():
                 visitor.beginGroup(p)
-            dump_group(root)
+            _m5.stats.dumpGroup(
+                visitor,
+                root.getCCObject(),
+                ".".join(root.path_list()),
+                _dump_filter,
+                _dump_threads,
+            )
             for p in reversed(root.path_list()):
                 visitor.endGroup()
     else:
         # New stats starting from root.
-        dump_group(Root.getInstance())
+        _m5.stats.dumpGroup(
+            visitor,
+            Root.getInstance().getCCObject(),
+            "",
+            _dump_filter,
+            _dump_threads,
+        )
 
         # Legacy stats
         for stat in stats_list:
-            stat.visit(visitor)
+            if _dump_filter.matchStat(stat.name):
+                stat.visit(visitor)
+
+
+# Stat name filter applied when preparing and dumping stats.
+_dump_filter = _m5.stats.StatFilter([])
+# Maximum number of host threads used to format stat dumps.
+_dump_threads = 1
+
+
+def setDumpFilter(patterns=None):
+    """Restrict stat dumps to the stats matching a list of patterns
+
+    Patterns are matched against full stat names, one dot-separated
+    component at a time, and may contain shell-style wildcards. A
+    pattern naming a group selects all stats below it. Stats that
+    aren't selected are neither prepared nor evaluated when dumping,
+    which makes dumps of large systems considerably cheaper.
+
+    Passing None or an empty list selects all stats again. The filter
+    doesn't apply to the JSON output.
+
+    Example:
+      setDumpFilter(["simTicks", "system.cpu*.ipc", "system.l2"])
+
+    """
+
+    global _dump_filter
+    _dump_filter = _m5.stats.StatFilter(list(patterns) if patterns else [])
+
+
+def setDumpThreads(threads):
+    """Use up to threads host threads to format stat dumps
+
+    Independent stat groups are evaluated and formatted in parallel
+    and written in the same order as a serial dump. Outputs that can't
+    be formatted out of order (e.g., the binary output) are always
+    dumped serially.
+
+    """
+
+    global _dump_threads
+    if threads < 1:
+        fatal("The number of stat dump threads must be at least 1")
+    _dump_threads = threads
 
 
 lastDump = 0
@@ -110,6 +110,8 @@ pybind_init_event(py::module_ &m_native)
     m.def("setMaxTick", &set_max_tick, py::arg("tick"));
     m.def("getMaxTick", &get_max_tick, py::return_value_policy::copy);
     m.def("terminateEventQueueThreads", &terminateEventQueueThreads);
+    m.def("enableProfiling", &enableEventProfiling,
+          py::arg("sample_period"), py::arg("prefix") = "event_profile");
     m.def("exitSimLoop", &exitSimLoop);
     m.def("getEventQueue", []() { return curEventQueue(); },
           py::return_value_policy::reference);
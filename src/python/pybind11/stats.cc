@@ -42,6 +42,8 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/dump.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -116,6 +118,7 @@ pybind_init_stats(py::module_ &m_native)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
+        .def("initBinary", &statistics::initBinary)
         .def("registerPythonStatsHandlers",
              &statistics::registerPythonStatsHandlers)
         .def("schedStatEvent", &statistics::schedStatEvent)
@@ -126,6 +129,15 @@ pybind_init_stats(py::module_ &m_native)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
+        .def("prepareGroup", &statistics::prepareGroup)
+        .def("dumpGroup", &statistics::dumpGroup)
+        ;
+
+    py::class_<statistics::StatFilter>(m, "StatFilter")
+        .def(py::init<const std::vector<std::string> &>())
+        .def("empty", &statistics::StatFilter::empty)
+        .def("matchGroup", &statistics::StatFilter::matchGroup)
+        .def("matchStat", &statistics::StatFilter::matchStat)
         ;
 
     py::class_<statistics::Output>(m, "Output")
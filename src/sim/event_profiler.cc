@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profiler.hh"
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+double
+hostSeconds()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+} // anonymous namespace
+
+EventProfiler::EventProfiler(unsigned sample_period)
+    : samplePeriod(sample_period), untilSample(1), gap(1),
+      rngState(0x9e3779b97f4a7c15ULL), totalEvents(0), totalCycles(0),
+      startCycles(hostCycles()), startTime(hostSeconds())
+{
+    fatal_if(sample_period == 0, "Event profiler sample period must be "
+             "at least 1.\n");
+}
+
+unsigned
+EventProfiler::nextGap()
+{
+    if (samplePeriod == 1)
+        return 1;
+
+    // xorshift64, uniform in [1, 2 * period - 1] for a mean of period.
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return 1 + rngState % (2 * samplePeriod - 1);
+}
+
+void
+EventProfiler::sample(Event *event)
+{
+    // The event may deschedule or even delete itself when processed,
+    // so everything needed to identify it is captured up front.
+    std::string name = event->name();
+    const char *desc = event->description();
+    if (name.compare(0, 6, "Event_") == 0)
+        name = "";
+
+    const uint64_t start = hostCycles();
+    event->process();
+    const uint64_t cycles = hostCycles() - start;
+
+    std::string key = name;
+    key.push_back('\0');
+    key.append(desc);
+    auto it = entries.find(key);
+    if (it == entries.end())
+        it = entries.emplace(key, Entry{name, desc}).first;
+
+    it->second.events += gap;
+    it->second.cycles += cycles * gap;
+    totalEvents += gap;
+    totalCycles += cycles * gap;
+
+    gap = untilSample = nextGap();
+}
+
+void
+EventProfiler::merge(const EventProfiler &other)
+{
+    for (const auto &[key, entry] : other.entries) {
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            entries.emplace(key, entry);
+        } else {
+            it->second.events += entry.events;
+            it->second.cycles += entry.cycles;
+        }
+    }
+    totalEvents += other.totalEvents;
+    totalCycles += other.totalCycles;
+}
+
+double
+EventProfiler::cyclesPerSecond() const
+{
+    const double elapsed = hostSeconds() - startTime;
+    const uint64_t cycles = hostCycles() - startCycles;
+    return elapsed > 0 && cycles > 0 ? cycles / elapsed : 1e9;
+}
+
+void
+EventProfiler::dumpTable(std::ostream &os) const
+{
+    std::vector<const Entry *> sorted;
+    sorted.reserve(entries.size());
+    for (const auto &[key, entry] : entries)
+        sorted.push_back(&entry);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Entry *a, const Entry *b) {
+                  return a->cycles > b->cycles;
+              });
+
+    const double cps = cyclesPerSecond();
+    ccprintf(os, "# Event profile, 1 in %d events sampled\n", samplePeriod);
+    ccprintf(os, "# Estimated events: %d, host time: %.3fs\n",
+             totalEvents, totalCycles / cps);
+    ccprintf(os, "%7s %10s %14s %10s  %s\n",
+             "time%", "time(s)", "events", "ns/event", "event");
+    for (const auto *entry : sorted) {
+        const double secs = entry->cycles / cps;
+        ccprintf(os, "%6.2f%% %10.3f %14d %10.1f  %s (%s)\n",
+                 totalCycles ? 100.0 * entry->cycles / totalCycles : 0.0,
+                 secs, entry->events,
+                 entry->events ? 1e9 * secs / entry->events : 0.0,
+                 entry->name.empty() ? "<unnamed>" : entry->name,
+                 entry->desc);
+    }
+}
+
+void
+EventProfiler::dumpFolded(std::ostream &os) const
+{
+    const double ns_per_cycle = 1e9 / cyclesPerSecond();
+    for (const auto &[key, entry] : entries) {
+        std::string stack = entry.name;
+        std::replace(stack.begin(), stack.end(), '.', ';');
+        if (!stack.empty())
+            stack.push_back(';');
+        stack.append(entry.desc);
+        // Spaces separate the stack from the value in the folded format.
+        std::replace(stack.begin(), stack.end(), ' ', '_');
+
+        ccprintf(os, "%s %d\n", stack,
+                 static_cast<uint64_t>(entry.cycles * ns_per_cycle));
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILER_HH__
+#define __SIM_EVENT_PROFILER_HH__
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+#include "base/compiler.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Sampling profiler for the host cost of simulated events.
+ *
+ * When attached to an event queue, the profiler is handed every event
+ * the queue services. On average one in samplePeriod events is timed
+ * using a cheap host cycle counter (rdtsc where available) and its
+ * cost is attributed to the event's name and description. The
+ * distance between samples is randomized to avoid aliasing with
+ * periodic events, and every sample is weighted by the number of
+ * events it represents, so event counts and host time are unbiased
+ * estimates.
+ *
+ * Events that don't override Event::name() have per-instance names,
+ * these are aggregated by their description instead.
+ */
+class EventProfiler
+{
+  public:
+    /**
+     * @param sample_period Average number of events per sample. A
+     *                      period of 1 times every event.
+     */
+    explicit EventProfiler(unsigned sample_period);
+
+    /** Process an event, timing it if it has been selected. */
+    void
+    process(Event *event)
+    {
+        if (GEM5_LIKELY(--untilSample != 0)) {
+            event->process();
+        } else {
+            sample(event);
+        }
+    }
+
+    /** Add the samples of another profiler to this one. */
+    void merge(const EventProfiler &other);
+
+    /** Write a table of events sorted by estimated host time. */
+    void dumpTable(std::ostream &os) const;
+
+    /**
+     * Write the profile using the collapsed stack format understood
+     * by flamegraph.pl. Object names are split into one frame per
+     * level of the hierarchy and the value is the estimated host time
+     * in nanoseconds.
+     */
+    void dumpFolded(std::ostream &os) const;
+
+    /** Read the host cycle counter. */
+    static uint64_t
+    hostCycles()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+  private:
+    struct Entry
+    {
+        std::string name;
+        std::string desc;
+        /** Estimated number of events. */
+        uint64_t events = 0;
+        /** Estimated host cycles. */
+        uint64_t cycles = 0;
+    };
+
+    void sample(Event *event);
+
+    /** Draw the number of events until the next sample. */
+    unsigned nextGap();
+
+    /** Host cycles per second, calibrated since construction. */
+    double cyclesPerSecond() const;
+
+    const unsigned samplePeriod;
+
+    /** Events remaining until the next sample. */
+    unsigned untilSample;
+    /** Number of events the next sample represents. */
+    unsigned gap;
+    /** State of the sample gap generator. */
+    uint64_t rngState;
+
+    std::unordered_map<std::string, Entry> entries;
+    uint64_t totalEvents;
+    uint64_t totalCycles;
+
+    /** Calibration points for converting host cycles to time. */
+    const uint64_t startCycles;
+    const double startTime;
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILER_HH__
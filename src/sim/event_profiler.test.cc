@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "sim/event_profiler.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class NamedEvent : public Event
+{
+  public:
+    int processed = 0;
+    std::string _name;
+
+    NamedEvent(const std::string &name) : _name(name) {}
+
+    void process() override { processed++; }
+    const std::string name() const override { return _name; }
+    const char *description() const override { return "test event"; }
+};
+
+} // anonymous namespace
+
+/** Test that every event is processed regardless of sampling. */
+TEST(EventProfilerTest, ProcessAll)
+{
+    EventProfiler profiler(16);
+    NamedEvent event("system.cpu.tick");
+    for (int i = 0; i < 1000; ++i)
+        profiler.process(&event);
+    EXPECT_EQ(event.processed, 1000);
+}
+
+/** Test that a period of one times every event. */
+TEST(EventProfilerTest, ExactCounts)
+{
+    EventProfiler profiler(1);
+    NamedEvent a("system.cpu.tick"), b("system.mem.respond");
+    for (int i = 0; i < 10; ++i)
+        profiler.process(&a);
+    for (int i = 0; i < 5; ++i)
+        profiler.process(&b);
+
+    std::ostringstream table;
+    profiler.dumpTable(table);
+    EXPECT_NE(table.str().find("Estimated events: 15"), std::string::npos);
+    EXPECT_NE(table.str().find("system.cpu.tick (test event)"),
+              std::string::npos);
+}
+
+/** Test that sampled estimates of event counts are close. */
+TEST(EventProfilerTest, SampledCounts)
+{
+    EventProfiler profiler(8);
+    NamedEvent event("system.cpu.tick");
+    for (int i = 0; i < 100000; ++i)
+        profiler.process(&event);
+
+    std::ostringstream table;
+    profiler.dumpTable(table);
+    const std::string str = table.str();
+    const auto pos = str.find("Estimated events: ");
+    ASSERT_NE(pos, std::string::npos);
+    const long events = std::stol(str.substr(pos + 18));
+    EXPECT_NEAR(events, 100000, 100);
+}
+
+/** Test the collapsed stack output and profile merging. */
+TEST(EventProfilerTest, Folded)
+{
+    EventProfiler profiler(1), other(1);
+    NamedEvent a("system.cpu.tick");
+    profiler.process(&a);
+    other.process(&a);
+    profiler.merge(other);
+
+    std::ostringstream folded;
+    profiler.dumpFolded(folded);
+    EXPECT_EQ(folded.str().rfind("system;cpu;tick;test_event ", 0), 0);
+
+    std::ostringstream table;
+    profiler.dumpTable(table);
+    EXPECT_NE(table.str().find("Estimated events: 2"), std::string::npos);
+}
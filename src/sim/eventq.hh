@@ -59,6 +59,7 @@ namespace gem5
 {
 
 class EventQueue;       // forward declaration
+class EventProfiler;
 class BaseGlobalEvent;
 
 //! Simulation Quantum for multiple eventq simulation.
@@ -649,6 +650,9 @@ class EventQueue
      */
     UncontendedMutex service_mutex;
 
+    //! Optional profiler timing the events serviced by this queue.
+    EventProfiler *_profiler = nullptr;
+
     //! Insert / remove event from the queue. Should only be called
     //! by thread operating this queue.
     void insert(Event *event);
@@ -850,6 +854,13 @@ class EventQueue
     Tick getCurTick() const { return _curTick; }
     Event *getHead() const { return head; }
 
+    /**
+     * Attach a profiler that is handed all events serviced by this
+     * queue. The profiler is not owned by the queue.
+     */
+    void setProfiler(EventProfiler *profiler) { _profiler = profiler; }
+    EventProfiler *getProfiler() const { return _profiler; }
+
     Event *serviceOne();
 
     /**
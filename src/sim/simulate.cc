@@ -43,12 +43,18 @@
 #include "sim/simulate.hh"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "base/logging.hh"
+#include "base/output.hh"
 #include "base/pollevent.hh"
 #include "base/types.hh"
 #include "sim/async.hh"
+#include "sim/core.hh"
+#include "sim/event_profiler.hh"
 #include "sim/eventq.hh"
 #include "sim/init_signals.hh"
 #include "sim/sim_events.hh"
@@ -63,6 +69,59 @@ Event *doSimLoop(EventQueue *);
 
 GlobalSimLoopExitEvent *simulate_limit_event = nullptr;
 
+namespace
+{
+
+//! Event profiler sample period, 0 if profiling is disabled.
+unsigned eventProfilePeriod = 0;
+
+//! Profilers attached to event queues, in order of creation.
+std::vector<std::unique_ptr<EventProfiler>> eventProfilers;
+std::mutex eventProfilersMutex;
+
+void
+attachEventProfiler(EventQueue *eventq)
+{
+    std::lock_guard<std::mutex> lock(eventProfilersMutex);
+    eventProfilers.emplace_back(new EventProfiler(eventProfilePeriod));
+    eventq->setProfiler(eventProfilers.back().get());
+}
+
+void
+writeEventProfile(const std::string &prefix)
+{
+    std::lock_guard<std::mutex> lock(eventProfilersMutex);
+    if (eventProfilers.empty())
+        return;
+
+    // Merge into the oldest profiler since it has the longest host
+    // time calibration interval.
+    EventProfiler &profile = *eventProfilers.front();
+    for (size_t i = 1; i < eventProfilers.size(); ++i)
+        profile.merge(*eventProfilers[i]);
+
+    OutputStream *table = simout.create(prefix + ".txt");
+    profile.dumpTable(*table->stream());
+    simout.close(table);
+
+    OutputStream *folded = simout.create(prefix + ".folded");
+    profile.dumpFolded(*folded->stream());
+    simout.close(folded);
+}
+
+} // anonymous namespace
+
+void
+enableEventProfiling(unsigned sample_period, const std::string &prefix)
+{
+    fatal_if(sample_period == 0, "Event profiler sample period must be "
+             "at least 1.\n");
+    fatal_if(eventProfilePeriod, "Event profiling is already enabled.\n");
+
+    eventProfilePeriod = sample_period;
+    registerExitCallback([prefix]() { writeEventProfile(prefix); });
+}
+
 class SimulatorThreads
 {
   public:
@@ -294,6 +353,9 @@ doSimLoop(EventQueue *eventq)
 
     bool mainQueue = eventq == getEventQueue(0);
 
+    if (eventProfilePeriod && !eventq->getProfiler())
+        attachEventProfiler(eventq);
+
     while (1) {
         // there should always be at least one event (the SimLoopExitEvent
         // we just scheduled) in the queue
@@ -38,6 +38,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string>
+
 #include "base/types.hh"
 
 namespace gem5
@@ -75,6 +77,22 @@ Tick get_max_tick();
  */
 void terminateEventQueueThreads();
 
+/**
+ * Enable sampled host-time profiling of the events serviced by all
+ * event queues.
+ *
+ * Profilers are attached to the event queues the next time they enter
+ * the simulation loop. When gem5 exits, the merged profile is written
+ * to the output directory as a table sorted by host time
+ * (<prefix>.txt) and in the collapsed stack format used by
+ * flamegraph.pl (<prefix>.folded).
+ *
+ * @param sample_period Average number of events per timed event.
+ * @param prefix Output file name prefix.
+ */
+void enableEventProfiling(unsigned sample_period,
+                          const std::string &prefix = "event_profile");
+
 extern GlobalSimLoopExitEvent *simulate_limit_event;
 
 } // namespace gem5
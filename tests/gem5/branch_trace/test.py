@@ -0,0 +1,136 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Records the branches of a run with a BranchTraceRecorder, replays them
+with configs/example/bpred_replay.py through the same predictor and checks
+that the predictor makes the same predictions in both runs.
+"""
+
+import os
+import re
+
+from testlib import *
+from testlib import test_util
+from testlib.helper import log_call
+
+if config.bin_path:
+    resource_path = config.bin_path
+else:
+    resource_path = joinpath(absdirpath(__file__), "..", "resources")
+
+
+def read_stats(path, prefix):
+    """Return the stats whose names match prefix, with it removed."""
+    stats = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 2:
+                continue
+            match = re.match(prefix, fields[0])
+            if match:
+                stats[fields[0][match.end() :]] = fields[1]
+    return stats
+
+
+class MatchReplay(verifier.Verifier):
+    def __init__(self, predictor):
+        super().__init__()
+        self.predictor = predictor
+
+    def test(self, params):
+        tempdir = params.fixtures[constants.tempdir_fixture_name].path
+        gem5 = params.fixtures[constants.gem5_binary_fixture_name].path
+        replay_dir = joinpath(tempdir, "replay")
+
+        log_call(
+            params.log,
+            [
+                gem5,
+                "-d",
+                replay_dir,
+                "-re",
+                "--silent-redirect",
+                joinpath(
+                    config.base_dir, "configs", "example", "bpred_replay.py"
+                ),
+                "--trace",
+                joinpath(tempdir, "branches.trace.gz"),
+                "--predictor",
+                self.predictor,
+            ],
+            time=params.time,
+        )
+
+        recorded = read_stats(
+            joinpath(tempdir, "stats.txt"), r"system\.cpu\.branchPred\."
+        )
+        replayed = read_stats(
+            joinpath(replay_dir, "stats.txt"), r"replayer\.predictors\d*\."
+        )
+        if not any(
+            name.startswith("lookups") and float(value)
+            for name, value in recorded.items()
+        ):
+            test_util.fail("The recorded run made no predictions")
+        for name in sorted(recorded.keys() | replayed.keys()):
+            if recorded.get(name) != replayed.get(name):
+                test_util.fail(
+                    f"{name} is {recorded.get(name)} when recorded and "
+                    f"{replayed.get(name)} when replayed. See {tempdir}."
+                )
+
+        # The replayer's own count of mispredictions agrees with the CPU's.
+        mispredicts = read_stats(
+            joinpath(tempdir, "stats.txt"),
+            r"system\.cpu\.exec_context\.thread_0\.numBranchMispred",
+        ).get("", "0")
+        replayed = read_stats(
+            joinpath(replay_dir, "stats.txt"), r"replayer\.mispredicts::"
+        )
+        if sum(int(v) for v in replayed.values()) != int(mispredicts):
+            test_util.fail(
+                f"The CPU mispredicted {mispredicts} branches but the "
+                f"replayer {list(replayed.values())}. See {tempdir}."
+            )
+
+
+for predictor in ("TournamentBP", "LTAGE"):
+    gem5_verify_config(
+        name=f"branch_trace_replay_{predictor}",
+        verifiers=(MatchReplay(predictor),),
+        config=joinpath(getcwd(), "record-run.py"),
+        config_args=[
+            "riscv-hello",
+            "--resource-directory",
+            resource_path,
+            "--predictor",
+            predictor,
+        ],
+        valid_isas=(constants.all_compiled_tag,),
+        length=constants.quick_tag,
+    )
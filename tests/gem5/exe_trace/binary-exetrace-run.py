@@ -0,0 +1,89 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs the same binary on two CPUs in lockstep, one traced by ExeTracer with
+the Exec debug flags and the other by BinaryExeTracer. The test compares
+the text trace with the binary one decoded by util/decode_exe_trace.py.
+"""
+
+import argparse
+
+import m5
+from m5.objects import *
+
+from gem5.resources.resource import obtain_resource
+
+parser = argparse.ArgumentParser()
+parser.add_argument("resource", help="The gem5 resource binary to run")
+parser.add_argument("--resource-directory", default=None)
+parser.add_argument("--text-trace", default="exec.txt")
+parser.add_argument("--binary-trace", default="exec.bin.gz")
+args = parser.parse_args()
+
+binary = obtain_resource(
+    args.resource, resource_directory=args.resource_directory
+).get_local_path()
+
+system = System(
+    cpu=[X86AtomicSimpleCPU(cpu_id=i) for i in range(2)],
+    mem_ranges=[AddrRange("512MiB")],
+    membus=SystemXBar(),
+    physmem=SimpleMemory(range=AddrRange("512MiB")),
+)
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+system.mem_mode = "atomic"
+system.workload = SEWorkload.init_compatible(binary)
+
+system.cpu[1].tracer = BinaryExeTracer(file_name=args.binary_trace)
+
+for i, cpu in enumerate(system.cpu):
+    cpu.icache_port = system.membus.cpu_side_ports
+    cpu.dcache_port = system.membus.cpu_side_ports
+    cpu.createInterruptController()
+    cpu.interrupts[0].pio = system.membus.mem_side_ports
+    cpu.interrupts[0].int_requestor = system.membus.cpu_side_ports
+    cpu.interrupts[0].int_responder = system.membus.mem_side_ports
+    cpu.workload = Process(pid=100 + i, cmd=[binary])
+    cpu.createThreads()
+
+system.system_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+
+root = Root(full_system=False, system=system)
+
+# Only the ExeTracer of cpu[0] prints anything for these flags.
+m5.debug.flags["Exec"].enable()
+m5.trace.output(args.text_trace)
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "exiting with last active thread context":
+    print(f"Unexpected exit: {exit_event.getCause()}")
+    exit(1)
@@ -0,0 +1,94 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Checks that a trace written by BinaryExeTracer and rendered by
+util/decode_exe_trace.py matches the text trace of ExeTracer.
+"""
+
+import importlib.util
+import io
+import re
+
+from testlib import *
+from testlib import test_util
+
+if config.bin_path:
+    resource_path = config.bin_path
+else:
+    resource_path = joinpath(absdirpath(__file__), "..", "resources")
+
+
+class MatchDecodedTrace(verifier.Verifier):
+    # The two traces come from different CPUs.
+    cpu_name = re.compile(r"^(\s*\d+: )system\.cpu\d+: ", re.MULTILINE)
+
+    def test(self, params):
+        tempdir = params.fixtures[constants.tempdir_fixture_name].path
+
+        spec = importlib.util.spec_from_file_location(
+            "decode_exe_trace",
+            joinpath(config.base_dir, "util", "decode_exe_trace.py"),
+        )
+        decoder = importlib.util.module_from_spec(spec)
+        spec.loader.exec_module(decoder)
+
+        decoded = io.StringIO()
+        decoder.decode(
+            decoder.make_parser().parse_args(
+                [joinpath(tempdir, "exec.bin.gz")]
+            ),
+            decoded,
+        )
+        with open(joinpath(tempdir, "exec.txt")) as f:
+            expected = f.read()
+
+        decoded = self.cpu_name.sub(r"\1system.cpu: ", decoded.getvalue())
+        expected = self.cpu_name.sub(r"\1system.cpu: ", expected)
+        if not expected:
+            test_util.fail("The text trace is empty")
+        if decoded != expected:
+            decoded, expected = decoded.splitlines(), expected.splitlines()
+            for i, (a, b) in enumerate(zip(decoded, expected)):
+                if a != b:
+                    test_util.fail(f"Line {i + 1} differs:\n{a}\n{b}")
+            test_util.fail(
+                f"{len(decoded)} lines decoded, {len(expected)} expected"
+            )
+
+
+gem5_verify_config(
+    name="binary_exetrace_round_trip",
+    verifiers=(MatchDecodedTrace(),),
+    config=joinpath(getcwd(), "binary-exetrace-run.py"),
+    config_args=[
+        "x86-hello64-static",
+        "--resource-directory",
+        resource_path,
+    ],
+    valid_isas=(constants.all_compiled_tag,),
+    length=constants.quick_tag,
+)
@@ -0,0 +1,207 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Checkpoints the contents of a cache and restores them. A traffic generator
+fills the cache and the run with --save checkpoints it. The restore run
+checkpoints the restored cache again straight away and compares both
+checkpoints: the restored cache must hold the same blocks, with the same
+state and data, in the same replacement order.
+
+With --shrink, the contents are restored into a cache with half the ways,
+and each set must keep the blocks its replacement policy would have kept.
+"""
+
+import argparse
+import configparser
+import gzip
+import os
+import sys
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--checkpoint-dir", required=True)
+parser.add_argument("--save", action="store_true", default=False)
+parser.add_argument("--shrink", action="store_true", default=False)
+parser.add_argument(
+    "--tags", choices=["lru", "mru", "brrip", "fifo", "falru", "sector"]
+)
+args = parser.parse_args()
+
+block_size = 64
+num_sets = 32
+# The save run always fills a full size cache
+assoc = 4 if args.shrink and not args.save else 8
+
+system = System(membus=IOXBar(width=128))
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+system.cache_line_size = block_size
+
+system.mem_ctrl = SimpleMemory(range=AddrRange("1MiB"))
+system.mem_ctrl.port = system.membus.mem_side_ports
+
+tags_params = {}
+if args.tags == "falru":
+    tags_params["tags"] = FALRU()
+elif args.tags == "sector":
+    tags_params["tags"] = SectorTags(num_blocks_per_sector=2)
+    tags_params["replacement_policy"] = LRURP()
+else:
+    tags_params["replacement_policy"] = {
+        "lru": LRURP,
+        "mru": MRURP,
+        "brrip": BRRIPRP,
+        "fifo": FIFORP,
+    }[args.tags]()
+
+system.cache = NoncoherentCache(
+    size=f"{num_sets * assoc * block_size}B",
+    assoc=assoc,
+    tag_latency=1,
+    data_latency=1,
+    response_latency=1,
+    mshrs=4,
+    tgts_per_mshr=8,
+    write_buffers=8,
+    checkpoint_contents=True,
+    **tags_params,
+)
+system.cache.mem_side = system.membus.cpu_side_ports
+
+system.tgen = PyTrafficGen()
+system.tgen.port = system.cache.cpu_side
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+if args.save:
+    m5.instantiate()
+    # Only reads, so that shrinking the cache drops no dirty data
+    read_percent = 100 if args.shrink else 70
+    system.tgen.start(
+        [
+            system.tgen.createRandom(
+                100000000,
+                0,
+                256 * 1024,
+                block_size,
+                1000,
+                1000,
+                read_percent,
+                0,
+            ),
+            system.tgen.createExit(0),
+        ]
+    )
+    m5.simulate()
+    m5.checkpoint(args.checkpoint_dir)
+    print("Done taking checkpoint")
+    sys.exit(0)
+
+m5.instantiate(args.checkpoint_dir)
+restored_dir = os.path.join(m5.options.outdir, "restored")
+m5.checkpoint(restored_dir)
+
+
+def read_blocks(cpt_dir):
+    """Returns a dictionary mapping the address of each block in the cache
+    checkpoint to its state, replacement state and data."""
+    cpt = configparser.ConfigParser(strict=False, interpolation=None)
+    cpt.read(os.path.join(cpt_dir, "m5.cpt"))
+    section = cpt[system.cache.path()]
+    fields = {
+        name: [int(value) for value in section[name].split()]
+        for name in ("blk_addr", "blk_state", "blk_repl")
+    }
+    with gzip.open(os.path.join(cpt_dir, section["filename"])) as data_file:
+        data = data_file.read()
+
+    blocks = {}
+    for i, addr in enumerate(fields["blk_addr"]):
+        blocks[addr] = (
+            fields["blk_state"][i],
+            fields["blk_repl"][i],
+            data[i * block_size : (i + 1) * block_size],
+        )
+    return blocks
+
+
+def replacement_order(blocks):
+    """Groups the blocks of each set by replacement state, in ascending
+    order of state. Restored states may differ from the saved ones (e.g.
+    FALRU renumbers them), but must keep the same order."""
+    sets = {}
+    for addr, (_, repl, _) in blocks.items():
+        index = 0 if args.tags == "falru" else (addr // block_size) % num_sets
+        sets.setdefault(index, {}).setdefault(repl, set()).add(addr)
+    return {
+        index: [states[repl] for repl in sorted(states)]
+        for index, states in sets.items()
+    }
+
+
+def fail(msg):
+    print(msg)
+    sys.exit(1)
+
+
+saved = read_blocks(args.checkpoint_dir)
+restored = read_blocks(restored_dir)
+if not saved:
+    fail("The checkpoint holds no cache blocks")
+
+if not args.shrink:
+    if saved.keys() != restored.keys():
+        fail("The restored cache holds different blocks")
+    for addr, (state, _, data) in saved.items():
+        if restored[addr][0] != state or restored[addr][2] != data:
+            fail(f"Block {addr:#x} was restored with a different state")
+    if replacement_order(saved) != replacement_order(restored):
+        fail("The replacement order of the blocks changed")
+    sys.exit(0)
+
+# The blocks a policy keeps are the last ones in its eviction order: the
+# most recently used ones for LRU and the least recently used ones for MRU.
+ways = assoc if args.tags != "falru" else num_sets * assoc
+for index, order in replacement_order(saved).items():
+    if args.tags == "mru":
+        order = list(reversed(order))
+    expected = set()
+    for group in reversed(order):
+        if len(expected) + len(group) > ways:
+            break
+        expected |= group
+    kept = {
+        addr
+        for addr in restored
+        if args.tags == "falru" or (addr // block_size) % num_sets == index
+    }
+    if not expected <= kept:
+        fail(f"Set {index} dropped blocks its policy would have kept")
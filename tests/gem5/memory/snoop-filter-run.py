@@ -0,0 +1,103 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs MemTest testers through private L1 caches sharing an L2 behind a
+capacity-bounded snoop filter. The filter is much smaller than the L1s,
+so it keeps evicting entries and back-invalidating their holders. The
+testers check every load, so a line that is lost or left stale by a
+back-invalidation fails the run, and so does a run without evictions.
+"""
+
+import argparse
+import os
+
+import m5
+from m5.objects import *
+
+m5.util.addToPath("../../../configs/")
+from common.Caches import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--mem-mode", choices=["timing", "atomic"])
+parser.add_argument("--region-size", default="0B")
+parser.add_argument("--capacity", default="8KiB")
+args = parser.parse_args()
+
+nb_cores = 4
+cpus = [
+    MemTest(max_loads=1e5, progress_interval=1e4, percent_uncacheable=0)
+    for i in range(nb_cores)
+]
+
+system = System(cpu=cpus, physmem=SimpleMemory(), membus=SystemXBar())
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.toL2Bus = L2XBar(
+    snoop_filter=SnoopFilter(
+        lookup_latency=0,
+        max_capacity=args.capacity,
+        assoc=4,
+        region_size=args.region_size,
+    )
+)
+system.l2c = L2Cache(size="64kB", assoc=8)
+system.l2c.cpu_side = system.toL2Bus.mem_side_ports
+system.l2c.mem_side = system.membus.cpu_side_ports
+
+for cpu in cpus:
+    cpu.l1c = L1Cache(size="32kB", assoc=4)
+    cpu.l1c.cpu_side = cpu.port
+    cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
+
+system.system_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = args.mem_mode
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "maximum number of loads reached":
+    exit(1)
+
+m5.stats.dump()
+
+# Stats which are zero are not printed
+evictions = 0
+stat = f"{system.toL2Bus.snoop_filter.path()}.evictions"
+with open(os.path.join(m5.options.outdir, "stats.txt")) as stats_file:
+    for line in stats_file:
+        fields = line.split()
+        if len(fields) >= 2 and fields[0] == stat:
+            evictions = float(fields[1])
+
+if not evictions:
+    print(f"{stat} is zero, nothing was back-invalidated")
+    exit(1)
@@ -30,6 +30,8 @@ TODO: Add stats checking
 """
 
 from testlib import *
+from testlib import test_util
+from testlib.helper import log_call
 
 gem5_verify_config(
     name="simple_mem_default",
@@ -70,6 +72,51 @@ gem5_verify_config(
     length=constants.long_tag,
 )
 
+for name, args in (("", []), ("_warming", ["--warming"])):
+    gem5_verify_config(
+        name="memtest_atomic" + name,
+        verifiers=(),  # No need for verfiers this will return non-zero on fail
+        config=joinpath(getcwd(), "warming-run.py"),
+        config_args=args,
+        valid_isas=(constants.null_tag,),
+        length=constants.long_tag,
+    )
+
+for mode in ("timing", "atomic"):
+    for name, args in (("", []), ("_region", ["--region-size", "1KiB"])):
+        gem5_verify_config(
+            name="snoop_filter_" + mode + name,
+            verifiers=(),  # The run returns non-zero on fail
+            config=joinpath(getcwd(), "snoop-filter-run.py"),
+            config_args=["--mem-mode", mode] + args,
+            valid_isas=(constants.null_tag,),
+            length=constants.long_tag,
+        )
+
+if config.bin_path:
+    resource_path = config.bin_path
+else:
+    resource_path = joinpath(absdirpath(__file__), "..", "resources")
+
+cache_checkpoint_tests = [
+    (tags, "") for tags in ("lru", "mru", "brrip", "fifo", "falru", "sector")
+] + [(tags, "shrink") for tags in ("lru", "mru", "falru")]
+
+for tags, mode in cache_checkpoint_tests:
+    name = "_".join(filter(None, ("cache_checkpoint", tags, mode)))
+    args = ["--tags", tags, "--checkpoint-dir", joinpath(resource_path, name)]
+    if mode:
+        args.append("--" + mode)
+    for step, step_args in (("_save", ["--save"]), ("_restore", [])):
+        gem5_verify_config(
+            name=name + step,
+            verifiers=(),  # The run returns non-zero on fail
+            config=joinpath(getcwd(), "cache-checkpoint-run.py"),
+            config_args=args + step_args,
+            valid_isas=(constants.null_tag,),
+            length=constants.long_tag,
+        )
+
 null_tests = [
     ("garnet_synth_traffic", None, ["--sim-cycles", "5000000"]),
     ("memcheck", None, ["--maxtick", "2000000000", "--prefetchers"]),
@@ -118,6 +165,21 @@ null_tests = [
             "--num-cpus=4",
         ],
     ),
+    (
+        "ruby_mem_test-simple-parallel",
+        "ruby_mem_test",
+        [
+            "--abs-max-tick",
+            "20000000",
+            "--functional",
+            "10",
+            "--network=simple",
+            "--num-cpus=4",
+            "--ruby-clock=1GHz",
+            "--link-latency=10",
+            "--ruby-event-queues=2",
+        ],
+    ),
     ("ruby_random_test", None, ["--maxloads", "5000"]),
     ("ruby_direct_test", None, ["--requests", "50000"]),
 ]
@@ -137,3 +199,96 @@ for test_name, basename_noext, args in null_tests:
         valid_hosts=constants.supported_hosts,
         length=constants.long_tag,
     )
+
+
+class MatchPerFlitNetwork(verifier.Verifier):
+    """
+    Runs the configuration again without the Garnet fast mode and checks
+    that the run with aggregated flits delivered the same packets and
+    flits, with average latencies within a tolerance of the per-flit run.
+    """
+
+    stat_prefix = "system.ruby.network."
+
+    def __init__(self, config, config_args, tolerance=0.05):
+        super().__init__()
+        self.config = config
+        self.config_args = [
+            arg for arg in config_args if arg != "--garnet-fast-mode"
+        ]
+        self.tolerance = tolerance
+
+    def _read_stats(self, outdir):
+        stats = {}
+        with open(joinpath(outdir, "stats.txt")) as stats_file:
+            for line in stats_file:
+                fields = line.split()
+                if len(fields) > 1 and fields[0].startswith(self.stat_prefix):
+                    name = fields[0][len(self.stat_prefix) :]
+                    stats[name] = float(fields[1])
+        return stats
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        outdir = joinpath(tempdir, "per-flit")
+        log_call(
+            params.log,
+            [fixtures[constants.gem5_binary_fixture_name].path, "-d", outdir]
+            + ["-re", "--silent-redirect", self.config]
+            + self.config_args,
+            time=params.time,
+        )
+
+        fast = self._read_stats(tempdir)
+        ref = self._read_stats(outdir)
+
+        if fast.get("packets_aggregated::total", 0) == 0:
+            test_util.fail("No packet was sent with aggregated flits")
+        for stat in ("packets_injected::total", "flits_injected::total"):
+            received = stat.replace("injected", "received")
+            if fast[stat] != ref[stat] or fast[received] != ref[received]:
+                test_util.fail(
+                    f"{stat}/{received}: {fast[stat]}/{fast[received]} "
+                    f"with aggregated flits, {ref[stat]}/{ref[received]} "
+                    "without"
+                )
+            if ref[received] != ref[stat]:
+                test_util.fail(f"Not all {stat} were delivered")
+        for stat in ("average_packet_latency", "average_flit_latency"):
+            if abs(fast[stat] - ref[stat]) > self.tolerance * ref[stat]:
+                test_util.fail(
+                    f"{stat}: {fast[stat]} with aggregated flits, "
+                    f"{ref[stat]} without"
+                )
+
+
+# Data packets only, at a load low enough for fast mode not to fall back
+# to per-flit packets, with all the packets delivered by the end
+garnet_fast_mode_config = joinpath(
+    config.base_dir, "configs", "example", "garnet_synth_traffic.py"
+)
+garnet_fast_mode_args = [
+    "--network=garnet",
+    "--topology=Mesh_XY",
+    "--num-cpus=16",
+    "--num-dirs=16",
+    "--mesh-rows=4",
+    "--synthetic=uniform_random",
+    "--injectionrate=0.01",
+    "--inj-vnet=2",
+    "--num-packets-max=100",
+    "--sim-cycles=100000",
+    "--garnet-fast-mode",
+]
+
+gem5_verify_config(
+    name="garnet_synth_traffic-fast-mode",
+    verifiers=(
+        MatchPerFlitNetwork(garnet_fast_mode_config, garnet_fast_mode_args),
+    ),
+    config=garnet_fast_mode_config,
+    config_args=garnet_fast_mode_args,
+    valid_isas=(constants.null_tag,),
+    length=constants.long_tag,
+)
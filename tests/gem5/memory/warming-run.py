@@ -0,0 +1,104 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs a MemTest tester through a two-level cache hierarchy in atomic mode
+and checks the functional warming path of the caches. The tester checks
+every load, so any data returned wrongly while warming fails the run.
+
+With --warming, the caches warm functionally on their own because the
+system is in atomic mode. Warming accesses must then not show up in the
+cache stats, while a run without --warming must count hits.
+"""
+
+import argparse
+import os
+
+import m5
+from m5.objects import *
+
+m5.util.addToPath("../../../configs/")
+from common.Caches import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--warming", action="store_true", default=False)
+args = parser.parse_args()
+
+nb_cores = 2
+cpus = [
+    MemTest(
+        max_loads=1e5,
+        progress_interval=1e4,
+        percent_uncacheable=0,
+    )
+    for i in range(nb_cores)
+]
+
+system = System(cpu=cpus, physmem=SimpleMemory(), membus=SystemXBar())
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.toL2Bus = L2XBar()
+system.l2c = L2Cache(size="64kB", assoc=8, functional_warming=args.warming)
+system.l2c.cpu_side = system.toL2Bus.mem_side_ports
+system.l2c.mem_side = system.membus.cpu_side_ports
+
+for cpu in cpus:
+    cpu.l1c = L1Cache(size="32kB", assoc=4, functional_warming=args.warming)
+    cpu.l1c.cpu_side = cpu.port
+    cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
+
+system.system_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "atomic"
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "maximum number of loads reached":
+    exit(1)
+
+m5.stats.dump()
+
+# Stats which are zero are not printed
+stats = {}
+with open(os.path.join(m5.options.outdir, "stats.txt")) as stats_file:
+    for line in stats_file:
+        fields = line.split()
+        if len(fields) >= 2 and not line.startswith("-"):
+            stats[fields[0]] = fields[1]
+
+for cpu in cpus:
+    hits = float(stats.get(f"{cpu.l1c.path()}.demandHits::total", 0))
+    if args.warming and hits:
+        print(f"{cpu.l1c.path()} counted {hits} hits while warming")
+        exit(1)
+    if not args.warming and not hits:
+        print(f"{cpu.l1c.path()} counted no hits")
+        exit(1)
@@ -0,0 +1,102 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Replays the same elastic traces on two identical systems, one TraceCPU
+decoding the data dependency trace on the simulation thread and the other
+on a helper thread, and checks that both replays end up with the same
+stats.
+"""
+
+import argparse
+import os
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--inst-trace", required=True)
+parser.add_argument("--data-trace", required=True)
+args = parser.parse_args()
+
+
+def make_system(async_decode):
+    system = System(
+        cpu=TraceCPU(
+            instTraceFile=args.inst_trace,
+            dataTraceFile=args.data_trace,
+            asyncTraceDecode=async_decode,
+        ),
+        mem_mode=TraceCPU.memory_mode(),
+        mem_ranges=[AddrRange("512MiB")],
+        membus=SystemXBar(),
+        physmem=SimpleMemory(range=AddrRange("512MiB")),
+    )
+    system.voltage_domain = VoltageDomain()
+    system.clk_domain = SrcClockDomain(
+        clock="1GHz", voltage_domain=system.voltage_domain
+    )
+    system.cpu.icache_port = system.membus.cpu_side_ports
+    system.cpu.dcache_port = system.membus.cpu_side_ports
+    system.system_port = system.membus.cpu_side_ports
+    system.physmem.port = system.membus.mem_side_ports
+    return system
+
+
+root = Root(full_system=False)
+root.sync_decode = make_system(False)
+root.async_decode = make_system(True)
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "end of all traces reached.":
+    print(f"Unexpected exit: {exit_event.getCause()}")
+    exit(1)
+
+m5.stats.dump()
+
+stats = {"sync_decode": {}, "async_decode": {}}
+with open(os.path.join(m5.options.outdir, "stats.txt")) as stats_file:
+    for line in stats_file:
+        fields = line.split()
+        if len(fields) < 2:
+            continue
+        system, _, name = fields[0].partition(".")
+        if system in stats:
+            stats[system][name] = fields[1]
+
+if not stats["sync_decode"].get("cpu.numOps"):
+    print("Nothing was replayed")
+    exit(1)
+for name in sorted(stats["sync_decode"].keys() | stats["async_decode"].keys()):
+    sync = stats["sync_decode"].get(name)
+    async_ = stats["async_decode"].get(name)
+    if sync != async_:
+        print(
+            f"{name} is {sync} when decoded on the simulation thread and "
+            f"{async_} when decoded on a helper thread"
+        )
+        exit(1)
@@ -0,0 +1,79 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Records the elastic traces of a run and checks that TraceCPU replays them
+to the same result whether it decodes the data dependency trace on the
+simulation thread or on a helper thread.
+"""
+
+from testlib import *
+from testlib.helper import log_call
+
+if config.bin_path:
+    resource_path = config.bin_path
+else:
+    resource_path = joinpath(absdirpath(__file__), "..", "resources")
+
+replay_script = joinpath(getcwd(), "replay-run.py")
+
+
+class ReplayAsyncMatchesSync(verifier.Verifier):
+    def test(self, params):
+        tempdir = params.fixtures[constants.tempdir_fixture_name].path
+        gem5 = params.fixtures[constants.gem5_binary_fixture_name].path
+
+        # The replay fails if the two ways of decoding disagree.
+        log_call(
+            params.log,
+            [
+                gem5,
+                "-d",
+                joinpath(tempdir, "replay"),
+                "-re",
+                "--silent-redirect",
+                replay_script,
+                "--inst-trace",
+                joinpath(tempdir, "fetch.proto.gz"),
+                "--data-trace",
+                joinpath(tempdir, "deps.proto.gz"),
+            ],
+            time=params.time,
+        )
+
+
+gem5_verify_config(
+    name="trace_cpu_async_decode",
+    verifiers=(ReplayAsyncMatchesSync(),),
+    config=joinpath(getcwd(), "record-run.py"),
+    config_args=[
+        "riscv-hello",
+        "--resource-directory",
+        resource_path,
+    ],
+    valid_isas=(constants.all_compiled_tag,),
+    length=constants.quick_tag,
+)
@@ -0,0 +1,238 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Check that the table-driven transition backend of SLICC behaves like the
+switch backend. Each protocol is generated with both backends, and the
+sequence of operations each performs for every (state, event) pair is
+recovered from the generated code and compared: the next state assignment,
+the resource checks in order, and the statements of the transition."""
+
+import os
+import re
+import sys
+import tempfile
+import unittest
+
+_root = os.path.join(os.path.dirname(os.path.abspath(__file__)), *[".."] * 3)
+for _path in ("src/mem", "build_tools", "ext/ply"):
+    _path = os.path.join(_root, _path)
+    if _path not in sys.path:
+        sys.path.insert(0, _path)
+
+from slicc.parser import SLICC
+
+_protocol_base = os.path.join(_root, "src", "mem", "ruby", "protocol")
+
+_case_re = re.compile(
+    r"^\s*case HASH_FUN\((\w+)_State_(\w+), \w+_Event_(\w+)\):"
+)
+_next_state_re = re.compile(
+    r"^next_state = (.*); m_curTransitionNextState = next_state;$"
+)
+_check_re = re.compile(r"^if \(!(.*)\)( \{)?$")
+
+
+def _generate(protocol, table, path):
+    slicc = SLICC(
+        os.path.join(_protocol_base, f"{protocol}.slicc"),
+        _protocol_base,
+        verbose=False,
+        transition_table=table,
+    )
+    slicc.process()
+    slicc.writeCodeFiles(path, [])
+    return [
+        f[: -len("_Transitions.cc")]
+        for f in sorted(os.listdir(path))
+        if f.endswith("_Transitions.cc")
+    ]
+
+
+def _read(path, name):
+    with open(os.path.join(path, name)) as f:
+        return f.read()
+
+
+def _operations(machine, lines):
+    """Turn the statements of a transition into a list of operations"""
+
+    ops = []
+    lines = [l.strip() for l in lines if l.strip()]
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        ns = _next_state_re.match(line)
+        check = _check_re.match(line)
+        if ns:
+            ns = ns.group(1)
+            ops.append(("next_state", ns.replace(f"{machine}_State_", "")))
+        elif check:
+            assert lines[i + 1] == "return TransitionResult_ResourceStall;"
+            ops.append(("check", check.group(1)))
+            i += 1 if not check.group(2) else 2
+        else:
+            ops.append(("statement", line))
+        i += 1
+    return ops
+
+
+def _switch_behavior(path, machine):
+    """Return the operations of each transition of the switch backend"""
+
+    code = _read(path, f"{machine}_Transitions.cc").splitlines()
+    start = next(i for i, l in enumerate(code) if "switch(HASH_FUN" in l)
+    behavior = {}
+    keys = []
+    body = []
+    for line in code[start + 1 :]:
+        case = _case_re.match(line)
+        if case or line.strip() == "default:":
+            if body:
+                ops = _operations(machine, body)
+                for key in keys:
+                    behavior[key] = ops
+                keys = []
+                body = []
+            if not case:
+                break
+            keys.append((case.group(2), case.group(3)))
+        else:
+            body.append(line)
+    return behavior
+
+
+def _table_behavior(path, machine):
+    """Return the operations of each transition of the table backend"""
+
+    c_ident = f"{machine}_Controller"
+    code = _read(path, f"{c_ident}.cc")
+
+    # Resources, with the slots to check as a placeholder
+    resources = {}
+    func = re.search(
+        r"^\w+::transitionResourceAvailable\(.*?^}", code, re.M | re.S
+    )
+    if func:
+        for idx, expr in re.findall(
+            r"case (\d+):\s*return (.*);", func.group(0)
+        ):
+            resources[int(idx)] = expr
+    checks = []
+    array = re.search(
+        r"s_transitionChecks\[\] = \{(.*?)^};", code, re.M | re.S
+    )
+    if array:
+        for idx, slots in re.findall(r"\{(\d+), (\d+)\},", array.group(1)):
+            expr = resources[int(idx)].replace("(slots,", f"({slots},")
+            checks.append(("check", expr))
+
+    handlers = {}
+    for idx, body in re.findall(
+        rf"^{c_ident}::transitionHandler(\d+)\(.*?\)\n\{{\n(.*?)^}}",
+        code,
+        re.M | re.S,
+    ):
+        handlers[int(idx)] = _operations(machine, body.splitlines())
+
+    # The order in which doTransitionWorker sets the next state, checks
+    # the resources and calls the handler
+    worker = _read(path, f"{machine}_Transitions.cc")
+    worker = worker[worker.index("::doTransitionWorker(") :]
+    phases = sorted(
+        (worker.index(marker), phase)
+        for marker, phase in (
+            ("entry.nextState", "next_state"),
+            ("s_transitionChecks[", "checks"),
+            ("(this->*entry.handler)", "handler"),
+        )
+        if marker in worker
+    )
+
+    entries = []
+    array = re.search(
+        r"s_transitionHandlers\[\] = \{(.*?)^};", code, re.M | re.S
+    )
+    for handler, first, last, next_state in re.findall(
+        r"\{&\w+::transitionHandler(\d+), (\d+), (\d+), (\w+)\},",
+        array.group(1),
+    ):
+        ops = []
+        for _, phase in phases:
+            if phase == "handler":
+                ops += handlers[int(handler)]
+            elif phase == "checks":
+                ops += checks[int(first) : int(last)]
+            elif next_state == "TransitionGetNextState":
+                ops.append(("next_state", "getNextState(addr)"))
+            elif next_state != "TransitionKeepState":
+                next_state = next_state.replace(f"{machine}_State_", "")
+                ops.append(("next_state", next_state))
+        entries.append(ops)
+
+    behavior = {}
+    table = re.search(
+        r"s_transitionTable\[.*?\] = \{(.*?)^};", code, re.M | re.S
+    )
+    state = None
+    for line in table.group(1).splitlines():
+        row = re.match(r"\s*\{ // (\w+)", line)
+        cell = re.match(r"\s*(-?\d+), // (\w+)", line)
+        if row:
+            state = row.group(1)
+        elif cell and int(cell.group(1)) >= 0:
+            behavior[(state, cell.group(2))] = entries[int(cell.group(1))]
+    return behavior
+
+
+class TransitionTableTestSuite(unittest.TestCase):
+    """Compare the transition backends of SLICC"""
+
+    def compareBackends(self, protocol):
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            switch_dir = os.path.join(tmp_dir, "switch")
+            table_dir = os.path.join(tmp_dir, "table")
+            machines = _generate(protocol, False, switch_dir)
+            self.assertEqual(machines, _generate(protocol, True, table_dir))
+            self.assertTrue(machines)
+            for machine in machines:
+                with self.subTest(machine=machine):
+                    switch = _switch_behavior(switch_dir, machine)
+                    table = _table_behavior(table_dir, machine)
+                    self.assertTrue(switch)
+                    self.assertEqual(switch.keys(), table.keys())
+                    for key, ops in switch.items():
+                        self.assertEqual(ops, table[key], key)
+
+    def test_mesi_two_level(self):
+        self.compareBackends("MESI_Two_Level")
+
+    def test_gpu_viper(self):
+        # Transitions check request types as well as message buffers
+        self.compareBackends("GPU_VIPER")
+
+    def test_chi(self):
+        # Transitions pick their next state with getNextState()
+        self.compareBackends("chi/CHI")
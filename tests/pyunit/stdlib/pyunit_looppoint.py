@@ -33,6 +33,7 @@ from gem5.resources.looppoint import (
     Looppoint,
     LooppointCsvLoader,
     LooppointJsonLoader,
+    LooppointMarkersLoader,
     LooppointRegion,
     LooppointRegionPC,
     LooppointRegionWarmup,
@@ -173,6 +174,35 @@ class LooppointSimulationTestSuite(unittest.TestCase):
         }
         self.assertDictEqual(expected, sim.to_json())
 
+    def test_construction_without_end(self) -> None:
+        sim = LooppointSimulation(
+            start=LooppointRegionPC(pc=444, globl=65),
+        )
+
+        self.assertEqual(444, sim.get_start().get_pc())
+        self.assertIsNone(sim.get_end())
+
+    def test_get_pc_count_pairs_without_end(self) -> None:
+        sim = LooppointSimulation(
+            start=LooppointRegionPC(pc=56, globl=45),
+        )
+
+        sim_pc_count_pairs = sim.get_pc_count_pairs()
+        self.assertEqual(1, len(sim_pc_count_pairs))
+        self.assertEqual(PcCountPair(56, 45), sim_pc_count_pairs[0])
+
+    def test_get_json_without_end(self) -> None:
+        sim = LooppointSimulation(
+            start=LooppointRegionPC(pc=1, globl=2),
+        )
+        expected = {
+            "start": {
+                "pc": 1,
+                "global": 2,
+            },
+        }
+        self.assertDictEqual(expected, sim.to_json())
+
 
 class LooppointRegionTestSuite(unittest.TestCase):
     """Tests the resources.looppoint.LooppointRegion class."""
@@ -596,3 +626,81 @@ class LooppointJsonLoaderTestSuite(unittest.TestCase):
 
         region_warmup = region.get_warmup()
         self.assertIsNone(region_warmup)
+
+
+class LooppointMarkersLoaderTestSuite(unittest.TestCase):
+    """Tests the resources.looppoint.LooppointMarkersLoader class."""
+
+    def _load(self, region_id=None) -> LooppointMarkersLoader:
+        refs = os.path.join(
+            os.path.realpath(os.path.dirname(__file__)), "refs"
+        )
+        return LooppointMarkersLoader(
+            markers_file=os.path.join(refs, "looppoint.markers"),
+            simpoints_file=os.path.join(refs, "looppoint.simpts"),
+            weights_file=os.path.join(refs, "looppoint.weights"),
+            region_id=region_id,
+        )
+
+    def test_load_all_regions(self):
+        looppoint = self._load()
+
+        regions = looppoint.get_regions()
+        self.assertEqual(2, len(regions))
+        self.assertTrue(0 in regions)
+        self.assertTrue(3 in regions)
+
+        # Each region stands for the instructions of its cluster, out of
+        # the 1000000 instructions of all the regions.
+        self.assertAlmostEqual(6.0, regions[0].get_multiplier())
+        self.assertAlmostEqual(1.0, regions[3].get_multiplier())
+
+    def test_region_markers(self):
+        region = self._load().get_regions()[0]
+
+        region_start = region.get_simulation().get_start()
+        self.assertEqual(0x401000, region_start.get_pc())
+        self.assertEqual(1, region_start.get_global())
+        self.assertIsNone(region_start.get_relative())
+
+        region_end = region.get_simulation().get_end()
+        self.assertEqual(0x401A40, region_end.get_pc())
+        self.assertEqual(12, region_end.get_global())
+        self.assertIsNone(region_end.get_relative())
+
+        self.assertIsNone(region.get_warmup())
+
+    def test_last_region_has_no_end(self):
+        region = self._load().get_regions()[3]
+
+        region_start = region.get_simulation().get_start()
+        self.assertEqual(0x402000, region_start.get_pc())
+        self.assertEqual(3, region_start.get_global())
+        self.assertIsNone(region.get_simulation().get_end())
+
+        self.assertEqual(
+            [PcCountPair(0x402000, 3)], region.get_pc_count_pairs()
+        )
+
+    def test_targets(self):
+        looppoint = self._load()
+
+        self.assertEqual(
+            [
+                PcCountPair(0x401000, 1),
+                PcCountPair(0x401A40, 12),
+                PcCountPair(0x402000, 3),
+            ],
+            looppoint.get_targets(),
+        )
+
+    def test_load_region_0(self):
+        looppoint = self._load(region_id=0)
+
+        regions = looppoint.get_regions()
+        self.assertEqual(1, len(regions))
+        self.assertTrue(0 in regions)
+
+    def test_load_unknown_region(self):
+        with self.assertRaises(Exception):
+            self._load(region_id=1)
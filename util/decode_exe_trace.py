@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Render a binary instruction trace written by BinaryExeTracer.
+
+The output matches the text written by ExeTracer with the "Exec" debug
+flags. Fields can be added or removed to match other sets of Exec* format
+flags:
+
+    decode_exe_trace.py m5out/system.cpu.tracer.bin.gz
+    decode_exe_trace.py --asid --no-opclass trace.bin.gz out.txt
+
+See src/cpu/binary_exetrace.hh for a description of the file format.
+"""
+
+import argparse
+import gzip
+import struct
+import sys
+
+MAGIC = b"gem5xtr\0"
+VERSION = 1
+
+REC_INST = 0
+REC_STRING = 1
+REC_RESULT = 2
+
+FLAG_RAN = 0x1
+FLAG_MICROOP = 0x2
+FLAG_PREDICATED_FALSE = 0x4
+FLAG_MEM_VALID = 0x8
+
+DATA_INVALID = 0
+DATA_REG = 5
+
+_header = struct.Struct("<8sIIQ")
+_record = struct.Struct("<QQQQIIIHHIBBBB")
+
+
+def records(stream):
+    """Yield (type, fields, payload) tuples for each record of a trace."""
+    magic, version, rec_size, _ = _header.unpack(stream.read(_header.size))
+    if magic != MAGIC:
+        sys.exit("Not a binary instruction trace")
+    if version != VERSION or rec_size != _record.size:
+        sys.exit(f"Unsupported trace version {version}")
+
+    while True:
+        buf = stream.read(rec_size)
+        if len(buf) < rec_size:
+            return
+        fields = _record.unpack(buf)
+        rec_type = fields[-1]
+        payload = None
+        if rec_type != REC_INST:
+            length = fields[3]
+            padded = -(-length // rec_size) * rec_size
+            payload = stream.read(padded)[:length].decode(errors="replace")
+        yield rec_type, fields, payload
+
+
+def render(fields, strings, result, args):
+    (
+        tick,
+        pc,
+        addr,
+        data,
+        cpu,
+        disasm,
+        symbol,
+        upc,
+        op_class,
+        asid,
+        thread,
+        data_status,
+        flags,
+        _,
+    ) = fields
+
+    line = "" if args.no_ticks else f"{tick:7d}: "
+    line += f"{strings[cpu]}: "
+    if args.asid:
+        line += f"A{asid} "
+    if not args.no_thread:
+        line += f"T{thread} : "
+    line += f"{pc:#x}"
+    if symbol and not args.no_symbol:
+        line += f" {strings[symbol]}"
+    line += f".{upc:2d}" if flags & FLAG_MICROOP else "   "
+    line += f" : {strings[disasm]:<26}"
+
+    if flags & FLAG_RAN:
+        line += " : "
+        if not args.no_opclass:
+            line += f"{strings[op_class + 1]} : "
+        if not args.no_result:
+            if flags & FLAG_PREDICATED_FALSE:
+                line += "Predicated False"
+            if data_status == DATA_REG:
+                line += f" D={result}"
+            elif data_status != DATA_INVALID:
+                line += f" D={data:#018x}"
+        if flags & FLAG_MEM_VALID and not args.no_addr:
+            line += f" A=0x{addr:x}"
+    return line
+
+
+def make_parser():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("trace", help="binary trace, optionally gzipped")
+    parser.add_argument("output", nargs="?", help="output file (stdout)")
+    parser.add_argument("--no-ticks", action="store_true")
+    parser.add_argument("--no-thread", action="store_true")
+    parser.add_argument("--no-symbol", action="store_true")
+    parser.add_argument("--no-opclass", action="store_true")
+    parser.add_argument("--no-result", action="store_true")
+    parser.add_argument("--no-addr", action="store_true")
+    parser.add_argument("--asid", action="store_true")
+    return parser
+
+
+def decode(args, out):
+    """Write the trace named by args.trace to out as text."""
+    with open(args.trace, "rb") as f:
+        compressed = f.read(2) == b"\x1f\x8b"
+    stream = (gzip.open if compressed else open)(args.trace, "rb")
+
+    strings = {}
+    # An instruction is printed once we know no result record follows it.
+    pending = None
+    for rec_type, fields, payload in records(stream):
+        if rec_type == REC_RESULT:
+            print(render(pending, strings, payload, args), file=out)
+            pending = None
+            continue
+        if pending:
+            print(render(pending, strings, None, args), file=out)
+            pending = None
+        if rec_type == REC_STRING:
+            strings[fields[1]] = payload
+        else:
+            pending = fields
+    if pending:
+        print(render(pending, strings, None, args), file=out)
+    stream.close()
+
+
+def main():
+    args = make_parser().parse_args()
+    out = open(args.output, "w") if args.output else sys.stdout
+    decode(args, out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Reader for the columnar binary stat format (bin:// stat outputs).
+
+The reader can be used as a library:
+
+    from statsbin import StatsBinReader
+
+    reader = StatsBinReader("m5out/stats.bin")
+    for tick, values in reader.dumps():
+        print(tick, values["system.cpu.numCycles"])
+
+or as a script to convert a binary stat file to text or CSV:
+
+    statsbin.py m5out/stats.bin
+    statsbin.py --csv m5out/stats.bin system.cpu.ipc system.cpu.numCycles
+
+See src/base/stats/binary.hh for a description of the file format.
+"""
+
+import argparse
+import gzip
+import struct
+import sys
+
+MAGIC = b"gem5stat"
+VERSION = 1
+
+REC_COLUMN = ord("C")
+REC_DUMP = ord("D")
+
+_u64 = struct.Struct("<Q")
+_entry_val = struct.Struct("<d")
+
+
+def _read(f, size):
+    data = f.read(size)
+    if len(data) != size:
+        raise ValueError("Truncated binary stat file")
+    return data
+
+
+def _varint(f):
+    val = 0
+    shift = 0
+    while True:
+        byte = _read(f, 1)[0]
+        val |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return val
+        shift += 7
+
+
+def _string(f):
+    return _read(f, _varint(f)).decode()
+
+
+class StatsBinReader:
+    """Incremental reader for binary stat files.
+
+    The file is streamed, so only one dump is held in memory at a time
+    no matter how large the file is.
+    """
+
+    def __init__(self, filename):
+        self._filename = filename
+        self._opener = gzip.open if filename.endswith(".gz") else open
+        # Check the header up front
+        self._open().close()
+
+        # Column metadata, indexed by column id.
+        self.names = []
+        self.descs = []
+
+    def _open(self):
+        f = self._opener(self._filename, "rb")
+        if f.read(len(MAGIC)) != MAGIC:
+            f.close()
+            raise ValueError(f"{self._filename}: not a binary stat file")
+        version = _varint(f)
+        if version != VERSION:
+            f.close()
+            raise ValueError(
+                f"{self._filename}: unsupported version {version}"
+            )
+        return f
+
+    def _records(self, f):
+        """Iterate over the records of f, reading column records into
+        self.names and self.descs and yielding the tick and entry count of
+        every dump record. The caller must consume the entries."""
+        self.names = []
+        self.descs = []
+        while True:
+            rec = f.read(1)
+            if not rec:
+                return
+            if rec[0] == REC_COLUMN:
+                col = _varint(f)
+                assert col == len(self.names)
+                self.names.append(_string(f))
+                self.descs.append(_string(f))
+            elif rec[0] == REC_DUMP:
+                (tick,) = _u64.unpack(_read(f, _u64.size))
+                yield tick, _varint(f)
+            else:
+                raise ValueError(f"Unknown record type {rec[0]}")
+
+    def column_names(self):
+        """Names of all columns in the file, without decoding the values
+        of the dumps."""
+        with self._open() as f:
+            for _, count in self._records(f):
+                for _ in range(count):
+                    _varint(f)
+                    _read(f, _entry_val.size)
+        return list(self.names)
+
+    def raw_dumps(self):
+        """Iterate over dumps as (tick, {column id: value}) tuples.
+
+        Only the values that changed since the previous dump are
+        included. Column metadata is available in self.names and
+        self.descs once a column has been referenced.
+        """
+        with self._open() as f:
+            for tick, count in self._records(f):
+                changed = {}
+                col = 0
+                for _ in range(count):
+                    col += _varint(f)
+                    (changed[col],) = _entry_val.unpack(
+                        _read(f, _entry_val.size)
+                    )
+                yield tick, changed
+
+    def dumps(self, columns=None):
+        """Iterate over dumps as (tick, {name: value}) tuples.
+
+        Every yielded dictionary contains the full state of the
+        selected columns (or all columns if columns is None) as of
+        that dump.
+        """
+        wanted = set(columns) if columns is not None else None
+        state = {}
+        for tick, changed in self.raw_dumps():
+            for col, val in changed.items():
+                name = self.names[col]
+                if wanted is None or name in wanted:
+                    state[name] = val
+            yield tick, dict(state)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a binary gem5 stat file to text or CSV."
+    )
+    parser.add_argument("file", help="Binary stat file (optionally .gz)")
+    parser.add_argument(
+        "stats", nargs="*", help="Stats to output (default: all)"
+    )
+    parser.add_argument(
+        "--csv",
+        action="store_true",
+        help="Output one row per dump and one column per stat",
+    )
+    args = parser.parse_args()
+
+    reader = StatsBinReader(args.file)
+    columns = args.stats if args.stats else None
+
+    if args.csv:
+        # The header needs every column name, which takes a first pass
+        # over the file when no stats are given.
+        names = columns if columns else reader.column_names()
+        print(",".join(["tick"] + names))
+        for tick, state in reader.dumps(columns):
+            row = [str(tick)] + [
+                repr(state[n]) if n in state else "" for n in names
+            ]
+            print(",".join(row))
+    else:
+        for tick, state in reader.dumps(columns):
+            print(f"\n---------- Dump at tick {tick} ----------")
+            for name, val in state.items():
+                print(f"{name:<60} {val}")
+
+
+if __name__ == "__main__":
+    sys.exit(main())